@@ -0,0 +1,286 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_cache.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    /// This class implements a client side cache for the elements of a
+    /// partitioned_vector. It reduces the number of remote operations
+    /// needed for fine grained element access.
+    ///
+    /// Elements are read in blocks of \a window consecutive elements. Each
+    /// block that is accessed causes the next block to be requested
+    /// asynchronously (read-ahead). Writes are buffered and sent in batches
+    /// of \a window elements (write-behind), grouped by the partition owning
+    /// them.
+    ///
+    /// The cache is not synchronized with other users of the vector. Writes
+    /// become visible to others only after \a flush has completed, and
+    /// changes made by others become visible only after \a invalidate has
+    /// been called. The cache may not be used concurrently from more than
+    /// one thread.
+    ///
+    /// \tparam T    The type of the elements of the vector
+    /// \tparam Data The type of the underlying data of the vector
+    ///
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_cache
+    {
+    public:
+        typedef partitioned_vector<T, Data> vector_type;
+        typedef std::size_t size_type;
+
+        /// Create a cache for the given vector.
+        ///
+        /// \param v           The vector to cache the elements of. The
+        ///                    vector has to outlive the cache.
+        /// \param window      The number of elements that are read or
+        ///                    written at once
+        /// \param max_blocks  The maximum number of blocks kept in the
+        ///                    cache, the oldest block is dropped first
+        ///
+        explicit partitioned_vector_cache(vector_type& v,
+            size_type window = 1024, size_type max_blocks = 16)
+          : v_(&v)
+          , window_(window)
+          , max_blocks_(max_blocks)
+          , sent_(make_ready_future())
+        {
+            HPX_ASSERT(window_ != 0 && max_blocks_ != 0);
+        }
+
+        partitioned_vector_cache(partitioned_vector_cache const&) = delete;
+        partitioned_vector_cache& operator=(
+            partitioned_vector_cache const&) = delete;
+
+        /// Sends all buffered writes and waits for them to be finished.
+        /// Errors are ignored, call \a flush to be notified about those.
+        ~partitioned_vector_cache()
+        {
+            flush().wait();
+        }
+
+        /// Return the number of elements read or written at once.
+        size_type window() const
+        {
+            return window_;
+        }
+
+        /// Returns the element at the global position \a pos.
+        ///
+        /// \param pos   Global position of the element in the vector
+        ///
+        /// \return Returns the value of the element at position represented
+        ///         by \a pos.
+        ///
+        T get_value(launch::sync_policy, size_type pos)
+        {
+            auto it = writes_.find(pos);
+            if (it != writes_.end())
+                return it->second;
+
+            return get_block(pos / window_).get()[pos % window_];
+        }
+
+        /// Asynchronously returns the element at the global position \a pos.
+        ///
+        /// \param pos   Global position of the element in the vector
+        ///
+        /// \return Returns the hpx::future to the value of the element at
+        ///         position represented by \a pos.
+        ///
+        future<T> get_value(size_type pos)
+        {
+            auto it = writes_.find(pos);
+            if (it != writes_.end())
+                return make_ready_future(it->second);
+
+            size_type offset = pos % window_;
+            return get_block(pos / window_)
+                .then(launch::sync,
+                    [offset](shared_future<std::vector<T>>&& f) -> T {
+                        return f.get()[offset];
+                    });
+        }
+
+        /// Set the element at the global position \a pos to the given value.
+        /// The write is buffered and sent together with other buffered
+        /// writes once \a window writes are pending or \a flush is called.
+        ///
+        /// \param pos   Global position of the element in the vector
+        /// \param val   The value to be copied
+        ///
+        template <typename T_>
+        void set_value(size_type pos, T_&& val)
+        {
+            HPX_ASSERT(pos < v_->size());
+
+            writes_[pos] = std::forward<T_>(val);
+            if (writes_.size() >= window_)
+                send_writes();
+        }
+
+        /// Send all buffered writes.
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once all writes issued so far have been finished. It
+        ///         holds the first error reported by any of those.
+        ///
+        future<void> flush()
+        {
+            send_writes();
+
+            // report errors only once, later writes are still ordered after
+            // the ones sent so far
+            shared_future<void> sent = sent_;
+            sent_ = sent.then(launch::sync, [](shared_future<void>&&) {});
+
+            return sent.then(
+                launch::sync, [](shared_future<void>&& f) { f.get(); });
+        }
+
+        /// Send all buffered writes and wait for them to be finished.
+        void flush(launch::sync_policy)
+        {
+            flush().get();
+        }
+
+        /// Drop all cached blocks, buffered writes are kept. Subsequent reads
+        /// will fetch the elements from the vector again.
+        void invalidate()
+        {
+            blocks_.clear();
+            order_.clear();
+        }
+
+    private:
+        // Return the (possibly outstanding) values of the given block, and
+        // make sure the next block is requested as well
+        shared_future<std::vector<T>> get_block(size_type block)
+        {
+            shared_future<std::vector<T>> values;
+
+            auto it = blocks_.find(block);
+            if (it != blocks_.end())
+                values = it->second;
+            else
+                values = request_block(block);
+
+            if ((block + 1) * window_ < v_->size() &&
+                blocks_.find(block + 1) == blocks_.end())
+            {
+                request_block(block + 1);
+            }
+
+            return values;
+        }
+
+        shared_future<std::vector<T>> request_block(size_type block)
+        {
+            size_type first = block * window_;
+            size_type last = (std::min)(first + window_, v_->size());
+            HPX_ASSERT(first < last);
+
+            std::vector<size_type> pos(last - first);
+            std::iota(pos.begin(), pos.end(), first);
+
+            // make sure all writes sent so far are visible
+            shared_future<std::vector<T>> values;
+            if (sent_.is_ready())
+            {
+                values = v_->get_values(pos);
+            }
+            else
+            {
+                vector_type* v = v_;
+                values = sent_.then(launch::sync,
+                    [v, pos = std::move(pos)](shared_future<void>&&) {
+                        return v->get_values(pos);
+                    });
+            }
+
+            blocks_[block] = values;
+            order_.push_back(block);
+
+            if (order_.size() > max_blocks_)
+            {
+                blocks_.erase(order_.front());
+                order_.pop_front();
+            }
+
+            return values;
+        }
+
+        void drop_block(size_type block)
+        {
+            if (blocks_.erase(block) != 0)
+            {
+                order_.erase(std::find(order_.begin(), order_.end(), block));
+            }
+        }
+
+        void send_writes()
+        {
+            if (writes_.empty())
+                return;
+
+            std::vector<size_type> pos;
+            std::vector<T> values;
+            pos.reserve(writes_.size());
+            values.reserve(writes_.size());
+
+            for (auto& write : writes_)
+            {
+                pos.push_back(write.first);
+                values.push_back(std::move(write.second));
+
+                // cached copies of the written elements are outdated now
+                drop_block(write.first / window_);
+            }
+            writes_.clear();
+
+            // writes are ordered after the ones sent before, this keeps
+            // overlapping batches consistent
+            vector_type* v = v_;
+            sent_ = sent_.then(launch::sync,
+                [v, pos = std::move(pos), values = std::move(values)](
+                    shared_future<void>&& f) {
+                    f.get();    // propagate exceptions
+                    return v->set_values(pos, values);
+                });
+        }
+
+    private:
+        vector_type* v_;
+        size_type window_;
+        size_type max_blocks_;
+
+        std::unordered_map<size_type, shared_future<std::vector<T>>> blocks_;
+        std::deque<size_type> order_;    // blocks in the order of request
+
+        std::map<size_type, T> writes_;    // buffered writes
+        shared_future<void> sent_;         // ready once sent writes are done
+    };
+}    // namespace hpx
@@ -293,6 +293,15 @@ namespace hpx {
         std::vector<size_type> get_local_indices(
             std::vector<size_type> indices) const;
 
+        // Group the given global indices by the partition owning them. For
+        // each involved partition this returns its sequence number, the local
+        // indices inside it, and the positions in \a indices they were taken
+        // from.
+        void get_partitioned_indices(std::vector<size_type> const& indices,
+            std::vector<size_type>& parts,
+            std::vector<std::vector<size_type>>& local_indices,
+            std::vector<std::vector<std::size_t>>& origins) const;
+
         // Return the global index corresponding to the local index inside the
         // given segment.
         template <typename SegmentIter>
@@ -618,13 +627,17 @@ namespace hpx {
                 .get_values(pos);
         }
 
-        /// Returns the elements at the positions \a pos
+        /// Asynchronously returns the elements at the positions \a pos
         /// in the vector container.
         ///
-        /// \param pos   Global position of the element in the vector
+        /// The positions do not have to be ordered. They are grouped by the
+        /// partition owning them and exactly one request is sent to each of
+        /// the involved partitions.
         ///
-        /// \return Returns the value of the element at position represented by
-        ///         \a pos.
+        /// \param pos   Global positions of the elements in the vector
+        ///
+        /// \return Returns the hpx::future to the values of the elements at
+        ///         the positions represented by \a pos (in the same order).
         ///
         future<std::vector<T>> get_values(
             std::vector<size_type> const& pos_vec) const
@@ -634,71 +647,47 @@ namespace hpx {
             if (pos_vec.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos_vec[0]);
+            std::vector<size_type> parts;
+            std::vector<std::vector<size_type>> local_pos;
+            std::vector<std::vector<std::size_t>> origins;
+            get_partitioned_indices(pos_vec, parts, local_pos, origins);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator part_begin =
-                pos_vec.begin();
+            // all positions refer to the same partition, the values are
+            // returned in the requested order already
+            if (parts.size() == 1)
+                return get_values(parts[0], local_pos[0]);
 
-            // vector holding futures of the values for all blocks
+            // vector holding futures of the values for all partitions
             std::vector<future<std::vector<T>>> part_values_future;
-            for (typename std::vector<size_type>::const_iterator it =
-                     pos_vec.begin();
-                 it != pos_vec.end(); ++it)
+            part_values_future.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
-
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // get async values for this block
-                    part_values_future.push_back(get_values(part_cur,
-                        get_local_indices(
-                            std::vector<size_type>(part_begin, it))));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    part_begin = it;
-                }
+                part_values_future.push_back(
+                    get_values(parts[i], local_pos[i]));
             }
 
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(part_begin, pos_vec.end()))));
-
-            // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
-            auto merge_func =
-                [&pos_vec](std::vector<future<std::vector<T>>>&& part_values_f)
-                -> std::vector<T> {
-                std::vector<T> values;
-                values.reserve(pos_vec.size());
-
-                for (future<std::vector<T>>& part_f : part_values_f)
+            // This helper function scatters the values received from each
+            // partition back to the order of the requested positions
+            auto merge_func = [size = pos_vec.size(),
+                                  origins = std::move(origins)](
+                                  std::vector<future<std::vector<T>>>&&
+                                      part_values_f) -> std::vector<T> {
+                std::vector<T> values(size);
+                for (std::size_t i = 0; i != part_values_f.size(); ++i)
                 {
-                    std::vector<T> part_values = part_f.get();
-                    std::move(part_values.begin(), part_values.end(),
-                        std::back_inserter(values));
+                    std::vector<T> part_values = part_values_f[i].get();
+                    HPX_ASSERT(part_values.size() == origins[i].size());
+
+                    for (std::size_t j = 0; j != part_values.size(); ++j)
+                        values[origins[i][j]] = std::move(part_values[j]);
                 }
                 return values;
             };
 
             // when all values are here merge them to one vector
             // and return a future to this vector
-            return dataflow(
-                launch::async, merge_func, std::move(part_values_future));
+            return dataflow(launch::async, std::move(merge_func),
+                std::move(part_values_future));
         }
 
         /// Returns the elements at the positions \a pos
@@ -931,13 +920,13 @@ namespace hpx {
         /// the partition \part of the vector container.
         ///
         /// \param part  Sequence number of the partition
-        /// \param pos   Position of the element in the vector
+        /// \param pos   Position of the element in the partition
         /// \param val   The value to be copied
         ///
-        void set_values(launch::sync_policy, size_type /* part */,
+        void set_values(launch::sync_policy, size_type part,
             std::vector<size_type> const& pos, std::vector<T> const& val)
         {
-            set_values(pos, val).get();
+            set_values(part, pos, val).get();
         }
 
         /// Asynchronously set the element at position \a pos in
@@ -966,11 +955,15 @@ namespace hpx {
                 .set_values(pos, val);
         }
 
-        /// Asynchronously set the element at position \a pos
-        /// to the given value \a val.
+        /// Asynchronously set the elements at the positions \a pos
+        /// to the given values \a val.
         ///
-        /// \param pos   Global position of the element in the vector
-        /// \param val   The value to be copied
+        /// The positions do not have to be ordered. They are grouped by the
+        /// partition owning them and exactly one request is sent to each of
+        /// the involved partitions.
+        ///
+        /// \param pos   Global positions of the elements in the vector
+        /// \param val   The values to be copied
         ///
         /// \return This returns the hpx::future of type void which gets ready
         ///         once the operation is finished.
@@ -985,58 +978,28 @@ namespace hpx {
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
+            std::vector<size_type> parts;
+            std::vector<std::vector<size_type>> local_pos;
+            std::vector<std::vector<std::size_t>> origins;
+            get_partitioned_indices(pos, parts, local_pos, origins);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator pos_block_begin =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin =
-                val.begin();
+            if (parts.size() == 1)
+                return set_values(parts[0], local_pos[0], val);
 
-            // vector holding futures of the state for all blocks
+            // vector holding futures of the state for all partitions
             std::vector<future<void>> part_futures;
-
-            // going through the position vector
-            typename std::vector<size_type>::const_iterator pos_it =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            part_futures.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
+                std::vector<T> part_values;
+                part_values.reserve(origins[i].size());
+                for (std::size_t origin : origins[i])
+                    part_values.push_back(val[origin]);
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // set asynchronous values for this block
-                    part_futures.push_back(set_values(part_cur,
-                        get_local_indices(
-                            std::vector<size_type>(pos_block_begin, pos_it)),
-                        std::vector<T>(val_block_begin, val_it)));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    pos_block_begin = pos_it;
-                    val_block_begin = val_it;
-                }
+                part_futures.push_back(
+                    set_values(parts[i], local_pos[i], part_values));
             }
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
-
             return when_all(part_futures);
         }
 
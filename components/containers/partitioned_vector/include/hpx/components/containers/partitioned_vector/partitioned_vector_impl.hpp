@@ -214,6 +214,35 @@ namespace hpx
         return indices;
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::get_partitioned_indices(
+        std::vector<size_type> const& indices, std::vector<size_type>& parts,
+        std::vector<std::vector<size_type>>& local_indices,
+        std::vector<std::vector<std::size_t>>& origins) const
+    {
+        // index of the bucket assigned to each of the partitions
+        std::vector<std::size_t> buckets(partitions_.size(), std::size_t(-1));
+
+        for (std::size_t i = 0; i != indices.size(); ++i)
+        {
+            std::size_t part = get_partition(indices[i]);
+            HPX_ASSERT(part < partitions_.size());
+
+            std::size_t& bucket = buckets[part];
+            if (bucket == std::size_t(-1))
+            {
+                bucket = parts.size();
+                parts.push_back(part);
+                local_indices.emplace_back();
+                origins.emplace_back();
+            }
+
+            local_indices[bucket].push_back(get_local_index(indices[i]));
+            origins[bucket].push_back(i);
+        }
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector<T, Data>::local_iterator
@@ -0,0 +1,144 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_cache.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v)
+{
+    for (std::size_t i = 0; i != v.size(); ++i)
+        v.set_value(hpx::launch::sync, i, T(i));
+}
+
+template <typename T>
+void gather_scatter_tests(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v);
+
+    // unordered positions spanning all partitions
+    std::vector<std::size_t> positions(v.size());
+    for (std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] = i;
+    std::shuffle(positions.begin(), positions.end(), std::mt19937{});
+
+    std::vector<T> result = v.get_values(hpx::launch::sync, positions);
+    HPX_TEST_EQ(result.size(), positions.size());
+    for (std::size_t i = 0; i != positions.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i], T(positions[i]));
+    }
+
+    std::vector<T> values(positions.size());
+    for (std::size_t i = 0; i != positions.size(); ++i)
+        values[i] = T(2 * positions[i]);
+
+    v.set_values(hpx::launch::sync, positions, values);
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), T(2 * i));
+    }
+}
+
+template <typename T>
+void cache_tests(hpx::partitioned_vector<T>& v, std::size_t window)
+{
+    fill_vector(v);
+
+    {
+        hpx::partitioned_vector_cache<T> cache(v, window, 4);
+
+        // sequential reads
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            HPX_TEST_EQ(cache.get_value(hpx::launch::sync, i), T(i));
+        }
+
+        // buffered writes are visible through the cache immediately
+        for (std::size_t i = 0; i != v.size(); i += 3)
+        {
+            cache.set_value(i, T(i + 1));
+            HPX_TEST_EQ(cache.get_value(i).get(), T(i + 1));
+        }
+
+        // reads after writes have been sent see the new values
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            T expected = (i % 3 == 0) ? T(i + 1) : T(i);
+            HPX_TEST_EQ(cache.get_value(hpx::launch::sync, i), expected);
+        }
+
+        cache.flush(hpx::launch::sync);
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            T expected = (i % 3 == 0) ? T(i + 1) : T(i);
+            HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), expected);
+        }
+
+        // changes made by others become visible after invalidation
+        HPX_TEST_EQ(cache.get_value(hpx::launch::sync, 0), T(1));
+        v.set_value(hpx::launch::sync, 0, T(42));
+        HPX_TEST_EQ(cache.get_value(hpx::launch::sync, 0), T(1));
+
+        cache.invalidate();
+        HPX_TEST_EQ(cache.get_value(hpx::launch::sync, 0), T(42));
+
+        // the destructor sends the remaining writes
+        cache.set_value(v.size() - 1, T(43));
+    }
+
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, v.size() - 1), T(43));
+}
+
+template <typename T, typename DistPolicy>
+void cache_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v(size, policy);
+
+    gather_scatter_tests(v);
+
+    cache_tests(v, 1);
+    cache_tests(v, 7);
+    cache_tests(v, size);
+}
+
+template <typename T>
+void cache_tests()
+{
+    std::size_t const length = 107;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    cache_tests_with_policy<T>(length, hpx::container_layout);
+    cache_tests_with_policy<T>(length, hpx::container_layout(3));
+    cache_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    cache_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    cache_tests<double>();
+    cache_tests<int>();
+
+    return 0;
+}
+#endif
@@ -0,0 +1,402 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/detail/concurrent_open_hash_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail {
+
+    /// This is a hash map using open addressing with Robin Hood probing
+    /// which can be accessed concurrently from several threads.
+    ///
+    /// The elements are distributed over a number of shards based on their
+    /// hash value. Each shard is a separate flat table protected by its own
+    /// spinlock, which allows for operations on different shards to proceed
+    /// in parallel. Construction, assignment, and destruction are not
+    /// thread-safe.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class concurrent_open_hash_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::size_t size_type;
+
+    private:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        static constexpr size_type npos = size_type(-1);
+
+        struct slot
+        {
+            std::size_t hash_ = 0;
+            size_type dist_ = 0;    // probe distance + 1, zero if empty
+            hpx::util::optional<value_type> value_;
+        };
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            std::vector<slot> slots_;    // empty or a power of two in size
+            size_type size_ = 0;
+        };
+
+    public:
+        explicit concurrent_open_hash_map(size_type bucket_count = 0,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(),
+            size_type num_shards = 16)
+          : hash_(hash)
+          , equal_(equal)
+          , shard_bits_(0)
+        {
+            while ((size_type(1) << shard_bits_) < num_shards)
+                ++shard_bits_;
+
+            shards_ = std::vector<shard>(size_type(1) << shard_bits_);
+
+            if (bucket_count != 0)
+            {
+                size_type capacity = 8;
+                while (capacity * shards_.size() < bucket_count)
+                    capacity *= 2;
+
+                for (shard& s : shards_)
+                    s.slots_.resize(capacity);
+            }
+        }
+
+        concurrent_open_hash_map(concurrent_open_hash_map const& rhs)
+          : hash_(rhs.hash_)
+          , equal_(rhs.equal_)
+          , shard_bits_(rhs.shard_bits_)
+          , shards_(rhs.shards_.size())
+        {
+            for (size_type i = 0; i != shards_.size(); ++i)
+            {
+                shard const& s = rhs.shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                shards_[i].slots_ = s.slots_;
+                shards_[i].size_ = s.size_;
+            }
+        }
+
+        concurrent_open_hash_map(concurrent_open_hash_map&& rhs) = default;
+
+        concurrent_open_hash_map& operator=(
+            concurrent_open_hash_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                *this = concurrent_open_hash_map(rhs);
+            }
+            return *this;
+        }
+
+        concurrent_open_hash_map& operator=(
+            concurrent_open_hash_map&& rhs) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Returns the number of elements
+        size_type size() const
+        {
+            size_type result = 0;
+            for (shard const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.size_;
+            }
+            return result;
+        }
+
+        /// Returns the number of elements the container has currently
+        /// allocated space for
+        size_type capacity() const
+        {
+            size_type result = 0;
+            for (shard const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.slots_.size();
+            }
+            return result;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Remove all elements
+        void clear()
+        {
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.slots_.clear();
+                s.size_ = 0;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copy the value stored for the given key to \a value, returns
+        /// whether the key was found
+        bool find(Key const& key, T& value) const
+        {
+            std::size_t h = hash(key);
+            shard const& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i == npos)
+                return false;
+
+            value = s.slots_[i].value_->second;
+            return true;
+        }
+
+        /// Move the value stored for the given key to \a value and remove
+        /// the element, returns whether the key was found
+        bool extract(Key const& key, T& value)
+        {
+            std::size_t h = hash(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i == npos)
+                return false;
+
+            value = std::move(s.slots_[i].value_->second);
+            erase_index(s, i);
+            return true;
+        }
+
+        /// Return a copy of the value stored for the given key, if any. This
+        /// does not require \a T to be default constructible.
+        hpx::util::optional<T> find(Key const& key) const
+        {
+            std::size_t h = hash(key);
+            shard const& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i == npos)
+                return hpx::util::nullopt;
+
+            return hpx::util::optional<T>(s.slots_[i].value_->second);
+        }
+
+        /// Remove the element with the given key and return its value, if
+        /// any. This does not require \a T to be default constructible.
+        hpx::util::optional<T> extract(Key const& key)
+        {
+            std::size_t h = hash(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i == npos)
+                return hpx::util::nullopt;
+
+            hpx::util::optional<T> value(
+                std::move(s.slots_[i].value_->second));
+            erase_index(s, i);
+            return value;
+        }
+
+        /// Insert a new element or assign to the existing one, returns
+        /// whether a new element was inserted
+        template <typename T_>
+        bool insert_or_assign(Key const& key, T_&& value)
+        {
+            std::size_t h = hash(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i != npos)
+            {
+                s.slots_[i].value_->second = std::forward<T_>(value);
+                return false;
+            }
+
+            // keep the load factor below 7/8
+            if ((s.size_ + 1) * 8 > s.slots_.size() * 7)
+                grow(s);
+
+            slot entry;
+            entry.hash_ = h;
+            entry.dist_ = 1;
+            entry.value_.emplace(key, std::forward<T_>(value));
+
+            insert_slot(s, std::move(entry));
+            ++s.size_;
+            return true;
+        }
+
+        /// Remove the element with the given key, returns the number of
+        /// elements removed
+        size_type erase(Key const& key)
+        {
+            std::size_t h = hash(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            size_type i = find_index(s, key, h);
+            if (i == npos)
+                return 0;
+
+            erase_index(s, i);
+            return 1;
+        }
+
+        /// Invoke the given function for all elements. The shard holding the
+        /// element is locked during the invocation, the function must not
+        /// access the container.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (shard const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (slot const& sl : s.slots_)
+                {
+                    if (sl.dist_ != 0)
+                        f(sl.value_->first, sl.value_->second);
+                }
+            }
+        }
+
+    private:
+        std::size_t hash(Key const& key) const
+        {
+            // mix the bits as std::hash is the identity for integral types,
+            // the low bits select the shard, the others the slot
+            std::uint64_t h = hash_(key);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<std::size_t>(h);
+        }
+
+        shard& get_shard(std::size_t h)
+        {
+            return shards_[h & (shards_.size() - 1)];
+        }
+
+        shard const& get_shard(std::size_t h) const
+        {
+            return shards_[h & (shards_.size() - 1)];
+        }
+
+        size_type home(std::size_t h, size_type mask) const
+        {
+            return (h >> shard_bits_) & mask;
+        }
+
+        // all functions below require the lock of the shard to be held
+        size_type find_index(
+            shard const& s, Key const& key, std::size_t h) const
+        {
+            if (s.slots_.empty())
+                return npos;
+
+            size_type mask = s.slots_.size() - 1;
+            size_type i = home(h, mask);
+            for (size_type dist = 1; /**/; ++dist, i = (i + 1) & mask)
+            {
+                slot const& sl = s.slots_[i];
+
+                // an element with a shorter probe distance (or an empty slot)
+                // means the key is not stored
+                if (sl.dist_ < dist)
+                    return npos;
+
+                if (sl.hash_ == h && equal_(sl.value_->first, key))
+                    return i;
+            }
+        }
+
+        void insert_slot(shard& s, slot&& entry)
+        {
+            size_type mask = s.slots_.size() - 1;
+            size_type i = home(entry.hash_, mask);
+            for (/**/; /**/; i = (i + 1) & mask, ++entry.dist_)
+            {
+                slot& sl = s.slots_[i];
+                if (sl.dist_ == 0)
+                {
+                    sl = std::move(entry);
+                    return;
+                }
+
+                // take the slot from elements closer to their home slot
+                if (sl.dist_ < entry.dist_)
+                {
+                    std::swap(sl, entry);
+                }
+            }
+        }
+
+        void erase_index(shard& s, size_type i)
+        {
+            // shift the following elements back instead of leaving a
+            // tombstone
+            size_type mask = s.slots_.size() - 1;
+            size_type next = (i + 1) & mask;
+            while (s.slots_[next].dist_ > 1)
+            {
+                s.slots_[i] = std::move(s.slots_[next]);
+                --s.slots_[i].dist_;
+
+                i = next;
+                next = (next + 1) & mask;
+            }
+
+            s.slots_[i].dist_ = 0;
+            s.slots_[i].value_.reset();
+            --s.size_;
+        }
+
+        void grow(shard& s)
+        {
+            std::vector<slot> slots(
+                s.slots_.empty() ? size_type(8) : 2 * s.slots_.size());
+            std::swap(s.slots_, slots);
+
+            for (slot& sl : slots)
+            {
+                if (sl.dist_ != 0)
+                {
+                    sl.dist_ = 1;
+                    insert_slot(s, std::move(sl));
+                }
+            }
+        }
+
+    private:
+        Hash hash_;
+        KeyEqual equal_;
+
+        size_type shard_bits_;
+        std::vector<shard> shards_;
+    };
+}}    // namespace hpx::detail
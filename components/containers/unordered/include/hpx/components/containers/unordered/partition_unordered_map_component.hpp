@@ -12,9 +12,11 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
-/// except all API'are defined as component action. All the API's in client
-/// classes are asynchronous API which return the futures.
+/// The partition_unordered_map stores its elements in a concurrent hash map
+/// using open addressing, all API's are defined as component actions. The
+/// actions are not serialized, they may run concurrently with each other and
+/// with direct accesses to local partitions. All the API's in client classes
+/// are asynchronous API which return the futures.
 
 #include <hpx/config.hpp>
 #include <hpx/actions/transfer_action.hpp>
@@ -28,7 +30,7 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
@@ -37,7 +39,10 @@
 #include <hpx/runtime_components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/detail/concurrent_open_hash_map.hpp>
+
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -47,31 +52,35 @@
 
 namespace hpx { namespace server
 {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+    /// \brief This is the server component holding one partition of an
+    ///        unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in a concurrent hash
+    /// map using open addressing, which allows for the actions to be executed
+    /// concurrently.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key> >
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual> >
     {
     public:
+        // the type used to transfer the data of a partition
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
-        typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
+        // the type used to store the data of a partition
+        typedef detail::concurrent_open_hash_map<Key, T, Hash, KeyEqual>
+            storage_type;
+
+        typedef typename storage_type::size_type size_type;
 
-        typedef components::locking_hook<
-                hpx::components::component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
+        typedef hpx::components::component_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual> >
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -127,38 +136,21 @@ namespace hpx { namespace server
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type data;
+            partition_unordered_map_.for_each(
+                [&data](Key const& key, T const& value) {
+                    data.emplace(key, value);
+                });
+            return data;
         }
         void set_copied_data(data_type && d)
         {
-            partition_unordered_map_ = std::move(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_.clear();
+            for (auto& value : d)
+            {
+                partition_unordered_map_.insert_or_assign(
+                    value.first, std::move(value.second));
+            }
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -174,7 +166,7 @@ namespace hpx { namespace server
         /// Returns the maximum possible number of elements
         size_type max_size() const
         {
-            return partition_unordered_map_.max_size();
+            return (std::numeric_limits<size_type>::max)();
         }
 
         /// Returns the number of elements that the container has currently
@@ -195,44 +187,28 @@ namespace hpx { namespace server
         // Element access API's
         ///////////////////////////////////////////////////////////////////////
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the element with the key \a key in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
+        /// \param erase Remove the element after retrieving its value
         ///
-        /// \return Return the value of the element at position represented
-        ///         by \a pos.
+        /// \return Return the value of the element with the key \a key.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            hpx::util::optional<T> value = erase ?
+                partition_unordered_map_.extract(key) :
+                partition_unordered_map_.find(key);
+
+            if (!value)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return std::move(*value);
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -250,17 +226,16 @@ namespace hpx { namespace server
 
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
+                hpx::util::optional<T> value =
                     partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (!value)
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
-                result.push_back(it->second);
+                result.push_back(std::move(*value));
             }
             return result;
         }
@@ -278,7 +253,7 @@ namespace hpx { namespace server
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -292,10 +267,9 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
         }
 
         /// Remove all elements from the vector leaving the
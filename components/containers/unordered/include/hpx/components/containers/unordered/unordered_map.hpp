@@ -12,9 +12,12 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_local/dataflow.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/runtime_components/distributed_metadata_base.hpp>
@@ -30,6 +33,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <string>
@@ -358,6 +362,34 @@ namespace hpx
             return this->hasher_(key) % partitions_.size();
         }
 
+        // Group the given keys by the partition they belong to. For each
+        // involved partition this returns its sequence number, the keys
+        // stored in it, and the positions in 'keys' they were taken from.
+        void get_partitioned_keys(std::vector<Key> const& keys,
+            std::vector<std::size_t>& parts,
+            std::vector<std::vector<Key> >& part_keys,
+            std::vector<std::vector<std::size_t> >& origins) const
+        {
+            // index of the bucket assigned to each of the partitions
+            std::vector<std::size_t> buckets(
+                partitions_.size(), std::size_t(-1));
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t& bucket = buckets[get_partition(keys[i])];
+                if (bucket == std::size_t(-1))
+                {
+                    bucket = parts.size();
+                    parts.push_back(get_partition(keys[i]));
+                    part_keys.emplace_back();
+                    origins.emplace_back();
+                }
+
+                part_keys[bucket].push_back(keys[i]);
+                origins[bucket].push_back(i);
+            }
+        }
+
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -792,6 +824,193 @@ namespace hpx
                 .set_value(pos, std::forward<T_>(val));
         }
 
+        /// Returns the values of the elements with the given keys.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements (in the same order as
+        ///         the keys).
+        ///
+        std::vector<T> get_values(launch::sync_policy,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the values of the elements with the given
+        /// keys stored in the partition \a part.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements.
+        ///
+        future<std::vector<T> >
+        get_values(size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                // report missing keys through the returned future, as is
+                // done for remote partitions
+                try
+                {
+                    return make_ready_future(
+                        part_data.local_data_->get_values(keys));
+                }
+                catch (...)
+                {
+                    return hpx::make_exceptional_future<std::vector<T> >(
+                        std::current_exception());
+                }
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values(keys);
+        }
+
+        /// Asynchronously returns the values of the elements with the given
+        /// keys.
+        ///
+        /// The keys are grouped by the partition they belong to and exactly
+        /// one request is sent to each of the involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements (in
+        ///         the same order as the keys).
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            if (keys.empty())
+                return make_ready_future(std::vector<T>());
+
+            std::vector<std::size_t> parts;
+            std::vector<std::vector<Key> > part_keys;
+            std::vector<std::vector<std::size_t> > origins;
+            get_partitioned_keys(keys, parts, part_keys, origins);
+
+            if (parts.size() == 1)
+                return get_values(parts[0], part_keys[0]);
+
+            std::vector<future<std::vector<T> > > part_values;
+            part_values.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+                part_values.push_back(get_values(parts[i], part_keys[i]));
+
+            // scatter the values received from each partition back to the
+            // order of the requested keys
+            return hpx::dataflow(hpx::launch::async,
+                [size = keys.size(), origins = std::move(origins)](
+                    std::vector<future<std::vector<T> > >&& part_values_f)
+                -> std::vector<T>
+                {
+                    // T is not required to be default constructible
+                    std::vector<hpx::util::optional<T> > scattered(size);
+                    for (std::size_t i = 0; i != part_values_f.size(); ++i)
+                    {
+                        std::vector<T> part = part_values_f[i].get();
+                        HPX_ASSERT(part.size() == origins[i].size());
+
+                        std::vector<std::size_t> const& origin = origins[i];
+                        for (std::size_t j = 0; j != part.size(); ++j)
+                            scattered[origin[j]].emplace(std::move(part[j]));
+                    }
+
+                    std::vector<T> values;
+                    values.reserve(size);
+                    for (auto& value : scattered)
+                        values.push_back(std::move(*value));
+                    return values;
+                },
+                std::move(part_values));
+        }
+
+        /// Set the elements with the given keys to the given values,
+        /// elements which do not exist yet are inserted.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously set the elements with the given keys stored in the
+        /// partition \a part to the given values.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < partitions_.size());
+            HPX_ASSERT(keys.size() == vals.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_values(keys, vals);
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_values(keys, vals);
+        }
+
+        /// Asynchronously set the elements with the given keys to the given
+        /// values, elements which do not exist yet are inserted.
+        ///
+        /// The keys are grouped by the partition they belong to and exactly
+        /// one request is sent to each of the involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            if (keys.empty())
+                return make_ready_future();
+
+            std::vector<std::size_t> parts;
+            std::vector<std::vector<Key> > part_keys;
+            std::vector<std::vector<std::size_t> > origins;
+            get_partitioned_keys(keys, parts, part_keys, origins);
+
+            if (parts.size() == 1)
+                return set_values(parts[0], part_keys[0], vals);
+
+            std::vector<future<void> > part_futures;
+            part_futures.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                std::vector<T> part_vals;
+                part_vals.reserve(origins[i].size());
+                for (std::size_t origin : origins[i])
+                    part_vals.push_back(vals[origin]);
+
+                part_futures.push_back(
+                    set_values(parts[i], part_keys[i], part_vals));
+            }
+
+            return when_all(part_futures);
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/components/containers/unordered/detail/concurrent_open_hash_map.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef hpx::detail::concurrent_open_hash_map<std::size_t, std::string>
+    map_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sequential()
+{
+    map_type m;
+    HPX_TEST(m.empty());
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(m.insert_or_assign(i, std::to_string(i)));
+    }
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+
+    // assigning to existing elements does not insert
+    HPX_TEST(!m.insert_or_assign(std::size_t(42), std::string("42!")));
+    HPX_TEST_EQ(m.size(), std::size_t(1000));
+
+    std::string value;
+    HPX_TEST(m.find(42, value));
+    HPX_TEST_EQ(value, std::string("42!"));
+    HPX_TEST(!m.find(1000, value));
+
+    // remove every other element, the remaining ones have to be found
+    for (std::size_t i = 0; i < 1000; i += 2)
+    {
+        HPX_TEST_EQ(m.erase(i), std::size_t(1));
+    }
+    HPX_TEST_EQ(m.erase(0), std::size_t(0));
+    HPX_TEST_EQ(m.size(), std::size_t(500));
+
+    for (std::size_t i = 1; i < 1000; i += 2)
+    {
+        HPX_TEST(m.find(i, value));
+        HPX_TEST_EQ(value, std::to_string(i));
+    }
+
+    HPX_TEST(m.extract(1, value));
+    HPX_TEST_EQ(value, std::string("1"));
+    HPX_TEST(!m.find(1, value));
+
+    // copies are independent
+    map_type copy(m);
+    m.clear();
+    HPX_TEST(m.empty());
+    HPX_TEST_EQ(copy.size(), std::size_t(499));
+
+    std::size_t count = 0;
+    copy.for_each([&](std::size_t key, std::string const& value) {
+        HPX_TEST_EQ(value, std::to_string(key));
+        ++count;
+    });
+    HPX_TEST_EQ(count, std::size_t(499));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// values which are not default constructible are accessed through optionals
+struct no_default
+{
+    explicit no_default(std::size_t v)
+      : value(v)
+    {
+    }
+
+    std::size_t value;
+};
+
+void test_optional_access()
+{
+    hpx::detail::concurrent_open_hash_map<std::size_t, no_default> m;
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(m.insert_or_assign(i, no_default(2 * i)));
+    }
+
+    hpx::util::optional<no_default> value = m.find(42);
+    HPX_TEST(value.has_value());
+    HPX_TEST_EQ(value->value, std::size_t(84));
+    HPX_TEST(!m.find(100).has_value());
+
+    value = m.extract(42);
+    HPX_TEST(value.has_value());
+    HPX_TEST_EQ(value->value, std::size_t(84));
+    HPX_TEST(!m.find(42).has_value());
+    HPX_TEST(!m.extract(42).has_value());
+    HPX_TEST_EQ(m.size(), std::size_t(99));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent()
+{
+    std::size_t const num_tasks = 8;
+    std::size_t const count = 10000;
+
+    map_type m(0, std::hash<std::size_t>(), std::equal_to<std::size_t>(), 4);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t, count]() {
+            for (std::size_t i = t; i < count; i += num_tasks)
+            {
+                m.insert_or_assign(i, std::to_string(i));
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), count);
+
+    tasks.clear();
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t, count]() {
+            std::string value;
+            for (std::size_t i = t; i < count; i += num_tasks)
+            {
+                HPX_TEST(m.find(i, value));
+                HPX_TEST_EQ(value, std::to_string(i));
+
+                if (i % 2 == 0)
+                {
+                    HPX_TEST_EQ(m.erase(i), std::size_t(1));
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), count / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_sequential();
+    test_optional_access();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -23,6 +23,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Define the vector types to be used.
 HPX_REGISTER_UNORDERED_MAP(std::string, double);
+HPX_REGISTER_UNORDERED_MAP(std::size_t, double, std::hash<std::size_t>,
+    std::equal_to<std::size_t>, size_t_double);
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename Hash, typename KeyEqual>
@@ -79,6 +81,56 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key>
+Key make_key(std::size_t i)
+{
+    return static_cast<Key>(i);
+}
+
+template <>
+std::string make_key<std::string>(std::size_t i)
+{
+    return std::to_string(i);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(make_key<Key>(i));
+        values.push_back(Value(2 * i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), count);
+
+    std::reverse(keys.begin(), keys.end());
+    std::vector<Value> result = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], Value(2 * (count - i - 1)));
+    }
+
+    HPX_TEST_EQ(m.erase(hpx::launch::sync, keys[0]), std::size_t(1));
+    HPX_TEST_EQ(m.size(), count - 1);
+
+    bool caught_exception = false;
+    try
+    {
+        m.get_values(hpx::launch::sync, keys);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -153,6 +205,30 @@ void trivial_tests()
     }
 }
 
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_access_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(policy);
+    test_bulk_access(m, 1007);
+}
+
+template <typename Key, typename Value>
+void bulk_access_tests()
+{
+    hpx::unordered_map<Key, Value> m;
+    test_bulk_access(m, 1007);
+}
+
+template <typename Key, typename Value>
+void all_bulk_access_tests(std::vector<hpx::id_type> const& localities)
+{
+    bulk_access_tests<Key, Value>();
+    bulk_access_tests<Key, Value>(hpx::container_layout);
+    bulk_access_tests<Key, Value>(hpx::container_layout(3));
+    bulk_access_tests<Key, Value>(hpx::container_layout(3, localities));
+    bulk_access_tests<Key, Value>(hpx::container_layout(localities));
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
@@ -164,6 +240,9 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
+    all_bulk_access_tests<std::string, double>(localities);
+    all_bulk_access_tests<std::size_t, double>(localities);
+
     return 0;
 }
 #endif
@@ -60,6 +60,8 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_max_parcels_per_message(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t>
             get_time_between_parcels_histogram(bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -78,6 +80,15 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+
+        // adaptive coalescing support
+        std::size_t get_num_coalesced_parcels_locked() const;
+        std::size_t get_interval_locked() const;
+        void update_adaptive_parameters_locked();
+        write_handler_type measure_latency(
+            std::int64_t sent_at, write_handler_type f);
+        void record_latency(std::int64_t latency);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +101,16 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // If enabled, the number of coalesced parcels and the flush interval
+        // are derived from the observed times between parcels and the
+        // observed latencies of sending a message. The configured values are
+        // used as upper bounds.
+        bool adaptive_;
+        std::size_t adaptive_num_coalesced_parcels_;
+        std::size_t adaptive_interval_;
+        std::int64_t average_time_between_parcels_;    // [ns]
+        std::int64_t average_latency_;                 // [ns]
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -16,6 +16,8 @@
 #include <hpx/config/asio.hpp>
 
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
+#include <hpx/plugins/parcelport/tcp/sender.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
 
@@ -23,6 +25,7 @@
 #include <asio/ip/tcp.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -107,6 +110,12 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+            bool is_same_node(parcelset::locality const& l) const override;
+
+            // retrieve performance counter value for given statistics type
+            std::int64_t get_receive_buffer_pool_statistics(
+                receive_buffer_pool_statistics_type t, bool reset) override;
+
         private:
             void handle_accept(std::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -122,6 +131,13 @@ namespace hpx { namespace parcelset
             typedef std::set<std::shared_ptr<receiver> > accepted_connections_set;
             accepted_connections_set accepted_connections_;
 
+            /// Reusable memory for the data received by all connections
+            parcelset::detail::receive_buffer_pool<std::vector<char>>
+                receive_buffer_pool_;
+
+            /// Parameters for combining the buffers of outgoing messages
+            write_gather_parameters write_gather_params_;
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
             typedef std::set<boost::weak_ptr<sender> > write_connections_set;
             write_connections_set write_connections_;
@@ -24,6 +24,7 @@
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
@@ -57,12 +58,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         using mutex_type = hpx::lcos::local::spinlock;
 
     public:
+        using receive_buffer_pool_type =
+            parcelset::detail::receive_buffer_pool<std::vector<char>>;
+
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport,
+            receive_buffer_pool_type& buffer_pool)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
           , parcelport_(parcelport)
+          , buffer_pool_(buffer_pool)
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
@@ -200,7 +206,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_pool_.allocate(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -208,7 +215,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_pool_.allocate(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffers.push_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -264,7 +272,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 {
                     std::size_t chunk_size = static_cast<std::size_t>(
                         buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
+                    buffer_pool_.allocate(buffer_.chunks_[i], chunk_size);
                     buffers.push_back(
                         asio::buffer(buffer_.chunks_[i].data(), chunk_size));
                 }
@@ -319,10 +327,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         Handler)
                     = &receiver::handle_write_ack<Handler>;
 
-                // decode the received parcels.
-                decode_parcels(
-                    parcelport_, std::move(buffer_), std::size_t(-1));
-                buffer_ = parcel_buffer_type();
+                // decode the received parcels, the buffers are not
+                // referenced anymore afterwards and can be reused
+                decode_parcels_in_place(
+                    parcelport_, buffer_, std::size_t(-1));
+                recycle_buffer();
 
                 ack_ = true;
                 {
@@ -360,6 +369,18 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             }
         }
 
+        /// Return the memory of the received message to the pool and reset
+        /// the buffer for the next message.
+        void recycle_buffer()
+        {
+            buffer_pool_.deallocate(std::move(buffer_.data_));
+            for (std::vector<char>& chunk : buffer_.chunks_)
+            {
+                buffer_pool_.deallocate(std::move(chunk));
+            }
+            buffer_.clear();
+        }
+
 
         /// Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
@@ -371,6 +392,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// The handler used to process the incoming request.
         connection_handler& parcelport_;
 
+        /// The pool providing the memory for received data.
+        receive_buffer_pool_type& buffer_pool_;
+
         /// Counters and timers for parcels received.
         hpx::chrono::high_resolution_timer timer_;
 
@@ -42,7 +42,10 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -50,6 +53,30 @@
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    /// Parameters controlling how the buffers of a message are combined into
+    /// a single gather-write.
+    struct write_gather_parameters
+    {
+        write_gather_parameters(std::size_t max_buffers = 64,
+                std::size_t threshold = 4096,
+                std::size_t max_size = 1048576)
+          : max_buffers_(max_buffers)
+          , threshold_(threshold)
+          , max_size_(max_size)
+        {}
+
+        /// The maximal number of buffers passed to a single write, zero-copy
+        /// chunks are gathered only if this number would be exceeded
+        /// otherwise (zero disables gathering).
+        std::size_t max_buffers_;
+
+        /// Zero-copy chunks of at most this size are gathered.
+        std::size_t threshold_;
+
+        /// The maximal number of bytes gathered for a single message.
+        std::size_t max_size_;
+    };
+
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char> >
     {
@@ -60,12 +87,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// Construct a sending parcelport_connection with the given io_context.
         sender(asio::io_context& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
+                parcelset::parcelport* pp,
+                write_gather_parameters const& gather_params =
+                    write_gather_parameters())
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , gather_params_(gather_params)
         {
         }
 
@@ -134,15 +164,22 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             // Write the serialized data to the socket. We use "gather-write"
             // to send both the header and the data in a single write operation.
-            std::vector<asio::const_buffer> buffers;
-            buffers.push_back(asio::buffer(&buffer_.size_,
-                sizeof(buffer_.size_)));
-            buffers.push_back(asio::buffer(&buffer_.data_size_,
-                sizeof(buffer_.data_size_)));
+            // The header fields (message size, data size, and the chunk
+            // description) are packed into one contiguous buffer.
+            static_assert(sizeof(header_) == sizeof(buffer_.size_) +
+                    sizeof(buffer_.data_size_) + sizeof(buffer_.num_chunks_),
+                "the header buffer must be able to hold all header fields");
+
+            char* header = header_;
+            std::memcpy(header, &buffer_.size_, sizeof(buffer_.size_));
+            header += sizeof(buffer_.size_);
+            std::memcpy(header, &buffer_.data_size_, sizeof(buffer_.data_size_));
+            header += sizeof(buffer_.data_size_);
+            std::memcpy(header, &buffer_.num_chunks_,
+                sizeof(buffer_.num_chunks_));
 
-            // add chunk description
-            buffers.push_back(asio::buffer(&buffer_.num_chunks_,
-                sizeof(buffer_.num_chunks_)));
+            std::vector<asio::const_buffer> buffers;
+            buffers.push_back(asio::buffer(header_, sizeof(header_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
@@ -155,11 +192,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 buffers.push_back(asio::buffer(buffer_.data_));
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
-                for (serialization::serialization_chunk& c : buffer_.chunks_)
-                {
-                    if (c.type_ == serialization::chunk_type_pointer)
-                        buffers.push_back(asio::buffer(c.data_.cpos_, c.size_));
-                }
+                add_zero_copy_chunks(buffers);
             }
             else {
                 // add main buffer holding data which was serialized normally
@@ -179,6 +212,75 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         }
 
     private:
+        /// Add the zero-copy chunks of the current message to the given
+        /// buffers. If the overall number of buffers would exceed what is
+        /// written with a single system call, consecutive small chunks are
+        /// copied into one contiguous gather buffer instead. This leaves
+        /// the data sent over the wire unchanged.
+        void add_zero_copy_chunks(std::vector<asio::const_buffer>& buffers)
+        {
+            std::size_t num_pointer_chunks = 0;
+            std::size_t gather_size = 0;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                {
+                    ++num_pointer_chunks;
+                    if (c.size_ <= gather_params_.threshold_)
+                        gather_size += c.size_;
+                }
+            }
+
+            if (gather_params_.max_buffers_ == 0 || gather_size == 0 ||
+                buffers.size() + num_pointer_chunks <=
+                    gather_params_.max_buffers_)
+            {
+                for (serialization::serialization_chunk const& c :
+                    buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type_pointer)
+                        buffers.push_back(asio::buffer(c.data_.cpos_, c.size_));
+                }
+                return;
+            }
+
+            // size the gather buffer up front, the buffers added below refer
+            // to its memory
+            gather_buffer_.resize((std::min)(gather_size, gather_params_.max_size_));
+
+            std::size_t offset = 0;
+            std::size_t run_begin = 0;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type_pointer)
+                    continue;
+
+                if (c.size_ <= gather_params_.threshold_ &&
+                    offset + c.size_ <= gather_buffer_.size())
+                {
+                    std::memcpy(
+                        gather_buffer_.data() + offset, c.data_.cpos_, c.size_);
+                    offset += c.size_;
+                    continue;
+                }
+
+                // flush the pending run of gathered chunks
+                if (run_begin != offset)
+                {
+                    buffers.push_back(asio::buffer(
+                        gather_buffer_.data() + run_begin, offset - run_begin));
+                    run_begin = offset;
+                }
+                buffers.push_back(asio::buffer(c.data_.cpos_, c.size_));
+            }
+
+            if (run_begin != offset)
+            {
+                buffers.push_back(asio::buffer(
+                    gather_buffer_.data() + run_begin, offset - run_begin));
+            }
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -279,6 +381,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         hpx::chrono::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        /// Packed message header and memory for gathered zero-copy chunks,
+        /// both need to stay alive until the write has completed.
+        char header_[3 * sizeof(std::uint64_t)];
+        write_gather_parameters gather_params_;
+        std::vector<char> gather_buffer_;
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
@@ -113,6 +113,22 @@ namespace hpx { namespace plugins {
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("compression_threshold = ${HPX_PARCEL_" +
+                name_uc +
+                "_COMPRESSION_THRESHOLD:"
+                "$[hpx.parcel.compression_threshold]}");
+            fillini.emplace_back("compress_intra_node = ${HPX_PARCEL_" +
+                name_uc +
+                "_COMPRESS_INTRA_NODE:"
+                "$[hpx.parcel.compress_intra_node]}");
+            fillini.emplace_back("compression_min_ratio = ${HPX_PARCEL_" +
+                name_uc +
+                "_COMPRESSION_MIN_RATIO:"
+                "$[hpx.parcel.compression_min_ratio]}");
+            fillini.emplace_back(
+                "compression_sample_interval = ${HPX_PARCEL_" + name_uc +
+                "_COMPRESSION_SAMPLE_INTERVAL:"
+                "$[hpx.parcel.compression_sample_interval]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
@@ -325,6 +325,17 @@ namespace hpx { namespace parcelset
         }
     }
 
+    // Decode the parcels held by the given buffer without consuming it. This
+    // allows for the memory of the buffer to be reused once this returns.
+    template <typename Parcelport, typename Buffer>
+    void decode_parcels_in_place(
+        Parcelport& parcelport, Buffer& buffer, std::size_t num_thread)
+    {
+        std::vector<serialization::serialization_chunk> chunks(
+            decode_chunks(buffer));
+        decode_message_with_chunks<Parcelport, Buffer&>(
+            parcelport, buffer, 0, chunks, num_thread);
+    }
 }}
 
 #endif
@@ -0,0 +1,116 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace hpx { namespace parcelset { namespace detail {
+
+    /// Decides for each outgoing message whether the serialization filter
+    /// (compression) requested by the parcels' action should be applied.
+    ///
+    /// Messages smaller than \a min_size are never compressed, neither are
+    /// messages sent to a locality on the same node (unless
+    /// \a compress_intra_node is set). For all other messages the
+    /// compression ratio achieved for the destination is tracked. If it
+    /// falls below \a min_ratio, only every \a sample_interval'th message
+    /// is compressed to re-sample the compressibility of the data sent to
+    /// that destination.
+    class compression_policy
+    {
+        using mutex_type = lcos::local::spinlock;
+
+        struct destination_data
+        {
+            double ratio_ = 0.0;
+            std::size_t skipped_ = 0;
+        };
+
+    public:
+        HPX_NON_COPYABLE(compression_policy);
+
+    public:
+        compression_policy(std::size_t min_size, bool compress_intra_node,
+            double min_ratio, std::size_t sample_interval)
+          : min_size_(min_size)
+          , compress_intra_node_(compress_intra_node)
+          , min_ratio_(min_ratio)
+          , sample_interval_(sample_interval)
+        {
+        }
+
+        /// Return whether a message of the given (uncompressed) size sent
+        /// to the given destination should be compressed.
+        bool compress(
+            locality const& dest, bool intra_node, std::size_t size)
+        {
+            if (size < min_size_ || (intra_node && !compress_intra_node_))
+            {
+                return false;
+            }
+
+            if (min_ratio_ <= 0.0)
+            {
+                return true;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // destinations without any samples yet are always compressed
+            destination_data& data = destinations_[dest];
+            if (data.ratio_ == 0.0 || data.ratio_ >= min_ratio_)
+            {
+                return true;
+            }
+
+            if (sample_interval_ != 0 && ++data.skipped_ >= sample_interval_)
+            {
+                data.skipped_ = 0;
+                return true;
+            }
+            return false;
+        }
+
+        /// Record the compression ratio achieved for a message sent to the
+        /// given destination.
+        void update(locality const& dest, std::size_t uncompressed_size,
+            std::size_t compressed_size)
+        {
+            if (min_ratio_ <= 0.0 || compressed_size == 0)
+            {
+                return;
+            }
+
+            double const ratio = double(uncompressed_size) / compressed_size;
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // give the most recent sample the same weight as the history
+            destination_data& data = destinations_[dest];
+            data.ratio_ =
+                data.ratio_ == 0.0 ? ratio : (data.ratio_ + ratio) / 2;
+        }
+
+    private:
+        mutex_type mtx_;
+        std::size_t const min_size_;
+        bool const compress_intra_node_;
+        double const min_ratio_;
+        std::size_t const sample_interval_;
+        std::map<locality, destination_data> destinations_;
+    };
+}}}    // namespace hpx::parcelset::detail
+
+#endif
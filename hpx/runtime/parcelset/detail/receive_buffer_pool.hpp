@@ -0,0 +1,169 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail {
+
+    /// A pool of reusable buffers for received message data.
+    ///
+    /// Pooled buffers are sorted into power-of-two size classes based on
+    /// their capacity. Allocating a buffer of a given size reuses a buffer
+    /// from the smallest size class which is guaranteed to be large enough,
+    /// if one is available. Each size class holds at most
+    /// \a max_cached_buffers buffers, buffers larger than \a max_buffer_size
+    /// are never pooled.
+    template <typename Buffer>
+    class receive_buffer_pool
+    {
+        using mutex_type = lcos::local::spinlock;
+
+        // the smallest size class holds buffers of at least 1kB
+        static constexpr std::size_t min_size_class = 10;
+
+        static std::size_t floor_log2(std::size_t size) noexcept
+        {
+            std::size_t result = 0;
+            while (size >>= 1)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        static std::size_t ceil_log2(std::size_t size) noexcept
+        {
+            return size <= 1 ? 0 : floor_log2(size - 1) + 1;
+        }
+
+        static std::size_t num_size_classes(std::size_t max_buffer_size)
+        {
+            std::size_t const max_size_class = floor_log2(max_buffer_size);
+            return max_size_class < min_size_class ?
+                0 :
+                max_size_class - min_size_class + 1;
+        }
+
+    public:
+        HPX_NON_COPYABLE(receive_buffer_pool);
+
+    public:
+        receive_buffer_pool(
+            std::size_t max_cached_buffers, std::size_t max_buffer_size)
+          : max_cached_buffers_(max_cached_buffers)
+          , free_lists_(
+                max_cached_buffers != 0 ? num_size_classes(max_buffer_size) : 0)
+          , hits_(0)
+          , misses_(0)
+        {
+        }
+
+        /// Replace the given buffer with a buffer holding \a size elements,
+        /// reusing pooled memory if possible.
+        void allocate(Buffer& buffer, std::size_t size)
+        {
+            if (buffer.capacity() != 0)
+            {
+                deallocate(std::move(buffer));
+            }
+
+            std::size_t size_class = ceil_log2(size);
+            if (size_class < min_size_class)
+            {
+                size_class = min_size_class;
+            }
+
+            std::size_t const index = size_class - min_size_class;
+            if (index < free_lists_.size())
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                std::vector<Buffer>& free_list = free_lists_[index];
+                if (!free_list.empty())
+                {
+                    buffer = std::move(free_list.back());
+                    free_list.pop_back();
+                    l.unlock();
+
+                    ++hits_;
+                    buffer.resize(size);
+                    return;
+                }
+            }
+
+            ++misses_;
+
+            // round up the allocation to the size class to allow for the
+            // buffer to be reused for any message of the same class
+            buffer = Buffer();
+            if (index < free_lists_.size())
+            {
+                buffer.reserve(std::size_t(1) << size_class);
+            }
+            buffer.resize(size);
+        }
+
+        /// Return the memory held by the given buffer to the pool.
+        void deallocate(Buffer buffer)
+        {
+            std::size_t const capacity = buffer.capacity();
+            if (capacity < (std::size_t(1) << min_size_class))
+            {
+                return;
+            }
+
+            std::size_t const index = floor_log2(capacity) - min_size_class;
+            if (index < free_lists_.size())
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                std::vector<Buffer>& free_list = free_lists_[index];
+                if (free_list.size() < max_cached_buffers_)
+                {
+                    buffer.clear();
+                    free_list.push_back(std::move(buffer));
+                }
+            }
+
+            // buffers which were not pooled are released here
+        }
+
+        /// Return the number of allocations which were served from the pool.
+        std::int64_t get_hits(bool reset)
+        {
+            return util::get_and_reset_value(hits_, reset);
+        }
+
+        /// Return the number of allocations which required new memory.
+        std::int64_t get_misses(bool reset)
+        {
+            return util::get_and_reset_value(misses_, reset);
+        }
+
+    private:
+        mutex_type mtx_;
+        std::size_t const max_cached_buffers_;
+        std::vector<std::vector<Buffer>> free_lists_;
+
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+    };
+}}}    // namespace hpx::parcelset::detail
+
+#endif
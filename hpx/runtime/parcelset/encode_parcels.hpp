@@ -19,6 +19,8 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/runtime/parcelset/detail/compression_policy.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -138,7 +140,7 @@ namespace hpx
 
         template <typename Buffer>
         std::size_t
-        encode_parcels(parcelport& pp,
+        encode_parcels(parcelport& pp, locality const& dest,
             parcel const * ps, std::size_t num_parcels, Buffer & buffer,
             int archive_flags_, std::uint64_t max_outbound_size)
         {
@@ -161,10 +163,6 @@ namespace hpx
                     std::unique_ptr<serialization::binary_filter> filter(
                         ps[0].get_serialization_filter());
 
-                    int archive_flags = archive_flags_;
-                    if (filter.get() != nullptr)
-                        archive_flags |= serialization::enable_compression;
-
                     // preallocate data
                     std::size_t num_chunks = 0;
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
@@ -175,6 +173,20 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
+                    // the action requests compression, but it is applied
+                    // only if it is expected to pay off for this message
+                    detail::compression_policy& policy =
+                        pp.get_compression_policy();
+                    if (filter.get() != nullptr &&
+                        !policy.compress(dest, pp.is_same_node(dest), arg_size))
+                    {
+                        filter.reset();
+                    }
+
+                    int archive_flags = archive_flags_;
+                    if (filter.get() != nullptr)
+                        archive_flags |= serialization::enable_compression;
+
                     buffer.data_.reserve(arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
@@ -232,6 +244,22 @@ namespace hpx
                         arg_size = archive.bytes_written();
                     }
 
+                    if (filter.get() != nullptr)
+                    {
+                        // zero-copy chunks are sent without being compressed
+                        std::size_t uncompressed_size = arg_size;
+                        for (auto const& chunk : buffer.chunks_)
+                        {
+                            if (chunk.type_ ==
+                                serialization::chunk_type_pointer)
+                            {
+                                uncompressed_size -= chunk.size_;
+                            }
+                        }
+                        policy.update(
+                            dest, uncompressed_size, buffer.data_.size());
+                    }
+
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
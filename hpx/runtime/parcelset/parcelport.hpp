@@ -17,6 +17,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/io_service.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/runtime/parcelset/detail/compression_policy.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
@@ -183,6 +184,21 @@ namespace hpx { namespace parcelset
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given receive buffer pool statistic
+        enum receive_buffer_pool_statistics_type
+        {
+            receive_buffer_pool_hits = 0,
+            receive_buffer_pool_misses = 1
+        };
+
+        // retrieve performance counter value for given statistics type,
+        // parcelports which don't pool their receive buffers report zero
+        virtual std::int64_t get_receive_buffer_pool_statistics(
+            receive_buffer_pool_statistics_type, bool /* reset */)
+        {
+            return 0;
+        }
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -198,6 +214,14 @@ namespace hpx { namespace parcelset
 
         virtual locality create_locality() const = 0;
 
+        /// Return whether the given locality runs on the same node as this
+        /// locality. Parcelports which can't tell conservatively report
+        /// \a false.
+        virtual bool is_same_node(locality const& /* dest */) const
+        {
+            return false;
+        }
+
         virtual locality agas_locality(util::runtime_configuration const& ini)
             const = 0;
 
@@ -326,6 +350,12 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        /// Return the policy deciding which messages are compressed
+        detail::compression_policy& get_compression_policy()
+        {
+            return compression_policy_;
+        }
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(std::error_code const& ec,
             parcel const & p);
@@ -372,6 +402,9 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// decides whether outgoing messages are compressed
+        detail::compression_policy compression_policy_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
@@ -526,7 +526,7 @@ namespace hpx { namespace parcelset
 
                 auto encoded_buffer = sender->get_new_buffer();
                 // encode the parcels
-                encoded_parcels = encode_parcels(this_, ps, num_parcels,
+                encoded_parcels = encode_parcels(this_, dest_, ps, num_parcels,
                     encoded_buffer,
                     this_.archive_flags_,
                     this_.get_max_outbound_message_size());
@@ -884,7 +884,8 @@ namespace hpx { namespace parcelset
             sender_connection->verify_(parcel_locality_id);
 #endif
             // encode the parcels
-            std::size_t num_parcels = encode_parcels(*this, &parcels[0],
+            std::size_t num_parcels = encode_parcels(*this,
+                    parcel_locality_id, &parcels[0],
                     parcels.size(), sender_connection->buffer_,
                     archive_flags_,
                     this->get_max_outbound_message_size());
@@ -12,11 +12,13 @@
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/functional/function.hpp>
 
+#include <memory>
 #include <system_error>
 
 namespace hpx { namespace parcelset { namespace policies
 {
     struct message_handler
+      : std::enable_shared_from_this<message_handler>
     {
         enum flush_mode
         {
@@ -240,7 +240,6 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -270,9 +269,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
-                           util::invoke_projected<F, Proj>(std::forward<F>(f),
-                               std::forward<Proj>(proj))) == last;
+                return detail::sequential_find_if<ExPolicy>(first, last,
+                           std::forward<F>(f),
+                           std::forward<Proj>(proj)) == last;
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -308,7 +307,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if_not(
+                        return detail::sequential_find_if_not_helper(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
@@ -369,9 +368,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
-                           util::invoke_projected<F, Proj>(std::forward<F>(f),
-                               std::forward<Proj>(proj))) != last;
+                return detail::sequential_find_if<ExPolicy>(first, last,
+                           std::forward<F>(f),
+                           std::forward<Proj>(proj)) != last;
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -407,7 +406,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if(
+                        return detail::sequential_find_if_helper(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
@@ -468,7 +467,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if_not(first, last,
+                return detail::sequential_find_if_not<ExPolicy>(first, last,
                            std::forward<F>(f),
                            std::forward<Proj>(proj)) == last;
             }
@@ -506,7 +505,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::forward<ExPolicy>(policy), first,
                     detail::distance(first, last), std::move(f1),
                     [](std::vector<hpx::future<bool>>&& results) {
-                        return detail::sequential_find_if_not(
+                        return detail::sequential_find_if_not_helper(
                                    hpx::util::begin(results),
                                    hpx::util::end(results),
                                    [](hpx::future<bool>& val) {
@@ -0,0 +1,117 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_dispatch.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Our own version of the C++14 equal (_binary).
+    template <typename InIter1, typename Sent1, typename InIter2,
+        typename Sent2, typename F, typename Proj1, typename Proj2>
+    bool sequential_equal_binary_helper(InIter1 first1, Sent1 last1,
+        InIter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        for (/* */; first1 != last1 && first2 != last2;
+             (void) ++first1, ++first2)
+        {
+            if (!hpx::util::invoke(f, hpx::util::invoke(proj1, *first1),
+                    hpx::util::invoke(proj2, *first2)))
+                return false;
+        }
+        return first1 == last1 && first2 == last2;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized execution policies provide their own implementation of
+    // the equal algorithms (see datapar/equal.hpp).
+    template <typename ExPolicy>
+    struct sequential_equal_binary_t final
+      : hpx::functional::tag_fallback<sequential_equal_binary_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter1, typename Sent1, typename InIter2,
+            typename Sent2, typename F, typename Proj1, typename Proj2>
+        friend constexpr bool tag_fallback_dispatch(sequential_equal_binary_t,
+            InIter1 first1, Sent1 last1, InIter2 first2, Sent2 last2, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            return sequential_equal_binary_helper(first1, last1, first2, last2,
+                std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_equal_binary_t<ExPolicy>
+        sequential_equal_binary = sequential_equal_binary_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_equal_binary(
+        Args&&... args)
+    {
+        return sequential_equal_binary_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_equal_t final
+      : hpx::functional::tag_fallback<sequential_equal_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter1, typename InIter2, typename F>
+        friend constexpr bool tag_fallback_dispatch(sequential_equal_t,
+            InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
+        {
+            return std::equal(first1, last1, first2, std::forward<F>(f));
+        }
+
+        // run equal on a single partition, cancel the token if a mismatch
+        // was found
+        template <typename ZipIter, typename Token, typename F, typename Proj1,
+            typename Proj2>
+        friend constexpr void tag_fallback_dispatch(sequential_equal_t,
+            ZipIter it, std::size_t part_count, Token& tok, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            util::loop_n<ExPolicy>(it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](ZipIter const& curr) {
+                    typename ZipIter::reference t = *curr;
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel();
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_equal_t<ExPolicy>
+        sequential_equal = sequential_equal_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_equal(Args&&... args)
+    {
+        return sequential_equal_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -9,14 +9,19 @@
 
 #include <hpx/config.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_dispatch.hpp>
+#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 
+#include <cstddef>
+#include <utility>
+
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
     // provide implementation of std::find supporting iterators/sentinels
     template <typename Iterator, typename Sentinel, typename T,
         typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find(
+    inline constexpr Iterator sequential_find_helper(
         Iterator first, Sentinel last, T const& value, Proj proj = Proj())
     {
         for (; first != last; ++first)
@@ -32,7 +37,7 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     // provide implementation of std::find_if supporting iterators/sentinels
     template <typename Iterator, typename Sentinel, typename Pred,
         typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find_if(
+    inline constexpr Iterator sequential_find_if_helper(
         Iterator first, Sentinel last, Pred pred, Proj proj = Proj())
     {
         for (; first != last; ++first)
@@ -45,10 +50,10 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         return first;
     }
 
-    // provide implementation of std::find_if supporting iterators/sentinels
+    // provide implementation of std::find_if_not supporting iterators/sentinels
     template <typename Iterator, typename Sentinel, typename Pred,
         typename Proj = util::projection_identity>
-    inline constexpr Iterator sequential_find_if_not(
+    inline constexpr Iterator sequential_find_if_not_helper(
         Iterator first, Sentinel last, Pred pred, Proj proj = Proj())
     {
         for (; first != last; ++first)
@@ -60,4 +65,144 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         }
         return first;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized execution policies provide their own implementation of
+    // the find algorithms (see datapar/find.hpp).
+    template <typename ExPolicy>
+    struct sequential_find_t final
+      : hpx::functional::tag_fallback<sequential_find_t<ExPolicy>>
+    {
+    private:
+        template <typename Iterator, typename Sentinel, typename T,
+            typename Proj>
+        friend constexpr Iterator tag_fallback_dispatch(sequential_find_t,
+            Iterator first, Sentinel last, T const& value, Proj&& proj)
+        {
+            return sequential_find_helper(
+                first, last, value, std::forward<Proj>(proj));
+        }
+
+        // run find on a single partition, cancel the token at the index of
+        // the first match
+        template <typename FwdIter, typename Token, typename T, typename Proj>
+        friend constexpr void tag_fallback_dispatch(sequential_find_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, T const& value, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&value, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(proj, v) == value)
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_t<ExPolicy> sequential_find =
+        sequential_find_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find(Args&&... args)
+    {
+        return sequential_find_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_find_if_t final
+      : hpx::functional::tag_fallback<sequential_find_if_t<ExPolicy>>
+    {
+    private:
+        template <typename Iterator, typename Sentinel, typename Pred,
+            typename Proj>
+        friend constexpr Iterator tag_fallback_dispatch(sequential_find_if_t,
+            Iterator first, Sentinel last, Pred&& pred, Proj&& proj)
+        {
+            return sequential_find_if_helper(first, last,
+                std::forward<Pred>(pred), std::forward<Proj>(proj));
+        }
+
+        // run find_if on a single partition, cancel the token at the index
+        // of the first match
+        template <typename FwdIter, typename Token, typename Pred,
+            typename Proj>
+        friend constexpr void tag_fallback_dispatch(sequential_find_if_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, Pred&& pred, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&pred, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(
+                            pred, hpx::util::invoke(proj, v)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_if_t<ExPolicy>
+        sequential_find_if = sequential_find_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find_if(Args&&... args)
+    {
+        return sequential_find_if_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_find_if_not_t final
+      : hpx::functional::tag_fallback<sequential_find_if_not_t<ExPolicy>>
+    {
+    private:
+        template <typename Iterator, typename Sentinel, typename Pred,
+            typename Proj>
+        friend constexpr Iterator tag_fallback_dispatch(
+            sequential_find_if_not_t, Iterator first, Sentinel last,
+            Pred&& pred, Proj&& proj)
+        {
+            return sequential_find_if_not_helper(first, last,
+                std::forward<Pred>(pred), std::forward<Proj>(proj));
+        }
+
+        // run find_if_not on a single partition, cancel the token at the
+        // index of the first match
+        template <typename FwdIter, typename Token, typename Pred,
+            typename Proj>
+        friend constexpr void tag_fallback_dispatch(sequential_find_if_not_t,
+            std::size_t base_idx, FwdIter part_begin, std::size_t part_count,
+            Token& tok, Pred&& pred, Proj&& proj)
+        {
+            util::loop_idx_n(base_idx, part_begin, part_count, tok,
+                [&pred, &proj, &tok](auto& v, std::size_t i) -> void {
+                    if (!hpx::util::invoke(
+                            pred, hpx::util::invoke(proj, v)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_find_if_not_t<ExPolicy>
+        sequential_find_if_not = sequential_find_if_not_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_find_if_not(Args&&... args)
+    {
+        return sequential_find_if_not_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
 }}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,703 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // The in-place parallel sample sort implemented here follows the
+    // structure of IPS4o (In-place Parallel Super Scalar Samplesort, Axtmann
+    // et al.). Each partitioning step distributes the elements into up to
+    // 2^max_log_buckets buckets (plus one bucket for each splitter if the
+    // input has many duplicates):
+    //
+    //  - the splitters are selected from a random sample and stored as an
+    //    implicit binary search tree which allows for classifying an element
+    //    without any data dependent branches,
+    //  - every worker classifies the elements of its stripe of the input into
+    //    small local buffers, full buffers are written back as blocks to the
+    //    beginning of the stripe,
+    //  - all workers cooperatively permute the blocks such that each bucket
+    //    occupies a contiguous range of blocks,
+    //  - the elements left in the local buffers are moved to the (partial)
+    //    blocks at the boundaries of the buckets.
+    //
+    // Apart from the local buffers (a couple of blocks per bucket and worker)
+    // no additional memory is needed. The buckets are sorted recursively.
+
+    // size of the blocks the elements are moved in (in bytes)
+    static constexpr std::size_t in_place_sample_sort_block_bytes = 2048;
+
+    // maximal number of buckets (excluding the buckets holding elements
+    // equal to a splitter) is 2^in_place_sample_sort_max_log_buckets
+    static constexpr std::size_t in_place_sample_sort_max_log_buckets = 8;
+
+    // maximal recursion depth before falling back to std::sort
+    static constexpr std::size_t in_place_sample_sort_max_depth = 16;
+
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    class in_place_sample_sort_helper
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using buffer_type = std::vector<value_type>;
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        // block positions are stored as block indices relative to first_
+        struct bucket_pointers
+        {
+            mutex_type mtx_;
+            std::size_t write_ = 0;    // next block to write
+            std::size_t read_ = 0;     // one past the last unread block
+            std::atomic<std::size_t> num_reading_{0};
+        };
+
+        struct local_data
+        {
+            std::vector<buffer_type> buffers_;
+            std::vector<std::size_t> counts_;
+            std::size_t full_blocks_end_ = 0;
+            buffer_type swap_[2];
+        };
+
+    public:
+        in_place_sample_sort_helper(ExPolicy const& policy, RandomIt first,
+            RandomIt last, Comp const& comp, std::size_t num_workers)
+          : policy_(policy)
+          , first_(first)
+          , size_(std::size_t(last - first))
+          , comp_(comp)
+          , block_size_((std::max)(std::size_t(1),
+                in_place_sample_sort_block_bytes / sizeof(value_type)))
+          , num_workers_(num_workers)
+          , log_buckets_(0)
+          , num_buckets_(0)
+          , equal_buckets_(false)
+        {
+        }
+
+        // Partition the range into buckets, returns false if this was not
+        // possible.
+        bool partition()
+        {
+            if (!select_splitters())
+            {
+                return false;
+            }
+
+            local_.resize(num_workers_);
+            run_parallel(num_workers_,
+                [this](std::size_t worker) { classify_locally(worker); });
+
+            compute_bucket_boundaries();
+
+            run_parallel(num_workers_,
+                [this](std::size_t worker) { move_empty_blocks(worker); });
+
+            run_parallel(num_workers_,
+                [this](std::size_t worker) { permute_blocks(worker); });
+
+            save_overflow();
+
+            run_parallel(num_workers_,
+                [this](std::size_t worker) { cleanup(worker); });
+
+            return true;
+        }
+
+        std::size_t num_buckets() const
+        {
+            return num_buckets_;
+        }
+
+        std::size_t bucket_begin(std::size_t bucket) const
+        {
+            return bucket_starts_[bucket];
+        }
+
+        std::size_t bucket_end(std::size_t bucket) const
+        {
+            return bucket_starts_[bucket + 1];
+        }
+
+        // buckets holding elements equal to a splitter are already sorted
+        bool is_equal_bucket(std::size_t bucket) const
+        {
+            return equal_buckets_ && (bucket % 2) != 0;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F>
+        void run_parallel(std::size_t num_tasks, F&& f)
+        {
+            std::vector<hpx::future<void>> workitems;
+            workitems.reserve(num_tasks);
+            for (std::size_t i = 0; i != num_tasks; ++i)
+            {
+                workitems.push_back(
+                    execution::async_execute(policy_.executor(), f, i));
+            }
+
+            hpx::wait_all(workitems);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Draw a random sample, move it to the beginning of the range, and
+        // select the splitters from it. The splitters are stored as an
+        // implicit binary search tree.
+        bool select_splitters()
+        {
+            std::size_t log_size = 0;
+            while ((size_ >> log_size) > 1)
+            {
+                ++log_size;
+            }
+
+            // use less buckets for small ranges to keep the buckets larger
+            // than a couple of blocks
+            std::size_t log_buckets = 0;
+            while (log_buckets < in_place_sample_sort_max_log_buckets &&
+                (size_ >> (log_buckets + 1)) >= 4 * block_size_)
+            {
+                ++log_buckets;
+            }
+            if (log_buckets == 0)
+            {
+                return false;
+            }
+
+            std::size_t const num_buckets = std::size_t(1) << log_buckets;
+            std::size_t const oversampling =
+                (std::max)(std::size_t(1), log_size / 5);
+            std::size_t const sample_size =
+                (std::min)(oversampling * num_buckets - 1, size_);
+
+            std::mt19937_64 gen(size_);
+            for (std::size_t i = 0; i != sample_size; ++i)
+            {
+                std::uniform_int_distribution<std::size_t> dist(i, size_ - 1);
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(first_ + i, first_ + dist(gen));
+#else
+                std::iter_swap(first_ + i, first_ + dist(gen));
+#endif
+            }
+            std::sort(first_, first_ + sample_size, comp_);
+
+            // pick equidistant splitters, skipping duplicates
+            std::vector<value_type> splitters;
+            splitters.reserve(num_buckets - 1);
+            for (std::size_t i = oversampling - 1; i < sample_size;
+                 i += oversampling)
+            {
+                if (!splitters.empty() &&
+                    !HPX_INVOKE(comp_, splitters.back(), first_[i]))
+                {
+                    equal_buckets_ = true;
+                    continue;
+                }
+                splitters.push_back(first_[i]);
+            }
+            HPX_ASSERT(!splitters.empty());
+
+            // reduce the number of buckets if there are only few distinct
+            // splitters, pad the remaining slots with the largest splitter
+            log_buckets_ = 1;
+            while ((std::size_t(1) << log_buckets_) <= splitters.size())
+            {
+                ++log_buckets_;
+            }
+
+            std::size_t const num_tree_buckets = std::size_t(1) << log_buckets_;
+            while (splitters.size() != num_tree_buckets - 1)
+            {
+                splitters.push_back(splitters.back());
+            }
+
+            tree_.clear();
+            tree_.reserve(num_tree_buckets);
+            tree_.push_back(splitters.front());    // unused slot
+            for (std::size_t i = 1; i != num_tree_buckets; ++i)
+            {
+                tree_.push_back(splitters.front());
+            }
+            build_tree(splitters, 1, 0, splitters.size());
+
+            sorted_splitters_ = std::move(splitters);
+            num_buckets_ =
+                equal_buckets_ ? 2 * num_tree_buckets - 1 : num_tree_buckets;
+
+            return true;
+        }
+
+        void build_tree(std::vector<value_type> const& splitters,
+            std::size_t pos, std::size_t lo, std::size_t hi)
+        {
+            if (lo == hi)
+            {
+                return;
+            }
+
+            std::size_t const mid = lo + (hi - lo) / 2;
+            tree_[pos] = splitters[mid];
+            build_tree(splitters, 2 * pos, lo, mid);
+            build_tree(splitters, 2 * pos + 1, mid + 1, hi);
+        }
+
+        // Return the bucket the given element belongs to. The descent through
+        // the splitter tree has no data dependent branches.
+        std::size_t classify(value_type const& value) const
+        {
+            std::size_t b = 1;
+            for (std::size_t l = 0; l != log_buckets_; ++l)
+            {
+                b = 2 * b + std::size_t(HPX_INVOKE(comp_, tree_[b], value));
+            }
+            b -= std::size_t(1) << log_buckets_;
+
+            if (equal_buckets_)
+            {
+                // value <= sorted_splitters_[b] holds at this point
+                b = 2 * b +
+                    std::size_t(b < sorted_splitters_.size() &&
+                        !HPX_INVOKE(comp_, value, sorted_splitters_[b]));
+            }
+            return b;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the stripes are made up of complete blocks, the last stripe holds
+        // the remaining elements
+        std::size_t stripe_begin(std::size_t worker) const
+        {
+            std::size_t const num_blocks = size_ / block_size_;
+            return (worker * num_blocks / num_workers_) * block_size_;
+        }
+
+        std::size_t stripe_end(std::size_t worker) const
+        {
+            return worker + 1 == num_workers_ ? size_ :
+                                                stripe_begin(worker + 1);
+        }
+
+        // Classify all elements of the stripe of the given worker, full
+        // buffers are written back to the beginning of the stripe.
+        void classify_locally(std::size_t worker)
+        {
+            local_data& local = local_[worker];
+            local.buffers_.resize(num_buckets_);
+            local.counts_.assign(num_buckets_, 0);
+
+            RandomIt write = first_ + stripe_begin(worker);
+            RandomIt const end = first_ + stripe_end(worker);
+            for (RandomIt it = write; it != end; ++it)
+            {
+                std::size_t const bucket = classify(*it);
+                ++local.counts_[bucket];
+
+                buffer_type& buffer = local.buffers_[bucket];
+                if (buffer.capacity() == 0)
+                {
+                    buffer.reserve(block_size_);
+                }
+
+                buffer.push_back(std::move(*it));
+                if (buffer.size() == block_size_)
+                {
+                    write = std::move(buffer.begin(), buffer.end(), write);
+                    buffer.clear();
+                }
+            }
+
+            local.full_blocks_end_ = std::size_t(write - first_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void compute_bucket_boundaries()
+        {
+            bucket_starts_.assign(num_buckets_ + 1, 0);
+            for (std::size_t bucket = 0; bucket != num_buckets_; ++bucket)
+            {
+                std::size_t count = 0;
+                for (local_data const& local : local_)
+                {
+                    count += local.counts_[bucket];
+                }
+                bucket_starts_[bucket + 1] = bucket_starts_[bucket] + count;
+            }
+            HPX_ASSERT(bucket_starts_.back() == size_);
+
+            buckets_.reset(new bucket_pointers[num_buckets_]);
+        }
+
+        // first block of the (block aligned) area of the given bucket
+        std::size_t first_block(std::size_t bucket) const
+        {
+            return (bucket_starts_[bucket] + block_size_ - 1) / block_size_;
+        }
+
+        // Return whether the given block was filled during the local
+        // classification.
+        bool is_full_block(std::size_t block) const
+        {
+            std::size_t const pos = block * block_size_;
+            if (pos + block_size_ > size_)
+            {
+                return false;
+            }
+
+            std::size_t worker = num_workers_ - 1;
+            while (stripe_begin(worker) > pos)
+            {
+                --worker;
+            }
+            return pos < local_[worker].full_blocks_end_;
+        }
+
+        // Move the full blocks inside the area of each bucket to the
+        // beginning of the area. Each worker handles a range of buckets.
+        void move_empty_blocks(std::size_t worker)
+        {
+            std::size_t const begin = worker * num_buckets_ / num_workers_;
+            std::size_t const end = (worker + 1) * num_buckets_ / num_workers_;
+
+            for (std::size_t bucket = begin; bucket != end; ++bucket)
+            {
+                std::size_t const area_begin = first_block(bucket);
+                std::size_t lo = area_begin;
+                std::size_t hi = first_block(bucket + 1);
+
+                while (true)
+                {
+                    while (lo < hi && is_full_block(lo))
+                    {
+                        ++lo;
+                    }
+                    while (lo < hi && !is_full_block(hi - 1))
+                    {
+                        --hi;
+                    }
+                    if (lo >= hi)
+                    {
+                        break;
+                    }
+
+                    --hi;
+                    std::move(first_ + hi * block_size_,
+                        first_ + (hi + 1) * block_size_,
+                        first_ + lo * block_size_);
+                    ++lo;
+                }
+
+                buckets_[bucket].write_ = area_begin;
+                buckets_[bucket].read_ = lo;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Claim the last unread block of the given bucket
+        bool claim_read(std::size_t bucket, std::size_t& block)
+        {
+            bucket_pointers& p = buckets_[bucket];
+
+            std::lock_guard<mutex_type> l(p.mtx_);
+            if (p.read_ <= p.write_)
+            {
+                return false;
+            }
+
+            block = --p.read_;
+            ++p.num_reading_;
+            return true;
+        }
+
+        void read_block(std::size_t block, buffer_type& buffer)
+        {
+            RandomIt it = first_ + block * block_size_;
+            buffer.assign(std::make_move_iterator(it),
+                std::make_move_iterator(it + block_size_));
+        }
+
+        void write_block(std::size_t block, buffer_type& buffer)
+        {
+            std::size_t const pos = block * block_size_;
+            if (pos + block_size_ > size_)
+            {
+                // the last block of the range may extend beyond its end
+                HPX_ASSERT(overflow_.empty());
+                overflow_ = std::move(buffer);
+                buffer = buffer_type();
+                buffer.reserve(block_size_);
+                return;
+            }
+            std::move(buffer.begin(), buffer.end(), first_ + pos);
+        }
+
+        // Cooperatively permute the blocks such that the blocks of each
+        // bucket are stored in the area of the bucket.
+        void permute_blocks(std::size_t worker)
+        {
+            local_data& local = local_[worker];
+            local.swap_[0].reserve(block_size_);
+            local.swap_[1].reserve(block_size_);
+
+            std::size_t const start = worker * num_buckets_ / num_workers_;
+            for (std::size_t i = 0; i != num_buckets_; ++i)
+            {
+                std::size_t const primary = (start + i) % num_buckets_;
+
+                std::size_t block = 0;
+                while (claim_read(primary, block))
+                {
+                    read_block(block, local.swap_[0]);
+                    --buckets_[primary].num_reading_;
+
+                    std::size_t current = 0;
+                    while (true)
+                    {
+                        std::size_t const dest =
+                            classify(local.swap_[current].front());
+                        bucket_pointers& p = buckets_[dest];
+
+                        std::size_t write = 0;
+                        std::size_t read = 0;
+                        {
+                            std::lock_guard<mutex_type> l(p.mtx_);
+                            write = p.write_++;
+                            read = p.read_;
+                        }
+
+                        if (write < read)
+                        {
+                            // the target block has not been read yet, swap it
+                            read_block(write, local.swap_[1 - current]);
+                            write_block(write, local.swap_[current]);
+                            current = 1 - current;
+                            continue;
+                        }
+
+                        // the target block may still be read by another
+                        // worker
+                        hpx::util::yield_while(
+                            [&p]() { return p.num_reading_.load() != 0; });
+
+                        write_block(write, local.swap_[current]);
+                        break;
+                    }
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        value_type& element(std::size_t pos)
+        {
+            std::size_t const overflow_begin =
+                (size_ / block_size_) * block_size_;
+            if (!overflow_.empty() && pos >= overflow_begin)
+            {
+                return overflow_[pos - overflow_begin];
+            }
+            return first_[pos];
+        }
+
+        // The blocks of a bucket may extend into the area of the next bucket.
+        // Save these elements (and the elements of the block written beyond
+        // the end of the range) before the buckets are completed.
+        void save_overflow()
+        {
+            saved_.resize(num_buckets_);
+
+            std::size_t const overflow_begin =
+                (size_ / block_size_) * block_size_;
+
+            for (std::size_t bucket = 0; bucket != num_buckets_; ++bucket)
+            {
+                std::size_t const area_begin = first_block(bucket) * block_size_;
+                std::size_t const blocks_end =
+                    buckets_[bucket].write_ * block_size_;
+                std::size_t const end = bucket_end(bucket);
+
+                if (blocks_end <= area_begin)
+                {
+                    continue;
+                }
+
+                if (!overflow_.empty() && blocks_end > size_)
+                {
+                    for (std::size_t pos = overflow_begin;
+                         pos < (std::min)(end, size_); ++pos)
+                    {
+                        first_[pos] = std::move(element(pos));
+                    }
+                }
+
+                for (std::size_t pos = (std::max)(end, area_begin);
+                     pos < blocks_end; ++pos)
+                {
+                    saved_[bucket].push_back(std::move(element(pos)));
+                }
+            }
+        }
+
+        // Fill the gaps at the beginning and the end of each bucket from the
+        // saved elements and the local buffers.
+        void cleanup(std::size_t worker)
+        {
+            std::size_t const begin = worker * num_buckets_ / num_workers_;
+            std::size_t const end = (worker + 1) * num_buckets_ / num_workers_;
+
+            for (std::size_t bucket = begin; bucket != end; ++bucket)
+            {
+                std::size_t const bucket_first = bucket_begin(bucket);
+                std::size_t const bucket_last = bucket_end(bucket);
+                std::size_t const area_begin = (std::min)(
+                    first_block(bucket) * block_size_, bucket_last);
+                std::size_t const blocks_end = (std::max)(area_begin,
+                    (std::min)(
+                        buckets_[bucket].write_ * block_size_, bucket_last));
+
+                RandomIt head = first_ + bucket_first;
+                RandomIt const head_end = first_ + area_begin;
+                RandomIt tail = first_ + blocks_end;
+
+                auto fill = [&](buffer_type& buffer) {
+                    for (value_type& value : buffer)
+                    {
+                        if (head != head_end)
+                        {
+                            *head++ = std::move(value);
+                        }
+                        else
+                        {
+                            *tail++ = std::move(value);
+                        }
+                    }
+                    buffer_type().swap(buffer);
+                };
+
+                fill(saved_[bucket]);
+                for (local_data& local : local_)
+                {
+                    fill(local.buffers_[bucket]);
+                }
+
+                HPX_ASSERT(head == head_end);
+                HPX_ASSERT(tail == first_ + bucket_last);
+            }
+        }
+
+    private:
+        ExPolicy policy_;
+        RandomIt first_;
+        std::size_t size_;
+        Comp comp_;
+        std::size_t const block_size_;
+        std::size_t const num_workers_;
+
+        std::size_t log_buckets_;
+        std::size_t num_buckets_;
+        bool equal_buckets_;
+        std::vector<value_type> tree_;
+        std::vector<value_type> sorted_splitters_;
+
+        std::vector<local_data> local_;
+        std::vector<std::size_t> bucket_starts_;
+        std::unique_ptr<bucket_pointers[]> buckets_;
+        buffer_type overflow_;
+        std::vector<buffer_type> saved_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sort the range [first, last) using an in-place parallel sample sort
+    /// employing up to \a num_workers tasks. Buckets smaller than
+    /// \a chunk_size elements are sorted sequentially.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    void in_place_sample_sort(ExPolicy const& policy, RandomIt first,
+        RandomIt last, Comp const& comp, std::size_t num_workers,
+        std::size_t chunk_size,
+        std::size_t depth = in_place_sample_sort_max_depth)
+    {
+        std::size_t const size = std::size_t(last - first);
+        num_workers = (std::min)(num_workers, size / (std::max)(chunk_size,
+                                                         std::size_t(1)));
+
+        if (num_workers <= 1 || depth == 0)
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        in_place_sample_sort_helper<ExPolicy, RandomIt, Comp> helper(
+            policy, first, last, comp, num_workers);
+        if (!helper.partition())
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        // sort the buckets, large buckets are sorted in parallel using a
+        // share of the workers proportional to their size
+        std::vector<hpx::future<void>> workitems;
+        workitems.reserve(helper.num_buckets());
+        for (std::size_t bucket = 0; bucket != helper.num_buckets(); ++bucket)
+        {
+            std::size_t const bucket_size =
+                helper.bucket_end(bucket) - helper.bucket_begin(bucket);
+            if (bucket_size <= 1 || helper.is_equal_bucket(bucket))
+            {
+                continue;
+            }
+
+            std::size_t const bucket_workers = num_workers * bucket_size / size;
+
+            RandomIt bucket_first = first + helper.bucket_begin(bucket);
+            RandomIt bucket_last = first + helper.bucket_end(bucket);
+            workitems.push_back(execution::async_execute(policy.executor(),
+                [=, &policy, &comp]() {
+                    in_place_sample_sort(policy, bucket_first, bucket_last,
+                        comp, bucket_workers, chunk_size, depth - 1);
+                }));
+        }
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,197 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_dispatch.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the smallest element of a single partition. The vectorized
+    // execution policies provide their own implementation of the min/max
+    // searches (see datapar/minmax.hpp).
+    template <typename ExPolicy>
+    struct sequential_min_element_t final
+      : hpx::functional::tag_fallback<sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_dispatch(
+            sequential_min_element_t, FwdIter first, FwdIter last, F&& f,
+            Proj&& proj)
+        {
+            return std::min_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_dispatch(
+            sequential_min_element_t, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter smallest = it;
+            auto value = HPX_INVOKE(proj, *smallest);
+
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                auto curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, value))
+                {
+                    smallest = it;
+                    value = std::move(curr_value);
+                }
+            }
+
+            return smallest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_min_element_t<ExPolicy>
+        sequential_min_element = sequential_min_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_min_element(
+        Args&&... args)
+    {
+        return sequential_min_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the largest element of a single partition.
+    template <typename ExPolicy>
+    struct sequential_max_element_t final
+      : hpx::functional::tag_fallback<sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_dispatch(
+            sequential_max_element_t, FwdIter first, FwdIter last, F&& f,
+            Proj&& proj)
+        {
+            return std::max_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_dispatch(
+            sequential_max_element_t, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            FwdIter greatest = it;
+            auto value = HPX_INVOKE(proj, *greatest);
+
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                auto curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, value, curr_value))
+                {
+                    greatest = it;
+                    value = std::move(curr_value);
+                }
+            }
+
+            return greatest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_max_element_t<ExPolicy>
+        sequential_max_element = sequential_max_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_max_element(
+        Args&&... args)
+    {
+        return sequential_max_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the smallest and the largest element of a single partition.
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t final
+      : hpx::functional::tag_fallback<sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr std::pair<FwdIter, FwdIter> tag_fallback_dispatch(
+            sequential_minmax_element_t, FwdIter first, FwdIter last, F&& f,
+            Proj&& proj)
+        {
+            return std::minmax_element(first, last,
+                util::compare_projected<F, Proj>(
+                    std::forward<F>(f), std::forward<Proj>(proj)));
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr std::pair<FwdIter, FwdIter> tag_fallback_dispatch(
+            sequential_minmax_element_t, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            std::pair<FwdIter, FwdIter> result(it, it);
+
+            if (count == 0 || count == 1)
+                return result;
+
+            auto min_value = HPX_INVOKE(proj, *it);
+            auto max_value = min_value;
+
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                auto curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.first = it;
+                    min_value = curr_value;
+                }
+
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.second = it;
+                    max_value = std::move(curr_value);
+                }
+            }
+
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_minmax_element(
+        Args&&... args)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
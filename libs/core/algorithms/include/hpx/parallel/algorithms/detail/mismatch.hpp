@@ -0,0 +1,120 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_dispatch.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+        typename F, typename Proj1, typename Proj2>
+    constexpr util::in_in_result<Iter1, Iter2>
+    sequential_mismatch_binary_helper(Iter1 first1, Sent1 last1, Iter2 first2,
+        Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        while (first1 != last1 && first2 != last2 &&
+            HPX_INVOKE(
+                f, HPX_INVOKE(proj1, *first1), HPX_INVOKE(proj2, *first2)))
+        {
+            (void) ++first1, ++first2;
+        }
+        return {first1, first2};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized execution policies provide their own implementation of
+    // the mismatch algorithms (see datapar/mismatch.hpp).
+    template <typename ExPolicy>
+    struct sequential_mismatch_binary_t final
+      : hpx::functional::tag_fallback<sequential_mismatch_binary_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename F, typename Proj1, typename Proj2>
+        friend constexpr util::in_in_result<Iter1, Iter2>
+        tag_fallback_dispatch(sequential_mismatch_binary_t, Iter1 first1,
+            Sent1 last1, Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1,
+            Proj2&& proj2)
+        {
+            return sequential_mismatch_binary_helper(first1, last1, first2,
+                last2, std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_mismatch_binary_t<ExPolicy>
+        sequential_mismatch_binary = sequential_mismatch_binary_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_mismatch_binary(
+        Args&&... args)
+    {
+        return sequential_mismatch_binary_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_mismatch_t final
+      : hpx::functional::tag_fallback<sequential_mismatch_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Sent, typename Iter2, typename F>
+        friend constexpr std::pair<Iter1, Iter2> tag_fallback_dispatch(
+            sequential_mismatch_t, Iter1 first1, Sent last1, Iter2 first2,
+            F&& f)
+        {
+            while (first1 != last1 && HPX_INVOKE(f, *first1, *first2))
+            {
+                (void) ++first1, ++first2;
+            }
+            return std::make_pair(first1, first2);
+        }
+
+        // run mismatch on a single partition, cancel the token at the index
+        // of the first mismatch
+        template <typename ZipIter, typename Token, typename F, typename Proj1,
+            typename Proj2>
+        friend constexpr void tag_fallback_dispatch(sequential_mismatch_t,
+            std::size_t base_idx, ZipIter it, std::size_t part_count,
+            Token& tok, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&](typename ZipIter::reference t, std::size_t i) {
+                    if (!HPX_INVOKE(f, HPX_INVOKE(proj1, hpx::get<0>(t)),
+                            HPX_INVOKE(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_mismatch_t<ExPolicy>
+        sequential_mismatch = sequential_mismatch_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_mismatch(Args&&... args)
+    {
+        return sequential_mismatch_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,353 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map arithmetic keys onto unsigned integers such that the order of the
+    // integers matches the order of the keys.
+    template <typename Key, typename Enable = void>
+    struct radix_sort_key
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename Key>
+    struct radix_sort_key<Key,
+        std::enable_if_t<std::is_integral_v<Key> &&
+            (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 ||
+                sizeof(Key) == 8)>>
+    {
+        static constexpr bool value = true;
+
+        using type = std::make_unsigned_t<std::conditional_t<
+            std::is_same_v<Key, bool>, unsigned char, Key>>;
+
+        static constexpr type call(Key key) noexcept
+        {
+            if constexpr (std::is_signed_v<Key>)
+            {
+                // flip the sign bit to order negative before positive values
+                return type(key) ^
+                    (type(1) << (sizeof(type) * CHAR_BIT - 1));
+            }
+            else
+            {
+                return type(key);
+            }
+        }
+    };
+
+    template <typename Key>
+    struct radix_sort_key<Key,
+        std::enable_if_t<std::is_floating_point_v<Key> &&
+            std::numeric_limits<Key>::is_iec559 &&
+            (sizeof(Key) == 4 || sizeof(Key) == 8)>>
+    {
+        static constexpr bool value = true;
+
+        using type =
+            std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+
+        static type call(Key key) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+
+            // negative values are ordered in reverse, flip all bits for them,
+            // only the sign bit otherwise
+            type const sign = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort is used for the default comparison (ascending order) and
+    // the corresponding 'greater' comparison (descending order) only.
+    template <typename Compare, typename Key>
+    struct radix_sort_order
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<less, Key>
+    {
+        static constexpr bool value = true;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<>, Key>
+      : radix_sort_order<less, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<Key>, Key>
+      : radix_sort_order<less, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<greater, Key>
+    {
+        static constexpr bool value = true;
+        static constexpr bool descending = true;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<>, Key>
+      : radix_sort_order<greater, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<Key>, Key>
+      : radix_sort_order<greater, Key>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return whether the elements of the given range can be radix sorted
+    // when using the given comparison and projection.
+    template <typename RandomIt, typename Compare, typename Proj,
+        typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename RandomIt, typename Compare, typename Proj>
+    struct is_radix_sortable<RandomIt, Compare, Proj,
+        std::enable_if_t<hpx::is_invocable_v<Proj const&,
+            typename std::iterator_traits<RandomIt>::value_type&>>>
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using key_type = std::decay_t<hpx::util::invoke_result_t<Proj const&,
+            value_type&>>;
+
+        static constexpr bool value = radix_sort_key<key_type>::value &&
+            radix_sort_order<std::decay_t<Compare>, key_type>::value &&
+            std::is_default_constructible_v<value_type> &&
+            std::is_move_assignable_v<value_type>;
+    };
+
+    template <typename RandomIt, typename Compare, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        is_radix_sortable<RandomIt, Compare, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // number of bits sorted per pass
+    static constexpr std::size_t radix_sort_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = std::size_t(1)
+        << radix_sort_bits;
+
+    template <typename ExPolicy, typename RandomIt, typename Compare,
+        typename Proj>
+    class radix_sort_helper
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using key_type = typename is_radix_sortable<RandomIt, Compare,
+            Proj>::key_type;
+        using radix_key = radix_sort_key<key_type>;
+        using unsigned_key = typename radix_key::type;
+        using histogram = std::array<std::size_t, radix_sort_buckets>;
+
+        static constexpr bool descending =
+            radix_sort_order<std::decay_t<Compare>, key_type>::descending;
+
+    public:
+        radix_sort_helper(ExPolicy const& policy, RandomIt first,
+            RandomIt last, Proj const& proj, std::size_t num_workers)
+          : policy_(policy)
+          , first_(first)
+          , size_(std::size_t(last - first))
+          , proj_(proj)
+          , num_workers_(num_workers)
+          , histograms_(num_workers)
+        {
+        }
+
+        void sort()
+        {
+            std::vector<value_type> buffer(size_);
+
+            // sort by the least significant digit first, the data moves
+            // between the input range and the buffer in each pass
+            bool in_buffer = false;
+            for (std::size_t shift = 0; shift < sizeof(unsigned_key) * CHAR_BIT;
+                 shift += radix_sort_bits)
+            {
+                if (in_buffer)
+                {
+                    in_buffer = !pass(buffer.begin(), first_, shift);
+                }
+                else
+                {
+                    in_buffer = pass(first_, buffer.begin(), shift);
+                }
+            }
+
+            if (in_buffer)
+            {
+                run_parallel([&](std::size_t worker) {
+                    std::move(buffer.begin() + chunk_begin(worker),
+                        buffer.begin() + chunk_begin(worker + 1),
+                        first_ + chunk_begin(worker));
+                });
+            }
+        }
+
+    private:
+        template <typename F>
+        void run_parallel(F&& f)
+        {
+            std::vector<hpx::future<void>> workitems;
+            workitems.reserve(num_workers_);
+            for (std::size_t i = 0; i != num_workers_; ++i)
+            {
+                workitems.push_back(
+                    execution::async_execute(policy_.executor(), f, i));
+            }
+
+            hpx::wait_all(workitems);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+        }
+
+        std::size_t chunk_begin(std::size_t worker) const
+        {
+            return worker * size_ / num_workers_;
+        }
+
+        template <typename Iter>
+        std::size_t digit(Iter it, std::size_t shift) const
+        {
+            unsigned_key key = radix_key::call(HPX_INVOKE(proj_, *it));
+            if constexpr (descending)
+            {
+                key = unsigned_key(~key);
+            }
+            return std::size_t(key >> shift) & (radix_sort_buckets - 1);
+        }
+
+        // Distribute the elements from src to dest according to the digit at
+        // the given position. Returns false if all elements have the same
+        // digit, in which case nothing was moved.
+        template <typename SrcIter, typename DestIter>
+        bool pass(SrcIter src, DestIter dest, std::size_t shift)
+        {
+            // count the digits in the chunk of each worker
+            run_parallel([&](std::size_t worker) {
+                histogram& h = histograms_[worker];
+                h.fill(0);
+
+                SrcIter const end = src + chunk_begin(worker + 1);
+                for (SrcIter it = src + chunk_begin(worker); it != end; ++it)
+                {
+                    ++h[digit(it, shift)];
+                }
+            });
+
+            // compute the positions the workers start to write each digit to
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d != radix_sort_buckets; ++d)
+            {
+                std::size_t count = 0;
+                for (histogram& h : histograms_)
+                {
+                    std::size_t const c = h[d];
+                    h[d] = offset + count;
+                    count += c;
+                }
+
+                if (count == size_)
+                {
+                    return false;
+                }
+                offset += count;
+            }
+            HPX_ASSERT(offset == size_);
+
+            // move the elements, the order within each digit is preserved
+            run_parallel([&](std::size_t worker) {
+                histogram& h = histograms_[worker];
+
+                SrcIter const end = src + chunk_begin(worker + 1);
+                for (SrcIter it = src + chunk_begin(worker); it != end; ++it)
+                {
+                    *(dest + h[digit(it, shift)]++) = std::move(*it);
+                }
+            });
+
+            return true;
+        }
+
+    private:
+        ExPolicy policy_;
+        RandomIt first_;
+        std::size_t size_;
+        Proj proj_;
+        std::size_t const num_workers_;
+        std::vector<histogram> histograms_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sort the range [first, last) by the arithmetic keys returned by the
+    /// projection using a parallel (least significant digit first) radix
+    /// sort employing \a num_workers tasks. The comparison only selects the
+    /// order of the sorted range (see \a radix_sort_order).
+    template <typename ExPolicy, typename RandomIt, typename Compare,
+        typename Proj>
+    void parallel_radix_sort(ExPolicy const& policy, RandomIt first,
+        RandomIt last, Compare const&, Proj const& proj,
+        std::size_t num_workers)
+    {
+        static_assert(is_radix_sortable_v<RandomIt, Compare, Proj>,
+            "the elements have to be sortable by an arithmetic key");
+
+        if (last - first < 2)
+        {
+            return;
+        }
+
+        radix_sort_helper<ExPolicy, RandomIt, Compare, Proj>(
+            policy, first, last, proj, (std::max)(num_workers, std::size_t(1)))
+            .sort();
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
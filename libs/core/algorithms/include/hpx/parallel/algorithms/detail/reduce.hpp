@@ -0,0 +1,86 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_dispatch.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/accumulate.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequentially reduce the given range, this is used to run reduce and
+    // transform_reduce on a single partition. The vectorized execution
+    // policies provide their own implementation (see datapar/reduce.hpp).
+    template <typename ExPolicy>
+    struct sequential_reduce_t final
+      : hpx::functional::tag_fallback<sequential_reduce_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Sent, typename T, typename Reduce,
+            typename U = std::enable_if_t<
+                hpx::traits::is_sentinel_for<Sent, Iter>::value>>
+        friend constexpr T tag_fallback_dispatch(sequential_reduce_t,
+            Iter first, Sent last, T init, Reduce&& r)
+        {
+            return detail::accumulate(
+                first, last, std::move(init), std::forward<Reduce>(r));
+        }
+
+        template <typename Iter, typename T, typename Reduce>
+        friend constexpr T tag_fallback_dispatch(sequential_reduce_t, Iter it,
+            std::size_t count, T init, Reduce&& r)
+        {
+            return util::accumulate_n(
+                it, count, std::move(init), std::forward<Reduce>(r));
+        }
+
+        template <typename Iter, typename Sent, typename T, typename Reduce,
+            typename Convert,
+            typename U = std::enable_if_t<
+                hpx::traits::is_sentinel_for<Sent, Iter>::value>>
+        friend constexpr T tag_fallback_dispatch(sequential_reduce_t,
+            Iter first, Sent last, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; first != last; ++first)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        friend constexpr T tag_fallback_dispatch(sequential_reduce_t, Iter it,
+            std::size_t count, T init, Reduce&& r, Convert&& conv)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *it));
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    HPX_INLINE_CONSTEXPR_VARIABLE sequential_reduce_t<ExPolicy>
+        sequential_reduce = sequential_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_reduce(Args&&... args)
+    {
+        return sequential_reduce_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
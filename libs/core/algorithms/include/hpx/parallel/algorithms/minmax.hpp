@@ -21,6 +21,7 @@
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -40,30 +41,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            FwdIter smallest = it;
-
-            util::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &smallest, &proj, value = HPX_INVOKE(proj, *smallest)](
-                    FwdIter const& curr) mutable -> void {
-                    auto curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = std::move(curr_value);
-                    }
-                });
-
-            return smallest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public detail::algorithm<min_element<Iter>, Iter>
@@ -107,9 +84,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static FwdIter sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::min_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_min_element<ExPolicy>(
+                    first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -125,10 +101,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         FwdIter>::get(std::move(first));
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_min_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_min_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = std::forward<F>(f),
                               proj = std::forward<Proj>(proj)](
@@ -257,30 +233,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // max_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            FwdIter greatest = it;
-
-            util::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &greatest, &proj, value = HPX_INVOKE(proj, *greatest)](
-                    FwdIter const& curr) mutable -> void {
-                    auto curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, value, curr_value))
-                    {
-                        greatest = curr;
-                        value = std::move(curr_value);
-                    }
-                });
-
-            return greatest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public detail::algorithm<max_element<Iter>, Iter>
@@ -324,9 +276,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static FwdIter sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::max_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_max_element<ExPolicy>(
+                    first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -342,10 +293,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         FwdIter>::get(std::move(first));
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_max_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_max_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 = [policy, f = std::forward<F>(f),
                               proj = std::forward<Proj>(proj)](
@@ -475,37 +426,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // minmax_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            std::pair<FwdIter, FwdIter> result(it, it);
-
-            if (count == 0 || count == 1)
-                return result;
-
-            auto value = HPX_INVOKE(proj, *it);
-            util::loop_n<std::decay_t<ExPolicy>>(++it, count - 1,
-                [&f, &result, &proj, min_value = value, max_value = value](
-                    FwdIter const& curr) mutable -> void {
-                    auto curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.first = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.second = curr;
-                        max_value = std::move(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -559,9 +479,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static std::pair<FwdIter, FwdIter> sequential(
                 ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::minmax_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_minmax_element<ExPolicy>(
+                    first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -580,11 +499,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         result_type>::get(std::move(result));
                 }
 
-                auto f1 =
-                    [f, proj, policy](FwdIter it,
-                        std::size_t part_count) -> std::pair<FwdIter, FwdIter> {
-                    return sequential_minmax_element(
-                        policy, it, part_count, f, proj);
+                auto f1 = [f, proj](FwdIter it, std::size_t part_count)
+                    -> std::pair<FwdIter, FwdIter> {
+                    return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
                 auto f2 =
                     [policy, f = std::forward<F>(f),
@@ -181,9 +181,11 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -199,22 +201,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // mismatch (binary)
     namespace detail {
 
-        ///////////////////////////////////////////////////////////////////////
-        template <typename Iter1, typename Sent1, typename Iter2,
-            typename Sent2, typename F, typename Proj1, typename Proj2>
-        constexpr util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
-            Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
-            Proj1&& proj1, Proj2&& proj2)
-        {
-            while (first1 != last1 && first2 != last2 &&
-                HPX_INVOKE(
-                    f, HPX_INVOKE(proj1, *first1), HPX_INVOKE(proj2, *first2)))
-            {
-                (void) ++first1, ++first2;
-            }
-            return {first1, first2};
-        }
-
         template <typename IterPair>
         struct mismatch_binary
           : public detail::algorithm<mismatch_binary<IterPair>, IterPair>
@@ -231,9 +217,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2,
                 F&& f, Proj1&& proj1, Proj2&& proj2)
             {
-                return sequential_mismatch_binary(first1, last1, first2, last2,
-                    std::forward<F>(f), std::forward<Proj1>(proj1),
-                    std::forward<Proj2>(proj2));
+                return sequential_mismatch_binary<ExPolicy>(first1, last1,
+                    first2, last2, std::forward<F>(f),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
             }
 
             template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -273,7 +259,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 using zip_iterator = hpx::util::zip_iterator<Iter1, Iter2>;
-                using reference = typename zip_iterator::reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
@@ -282,15 +267,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&](reference t, std::size_t i) {
-                            if (!HPX_INVOKE(f,
-                                    HPX_INVOKE(proj1, hpx::get<0>(t)),
-                                    HPX_INVOKE(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_count, tok, f, proj1, proj2);
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&& data) mutable
@@ -394,11 +372,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static constexpr IterPair sequential(
                 ExPolicy, InIter1 first1, Sent last1, InIter2 first2, F&& f)
             {
-                while (first1 != last1 && HPX_INVOKE(f, *first1, *first2))
-                {
-                    ++first1, ++first2;
-                }
-                return std::make_pair(first1, first2);
+                return sequential_mismatch<ExPolicy>(
+                    first1, last1, first2, std::forward<F>(f));
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -419,20 +394,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 using zip_iterator =
                     hpx::util::zip_iterator<FwdIter1, FwdIter2>;
-                using reference = typename zip_iterator::reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&](reference t, std::size_t i) {
-                            if (!HPX_INVOKE(f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch<std::decay_t<ExPolicy>>(base_idx, it,
+                        part_count, tok, f, util::projection_identity(),
+                        util::projection_identity());
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&& data) mutable
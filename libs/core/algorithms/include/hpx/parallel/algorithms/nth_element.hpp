@@ -0,0 +1,364 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam RandomIt    The type of the source begin, nth, and end
+    ///                     iterators used (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which is placed at its sorted
+    ///                     position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// The comparisons in the \a nth_element algorithm invoked without an
+    /// execution policy object execute in sequential order in the calling
+    /// thread.
+    ///
+    /// \returns  The \a nth_element algorithm does not return anything.
+    ///
+    template <typename RandomIt, typename Comp>
+    void nth_element(
+        RandomIt first, RandomIt nth, RandomIt last, Comp&& comp = Comp());
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source begin, nth, and end
+    ///                     iterators used (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a nth_element requires \a Comp to meet
+    ///                     the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which is placed at its sorted
+    ///                     position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// The comparisons in the parallel \a nth_element algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a nth_element algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns nothing otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    typename util::detail::algorithm_result<ExPolicy>::type nth_element(
+        ExPolicy&& policy, RandomIt first, RandomIt nth, RandomIt last,
+        Comp&& comp = Comp());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Introselect whose partitioning steps are executed in parallel.
+        /// Ranges smaller than sort_limit_per_task are handled sequentially,
+        /// as are ranges for which too many bad pivots were chosen.
+        ///
+        /// \param first : iterator to the first element
+        /// \param nth : iterator to the element to place at its position
+        /// \param last : iterator to the element after the end in the range
+        /// \param comp : object for to Comp elements
+        ///
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        void parallel_nth_element(ExPolicy&& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Comp&& comp)
+        {
+            std::uint32_t level = nbits64(last - first) * 2;
+            while (std::size_t(last - first) > sort_limit_per_task &&
+                level-- != 0)
+            {
+                // move the pivot to the front, it stays there while the
+                // remaining elements are partitioned
+                pivot9(first, last, comp);
+                auto const& pivot = *first;
+
+                RandomIt boundary = partition_helper::call(
+                    policy, first + 1, last,
+                    [&comp, &pivot](auto const& value) -> bool {
+                        return HPX_INVOKE(comp, value, pivot);
+                    },
+                    util::projection_identity());
+
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(first, --boundary);
+#else
+                std::iter_swap(first, --boundary);
+#endif
+                if (nth == boundary)
+                {
+                    return;
+                }
+
+                if (nth < boundary)
+                {
+                    last = boundary;
+                    continue;
+                }
+
+                // The pivot was the smallest element. Skip all elements equal
+                // to it to make progress on ranges with many duplicates.
+                bool const skip_equal = boundary == first;
+
+                first = boundary + 1;
+                if (skip_equal)
+                {
+                    auto const& equal = *boundary;
+                    first = partition_helper::call(
+                        policy, first, last,
+                        [&comp, &equal](auto const& value) -> bool {
+                            return !HPX_INVOKE(comp, equal, value);
+                        },
+                        util::projection_identity());
+
+                    if (nth < first)
+                    {
+                        return;
+                    }
+                }
+            }
+
+            std::nth_element(first, nth, last, std::forward<Comp>(comp));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename Sent, typename Comp,
+                typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
+                Sent last_s, Comp&& comp, Proj&& proj)
+            {
+                auto last = detail::advance_to_sentinel(first, last_s);
+                if (nth != last)
+                {
+                    std::nth_element(first, nth, last,
+                        util::compare_projected<Comp, Proj>(
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj)));
+                }
+                return last;
+            }
+
+            template <typename ExPolicy, typename Sent, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt nth,
+                Sent last_s, Comp&& comp, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+                using compare_type =
+                    util::compare_projected<std::decay_t<Comp>,
+                        std::decay_t<Proj>>;
+
+                auto last = detail::advance_to_sentinel(first, last_s);
+                if (nth == last)
+                {
+                    return algorithm_result::get(std::move(last));
+                }
+
+                try
+                {
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, nth, last,
+                            comp = compare_type(std::forward<Comp>(comp),
+                                std::forward<Proj>(proj))]() -> RandomIt {
+                            try
+                            {
+                                parallel_nth_element(
+                                    policy, first, nth, last, comp);
+                                return last;
+                            }
+                            catch (...)
+                            {
+                                util::detail::handle_local_exceptions<
+                                    ExPolicy>::call(std::current_exception());
+                            }
+
+                            // Not reachable.
+                            HPX_ASSERT(false);
+                            return last;
+                        }));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::nth_element
+    HPX_INLINE_CONSTEXPR_VARIABLE struct nth_element_t final
+      : hpx::detail::tag_parallel_algorithm<nth_element_t>
+    {
+    private:
+        // clang-format off
+        template <typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )>
+        // clang-format on
+        friend void tag_fallback_dispatch(hpx::nth_element_t, RandomIt first,
+            RandomIt nth, RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                hpx::execution::seq, first, nth, last, std::forward<Comp>(comp),
+                parallel::util::projection_identity());
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_dispatch(hpx::nth_element_t, ExPolicy&& policy,
+            RandomIt first, RandomIt nth, RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                       std::forward<ExPolicy>(policy), first, nth, last,
+                       std::forward<Comp>(comp),
+                       parallel::util::projection_identity());
+        }
+    } nth_element{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
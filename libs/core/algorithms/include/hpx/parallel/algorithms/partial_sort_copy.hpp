@@ -0,0 +1,472 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(n) comparisons.
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     an input iterator.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// The comparisons in the \a partial_sort_copy algorithm invoked without
+    /// an execution policy object execute in sequential order in the calling
+    /// thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns \a RandomIt, an
+    ///           iterator to the element defining the upper boundary of the
+    ///           sorted range i.e. d_first + min(last - first,
+    ///           d_last - d_first).
+    ///
+    template <typename InIter, typename RandomIt, typename Comp>
+    RandomIt partial_sort_copy(InIter first, InIter last, RandomIt d_first,
+        RandomIt d_last, Comp&& comp = Comp());
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(n) comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     a forward iterator.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a partial_sort_copy requires \a Comp
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandomIt otherwise. The iterator returned refers
+    ///           to the element defining the upper boundary of the sorted
+    ///           range i.e. d_first + min(last - first, d_last - d_first).
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandomIt,
+        typename Comp>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandomIt d_first, RandomIt d_last, Comp&& comp = Comp());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copy the (at most) d_last - d_first smallest elements of
+        /// [first, last) to [d_first, d_last) and sort them. \a comp compares
+        /// two elements of the destination range, \a comp_in compares an
+        /// element of the source range with an element of the destination
+        /// range.
+        template <typename InIter, typename RandomIt, typename Comp,
+            typename CompIn>
+        RandomIt sequential_partial_sort_copy(InIter first, InIter last,
+            RandomIt d_first, RandomIt d_last, Comp& comp, CompIn& comp_in)
+        {
+            RandomIt d_middle = d_first;
+            for (/**/; first != last && d_middle != d_last; ++first, ++d_middle)
+            {
+                *d_middle = *first;
+            }
+            std::make_heap(d_first, d_middle, comp);
+
+            for (/**/; first != last; ++first)
+            {
+                if (HPX_INVOKE(comp_in, *first, *d_first))
+                {
+                    std::pop_heap(d_first, d_middle, comp);
+                    *(d_middle - 1) = *first;
+                    std::push_heap(d_first, d_middle, comp);
+                }
+            }
+            std::sort_heap(d_first, d_middle, comp);
+
+            return d_middle;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Collect the (at most) \a count smallest elements of [first, last)
+        /// as a heap of elements of the destination type \a T.
+        template <typename T, typename FwdIter, typename Comp,
+            typename CompIn>
+        std::vector<T> partial_sort_copy_candidates(FwdIter first,
+            FwdIter last, std::size_t count, Comp& comp, CompIn& comp_in)
+        {
+            std::vector<T> heap;
+            heap.reserve(count);
+            for (/**/; first != last && heap.size() != count; ++first)
+            {
+                heap.emplace_back(*first);
+            }
+            std::make_heap(heap.begin(), heap.end(), comp);
+
+            for (/**/; first != last; ++first)
+            {
+                if (HPX_INVOKE(comp_in, *first, heap.front()))
+                {
+                    std::pop_heap(heap.begin(), heap.end(), comp);
+                    heap.back() = *first;
+                    std::push_heap(heap.begin(), heap.end(), comp);
+                }
+            }
+            return heap;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Every task collects the smallest elements of its part of the input
+        /// range. The smallest of those candidates are selected and sorted
+        /// (both in parallel) before being moved to the destination range.
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Comp, typename CompIn>
+        RandomIt parallel_partial_sort_copy(ExPolicy&& policy, FwdIter first,
+            std::size_t size, RandomIt d_first, std::size_t count, Comp& comp,
+            CompIn& comp_in)
+        {
+            using value_type =
+                typename std::iterator_traits<RandomIt>::value_type;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            // each task handles at least sort_limit_per_task elements
+            std::size_t const num_tasks = (std::max)(std::size_t(1),
+                (std::min)(cores, size / sort_limit_per_task));
+
+            std::vector<hpx::future<std::vector<value_type>>> workitems;
+            workitems.reserve(num_tasks);
+
+            FwdIter part_begin = first;
+            for (std::size_t i = 0; i != num_tasks; ++i)
+            {
+                FwdIter part_end = std::next(part_begin,
+                    (i + 1) * size / num_tasks - i * size / num_tasks);
+
+                workitems.push_back(execution::async_execute(
+                    policy.executor(),
+                    [part_begin, part_end, count, &comp, &comp_in]() {
+                        return partial_sort_copy_candidates<value_type>(
+                            part_begin, part_end, count, comp, comp_in);
+                    }));
+
+                part_begin = part_end;
+            }
+
+            hpx::wait_all(workitems);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+
+            std::vector<value_type> candidates = workitems[0].get();
+            for (std::size_t i = 1; i != num_tasks; ++i)
+            {
+                std::vector<value_type> part = workitems[i].get();
+                candidates.insert(candidates.end(),
+                    std::make_move_iterator(part.begin()),
+                    std::make_move_iterator(part.end()));
+            }
+            HPX_ASSERT(candidates.size() >= count);
+
+            auto const middle = candidates.begin() + count;
+            parallel_nth_element(
+                policy, candidates.begin(), middle, candidates.end(), comp);
+            parallel_sort_async(policy, candidates.begin(), middle, Comp(comp))
+                .get();
+
+            return std::move(candidates.begin(), middle, d_first);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Proj1 is applied to the elements of the source range, Proj2 to the
+        // elements of the destination range.
+        template <typename IterPair>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<IterPair>, IterPair>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj1, typename Proj2>
+            static util::in_out_result<InIter, RandomIt> sequential(ExPolicy,
+                InIter first, Sent1 last, RandomIt d_first, Sent2 d_last,
+                Comp&& comp, Proj1&& proj1, Proj2&& proj2)
+            {
+                auto last_iter = detail::advance_to_sentinel(first, last);
+                auto d_last_iter = detail::advance_to_sentinel(d_first, d_last);
+
+                util::compare_projected<std::decay_t<Comp>,
+                    std::decay_t<Proj2>>
+                    comp_out(comp, proj2);
+                util::compare_projected<std::decay_t<Comp>,
+                    std::decay_t<Proj1>, std::decay_t<Proj2>>
+                    comp_in(comp, proj1, proj2);
+
+                return util::in_out_result<InIter, RandomIt>{last_iter,
+                    sequential_partial_sort_copy(first, last_iter, d_first,
+                        d_last_iter, comp_out, comp_in)};
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent1,
+                typename RandomIt, typename Sent2, typename Comp,
+                typename Proj1, typename Proj2>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            parallel(ExPolicy&& policy, FwdIter first, Sent1 last,
+                RandomIt d_first, Sent2 d_last, Comp&& comp, Proj1&& proj1,
+                Proj2&& proj2)
+            {
+                using result_type = util::in_out_result<FwdIter, RandomIt>;
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, result_type>;
+                using compare_type = util::compare_projected<
+                    std::decay_t<Comp>, std::decay_t<Proj2>>;
+                using compare_in_type =
+                    util::compare_projected<std::decay_t<Comp>,
+                        std::decay_t<Proj1>, std::decay_t<Proj2>>;
+
+                auto last_iter = detail::advance_to_sentinel(first, last);
+                std::size_t const size = std::distance(first, last_iter);
+                std::size_t const count = (std::min)(size,
+                    std::size_t(detail::distance(d_first, d_last)));
+
+                // small ranges are not worth the overheads
+                if (count == 0 || size < sort_limit_per_task)
+                {
+                    return algorithm_result::get(sequential(policy, first,
+                        last_iter, d_first, d_first + count,
+                        std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                        std::forward<Proj2>(proj2)));
+                }
+
+                try
+                {
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, last_iter, size, d_first, count,
+                            comp = compare_type(comp, proj2),
+                            comp_in = compare_in_type(
+                                comp, proj1, proj2)]() mutable
+                        -> result_type {
+                            try
+                            {
+                                return result_type{last_iter,
+                                    parallel_partial_sort_copy(policy, first,
+                                        size, d_first, count, comp, comp_in)};
+                            }
+                            catch (...)
+                            {
+                                util::detail::handle_local_exceptions<
+                                    ExPolicy>::call(std::current_exception());
+                            }
+
+                            // Not reachable.
+                            HPX_ASSERT(false);
+                            return result_type{last_iter, d_first};
+                        }));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy,
+                            result_type>::call(std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::detail::tag_parallel_algorithm<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename InIter, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<InIter> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<InIter>::value_type,
+                    typename std::iterator_traits<InIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend RandomIt tag_fallback_dispatch(hpx::partial_sort_copy_t,
+            InIter first, InIter last, RandomIt d_first, RandomIt d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_input_iterator_v<InIter>,
+                "Requires at least input iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                hpx::parallel::util::in_out_result<InIter, RandomIt>;
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                    .call(hpx::execution::seq, first, last, d_first, d_last,
+                        std::forward<Comp>(comp),
+                        parallel::util::projection_identity(),
+                        parallel::util::projection_identity()));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<FwdIter>::value_type,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            RandomIt>::type
+        tag_fallback_dispatch(hpx::partial_sort_copy_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, RandomIt d_first, RandomIt d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                hpx::parallel::util::in_out_result<FwdIter, RandomIt>;
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                    .call(std::forward<ExPolicy>(policy), first, last, d_first,
+                        d_last, std::forward<Comp>(comp),
+                        parallel::util::projection_identity(),
+                        parallel::util::projection_identity()));
+        }
+    } partial_sort_copy{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
@@ -26,6 +26,7 @@
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/rotate.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -59,6 +60,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         struct stable_partition_helper
         {
+            // Merged ranges larger than this are rotated by all cores
+            // cooperatively (see rotate_helper).
+            static constexpr std::size_t parallel_rotate_limit = 65536;
+
             template <typename ExPolicy, typename RandIter, typename F,
                 typename Proj>
             hpx::future<RandIter> operator()(ExPolicy&& policy, RandIter first,
@@ -90,8 +95,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 return dataflow(
                     policy.executor(),
-                    [mid](hpx::future<RandIter>&& left,
-                        hpx::future<RandIter>&& right) -> RandIter {
+                    [policy, mid](hpx::future<RandIter>&& left,
+                        hpx::future<RandIter>&& right)
+                        -> hpx::future<RandIter> {
                         if (left.has_exception() || right.has_exception())
                         {
                             std::list<std::exception_ptr> errors;
@@ -116,12 +122,29 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         RandIter first = left.get();
                         RandIter last = right.get();
 
+                        // Bring the elements satisfying the predicate in the
+                        // right half in front of the ones not satisfying it in
+                        // the left half. Large blocks are swapped in parallel
+                        // instead of running a serial pass over the merged
+                        // range.
+                        if (std::size_t(std::distance(first, last)) >
+                            parallel_rotate_limit)
+                        {
+                            using rotate_result =
+                                util::in_out_result<RandIter, RandIter>;
+
+                            return rotate_helper(policy, first, mid, last)
+                                .then(hpx::launch::sync,
+                                    [](hpx::future<rotate_result>&& f)
+                                        -> RandIter { return f.get().in; });
+                        }
+
                         std::rotate(first, mid, last);
 
                         // for some library implementations std::rotate
                         // does not return the new middle point
                         std::advance(first, std::distance(mid, last));
-                        return first;
+                        return hpx::make_ready_future(first);
                     },
                     std::move(left), std::move(right));
             }
@@ -231,11 +231,6 @@ namespace hpx {
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/transfer.hpp>
-#include <hpx/parallel/util/zip_iterator.hpp>
-
-#if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-#include <boost/shared_array.hpp>
-#endif
 
 #include <algorithm>
 #include <cstddef>
@@ -255,7 +250,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
         template <typename Iter, typename Sent, typename Pred, typename Proj>
         Iter sequential_remove_if(Iter first, Sent last, Pred pred, Proj proj)
         {
-            first = hpx::parallel::v1::detail::sequential_find_if(
+            first = hpx::parallel::v1::detail::sequential_find_if_helper(
                 first, last, pred, proj);
 
             if (first != last)
@@ -290,7 +285,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             parallel(ExPolicy&& policy, Iter first, Sent last, Pred&& pred,
                 Proj&& proj)
             {
-                typedef hpx::util::zip_iterator<Iter, bool*> zip_iterator;
                 typedef util::detail::algorithm_result<ExPolicy, Iter>
                     algorithm_result;
                 typedef typename std::iterator_traits<Iter>::difference_type
@@ -301,92 +295,58 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 if (count == 0)
                     return algorithm_result::get(std::move(first));
 
-#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-                std::shared_ptr<bool[]> flags(new bool[count]);
-#else
-                boost::shared_array<bool> flags(new bool[count]);
-#endif
                 std::size_t init = 0u;
 
-                using hpx::get;
-                using hpx::util::make_zip_iterator;
                 typedef util::scan_partitioner<ExPolicy, Iter, std::size_t,
                     void, util::scan_partitioner_sequential_f3_tag>
                     scan_partitioner_type;
 
+                // Each partition moves the elements to keep to its front,
+                // which is done in place and in parallel. The number of
+                // elements kept is returned.
                 auto f1 = [pred = std::forward<Pred>(pred),
-                              proj = std::forward<Proj>(proj)](
-                              zip_iterator part_begin,
+                              proj = std::forward<Proj>(proj)](Iter part_begin,
                               std::size_t part_size) -> std::size_t {
-                    // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [pred, proj](zip_iterator it) mutable {
-                            bool f = hpx::util::invoke(
-                                pred, hpx::util::invoke(proj, get<0>(*it)));
-
-                            get<1>(*it) = f;
-                        });
-
-                    // There is no need to return the partition result.
-                    // But, the scan_partitioner doesn't support 'void' as
-                    // Result1. So, unavoidably return non-meaning value.
-                    return 0u;
+                    Iter part_end = part_begin;
+                    std::advance(part_end, part_size);
+
+                    return std::distance(part_begin,
+                        sequential_remove_if(part_begin, part_end, pred, proj));
                 };
 
+                // Accumulate the number of elements kept, which gives the
+                // destination offset of each partition.
                 auto f2 = hpx::unwrapping(
-                    [](std::size_t, std::size_t) -> std::size_t {
-                        // There is no need to propagate the partition
-                        // results. But, the scan_partitioner doesn't
-                        // support 'void' as Result1. So, unavoidably
-                        // return non-meaning value.
-                        return 0u;
+                    [](std::size_t prev, std::size_t curr) -> std::size_t {
+                        return prev + curr;
                     });
 
+                // Move the kept elements of each partition (if any) to their
+                // final position. This touches the elements kept only.
                 std::shared_ptr<Iter> dest_ptr = std::make_shared<Iter>(first);
                 auto f3 =
-                    [dest_ptr, flags](zip_iterator part_begin,
-                        std::size_t part_size,
+                    [dest_ptr](Iter part_begin, std::size_t,
                         hpx::shared_future<std::size_t> curr,
                         hpx::shared_future<std::size_t> next) mutable -> void {
-                    HPX_UNUSED(flags);
-
-                    curr.get();    // rethrow exceptions
-                    next.get();    // rethrow exceptions
+                    std::size_t const offset = curr.get();
+                    std::size_t const kept = next.get() - offset;
 
                     Iter& dest = *dest_ptr;
-
-                    using execution_policy_type = std::decay_t<ExPolicy>;
-                    if (dest == get<0>(part_begin.get_iterator_tuple()))
+                    if (dest == part_begin)
                     {
-                        // Self-assignment must be detected.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                {
-                                    if (dest != get<0>(it.get_iterator_tuple()))
-                                        *dest++ = std::move(get<0>(*it));
-                                    else
-                                        ++dest;
-                                }
-                            });
+                        // Self-assignment must be avoided.
+                        std::advance(dest, kept);
                     }
                     else
                     {
-                        // Self-assignment can't be performed.
-                        util::loop_n<execution_policy_type>(
-                            part_begin, part_size, [&dest](zip_iterator it) {
-                                if (!get<1>(*it))
-                                    *dest++ = std::move(get<0>(*it));
-                            });
+                        dest = util::move_n(part_begin, kept, dest).out;
                     }
                 };
 
                 auto f4 =
-                    [dest_ptr, flags](
+                    [dest_ptr](
                         std::vector<hpx::shared_future<std::size_t>>&& items,
                         std::vector<hpx::future<void>>&& data) mutable -> Iter {
-                    HPX_UNUSED(flags);
-
                     // make sure iterators embedded in function object that is
                     // attached to futures are invalidated
                     items.clear();
@@ -396,14 +356,13 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 };
 
                 return scan_partitioner_type::call(
-                    std::forward<ExPolicy>(policy),
-                    make_zip_iterator(first, flags.get()), count, init,
-                    // step 1 performs first part of scan algorithm
+                    std::forward<ExPolicy>(policy), first, count, init,
+                    // step 1 compacts each partition in place
                     std::move(f1),
                     // step 2 propagates the partition results from left
                     // to right
                     std::move(f2),
-                    // step 3 runs final accumulation on each partition
+                    // step 3 moves the compacted partitions together
                     std::move(f3),
                     // step 4 use this return value
                     std::move(f4));
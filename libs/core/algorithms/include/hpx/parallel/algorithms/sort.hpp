@@ -242,7 +242,10 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/in_place_sample_sort.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -267,6 +270,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         static const std::size_t sort_limit_per_task = 65536ul;
 
+        // ranges holding more than this number of chunks are partitioned by
+        // all cores cooperatively, see partition_helper
+        static const std::size_t sort_parallel_partition_chunks = 4ul;
+
         /// Return the iterator to the mid value of the three values
         /// passed as parameters
         ///
@@ -334,39 +341,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
 #endif
         }
 
-        /// \brief this function is the work assigned to each thread in the
-        ///        parallel process
-        /// \exception
-        /// \return
-        /// \remarks
-        template <typename ExPolicy, typename RandomIt, typename Comp>
-        hpx::future<RandomIt> sort_thread(ExPolicy&& policy, RandomIt first,
-            RandomIt last, Comp comp, std::size_t chunk_size)
+        /// Partition the range [first, last) around the pivot stored at
+        /// \a first and move the pivot to its final position \a c_last. The
+        /// elements left to be sorted are [first, c_last) and [c_first, last).
+        template <typename RandomIt, typename Comp>
+        void sequential_pivot_partition(RandomIt first, RandomIt last,
+            RandomIt& c_first, RandomIt& c_last, Comp& comp)
         {
-            std::ptrdiff_t N = last - first;
-            if (std::size_t(N) <= chunk_size)
-            {
-                return execution::async_execute(policy.executor(),
-                    [first, last, comp = std::move(comp)]() -> RandomIt {
-                        std::sort(first, last, comp);
-                        return last;
-                    });
-            }
-
-            // check if sorted
-            if (detail::is_sorted_sequential(first, last, comp))
-            {
-                return hpx::make_ready_future(last);
-            }
-
-            // pivot selections
-            pivot9(first, last, comp);
-
             using reference =
                 typename std::iterator_traits<RandomIt>::reference;
 
             reference val = *first;
-            RandomIt c_first = first + 1, c_last = last - 1;
+            c_first = first + 1;
+            c_last = last - 1;
 
             while (comp(*c_first, val))
             {
@@ -398,6 +385,74 @@ namespace hpx { namespace parallel { inline namespace v1 {
 #else
             std::iter_swap(first, c_last);
 #endif
+        }
+
+        /// \brief this function is the work assigned to each thread in the
+        ///        parallel process
+        /// \exception
+        /// \return
+        /// \remarks
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        hpx::future<RandomIt> sort_thread(ExPolicy&& policy, RandomIt first,
+            RandomIt last, Comp comp, std::size_t chunk_size)
+        {
+            std::ptrdiff_t N = last - first;
+            if (std::size_t(N) <= chunk_size)
+            {
+                return execution::async_execute(policy.executor(),
+                    [first, last, comp = std::move(comp)]() -> RandomIt {
+                        std::sort(first, last, comp);
+                        return last;
+                    });
+            }
+
+            // check if sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+            {
+                return hpx::make_ready_future(last);
+            }
+
+            // pivot selections
+            pivot9(first, last, comp);
+
+            RandomIt c_first, c_last;
+            if (std::size_t(N) / chunk_size >= sort_parallel_partition_chunks)
+            {
+                // Large ranges are partitioned in place by all cores, the
+                // pivot stays at the front while the remaining elements are
+                // partitioned.
+                auto const& pivot = *first;
+                c_last = partition_helper::call(
+                    policy, first + 1, last,
+                    [&comp, &pivot](auto const& value) -> bool {
+                        return HPX_INVOKE(comp, value, pivot);
+                    },
+                    util::projection_identity());
+
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(first, --c_last);
+#else
+                std::iter_swap(first, --c_last);
+#endif
+                c_first = c_last + 1;
+
+                // The pivot was the smallest element. Skip all elements equal
+                // to it to make progress on ranges with many duplicates.
+                if (c_last == first)
+                {
+                    auto const& equal = *c_last;
+                    c_first = partition_helper::call(
+                        policy, c_first, last,
+                        [&comp, &equal](auto const& value) -> bool {
+                            return !HPX_INVOKE(comp, equal, value);
+                        },
+                        util::projection_identity());
+                }
+            }
+            else
+            {
+                sequential_pivot_partition(first, last, c_first, c_last, comp);
+            }
 
             // spawn tasks for each sub section
             hpx::future<RandomIt> left = execution::async_execute(
@@ -471,6 +526,29 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::make_ready_future(last);
             }
 
+            // The quick sort below partitions each range on a single core,
+            // large ranges are partitioned by all cores cooperatively. The
+            // sample sort buffers elements, which rules out proxy iterators.
+            using value_type =
+                typename std::iterator_traits<RandomIt>::value_type;
+            using reference =
+                typename std::iterator_traits<RandomIt>::reference;
+            if constexpr (std::is_same_v<reference, value_type&> &&
+                std::is_copy_constructible_v<value_type>)
+            {
+                if (cores > 1 && std::size_t(N) / chunk_size >= cores)
+                {
+                    return execution::async_execute(policy.executor(),
+                        [policy, first, last,
+                            comp = std::forward<Comp>(comp), cores,
+                            chunk_size]() -> RandomIt {
+                            in_place_sample_sort(
+                                policy, first, last, comp, cores, chunk_size);
+                            return last;
+                        });
+                }
+            }
+
             return execution::async_execute(policy.executor(),
                 &sort_thread<typename std::decay<ExPolicy>::type, RandomIt,
                     Comp>,
@@ -478,6 +556,31 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<Comp>(comp), chunk_size);
         }
 
+        /// \brief Sort the elements by their arithmetic keys using a
+        ///        parallel radix sort, see \a is_radix_sortable.
+        template <typename ExPolicy, typename RandomIt, typename Comp,
+            typename Proj>
+        hpx::future<RandomIt> parallel_radix_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt last, Comp&& comp, Proj&& proj)
+        {
+            std::size_t const count = last - first;
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            // each task handles at least sort_limit_per_task elements
+            std::size_t const num_workers = (std::max)(std::size_t(1),
+                (std::min)(cores, count / sort_limit_per_task));
+
+            return execution::async_execute(policy.executor(),
+                [policy, first, last, comp = std::forward<Comp>(comp),
+                    proj = std::forward<Proj>(proj),
+                    num_workers]() -> RandomIt {
+                    parallel_radix_sort(
+                        policy, first, last, comp, proj, num_workers);
+                    return last;
+                });
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -513,6 +616,21 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys compared using the default order are
+                    // sorted by a radix sort if there are enough of them
+                    if constexpr (is_radix_sortable_v<RandomIt,
+                                      std::decay_t<Comp>, std::decay_t<Proj>>)
+                    {
+                        if (std::size_t(last - first) >= sort_limit_per_task)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async(
+                                    std::forward<ExPolicy>(policy), first,
+                                    last, std::forward<Comp>(comp),
+                                    std::forward<Proj>(proj)));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/parallel/util/tagged_pair.hpp>
 
@@ -34,6 +35,39 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key_(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first, Compare&& comp, std::false_type)
+        {
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
+
+            using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                detail::sort<iterator_type>().call(
+                    std::forward<ExPolicy>(policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    std::forward<Compare>(comp), detail::extract_key()));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key_(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first, Compare&& comp, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -130,16 +164,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
             (hpx::traits::is_random_access_iterator<ValueIter>::value),
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
-
-        using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+        using is_segmented = hpx::traits::is_segmented_iterator<KeyIter>;
 
-        return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
-            detail::sort<iterator_type>().call(std::forward<ExPolicy>(policy),
-                hpx::util::make_zip_iterator(key_first, value_first),
-                hpx::util::make_zip_iterator(key_last, value_last),
-                std::forward<Compare>(comp), detail::extract_key()));
+        return detail::sort_by_key_(std::forward<ExPolicy>(policy), key_first,
+            key_last, value_first, std::forward<Compare>(comp),
+            is_segmented());
 #endif
     }
 }}}    // namespace hpx::parallel::v1
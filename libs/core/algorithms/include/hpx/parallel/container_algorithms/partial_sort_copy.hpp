@@ -0,0 +1,509 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(n) comparisons.
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     an input iterator.
+    /// \tparam Sent1       The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for InIter.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Sent2       The type of the destination sentinel (deduced).
+    ///                     This sentinel type must be a sentinel for RandomIt.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj1       The type of an optional projection function
+    ///                     applied to the elements of the source range.
+    ///                     This defaults to \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function
+    ///                     applied to the elements of the destination range.
+    ///                     This defaults to \a util::projection_identity
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to sentinel value denoting the end of the
+    ///                     sequence of elements the algorithm will be applied.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the sentinel value denoting the end of
+    ///                     the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     source range as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     destination range as a projection operation before
+    ///                     the actual predicate \a comp is invoked.
+    ///
+    /// The comparisons in the \a partial_sort_copy algorithm invoked without
+    /// an execution policy object execute in sequential order in the calling
+    /// thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a partial_sort_copy_result<InIter, RandomIt>. The
+    ///           algorithm returns an object equal to {last, d_first + n}.
+    ///
+    template <typename InIter, typename Sent1, typename RandomIt,
+        typename Sent2, typename Comp, typename Proj1, typename Proj2>
+    partial_sort_copy_result<InIter, RandomIt> partial_sort_copy(
+        InIter first, Sent1 last, RandomIt d_first, Sent2 d_last,
+        Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+        Proj2&& proj2 = Proj2());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(n) comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     a forward iterator.
+    /// \tparam Sent1       The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Sent2       The type of the destination sentinel (deduced).
+    ///                     This sentinel type must be a sentinel for RandomIt.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj1       The type of an optional projection function
+    ///                     applied to the elements of the source range.
+    ///                     This defaults to \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function
+    ///                     applied to the elements of the destination range.
+    ///                     This defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to sentinel value denoting the end of the
+    ///                     sequence of elements the algorithm will be applied.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the sentinel value denoting the end of
+    ///                     the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     source range as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     destination range as a projection operation before
+    ///                     the actual predicate \a comp is invoked.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<partial_sort_copy_result<FwdIter, RandomIt>>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns
+    ///           \a partial_sort_copy_result<FwdIter, RandomIt> otherwise.
+    ///           The algorithm returns an object equal to
+    ///           {last, d_first + n}.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Sent1,
+        typename RandomIt, typename Sent2, typename Comp, typename Proj1,
+        typename Proj2>
+    typename util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<FwdIter, RandomIt>>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, Sent1 last,
+        RandomIt d_first, Sent2 d_last, Comp&& comp = Comp(),
+        Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts some of the elements in the range \a rng1 in ascending
+    /// order, storing the result in the range \a rng2. At most n elements
+    /// are placed sorted to the beginning of \a rng2, where n is the
+    /// smaller of the sizes of the two ranges. The order of equal elements
+    /// is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately std::size(rng1) * log(n)
+    ///         comparisons.
+    ///
+    /// \tparam Rng1        The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of an input iterator.
+    /// \tparam Rng2        The type of the destination range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj1       The type of an optional projection function
+    ///                     applied to the elements of the source range.
+    ///                     This defaults to \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function
+    ///                     applied to the elements of the destination range.
+    ///                     This defaults to \a util::projection_identity
+    ///
+    /// \param rng1         Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param rng2         Refers to the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     source range as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     destination range as a projection operation before
+    ///                     the actual predicate \a comp is invoked.
+    ///
+    /// The comparisons in the \a partial_sort_copy algorithm invoked without
+    /// an execution policy object execute in sequential order in the calling
+    /// thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a partial_sort_copy_result<iterator_t<Rng1>,
+    ///           iterator_t<Rng2>>. The algorithm returns an object equal to
+    ///           {end(rng1), begin(rng2) + n}.
+    ///
+    template <typename Rng1, typename Rng2, typename Comp, typename Proj1,
+        typename Proj2>
+    partial_sort_copy_result<
+        typename hpx::traits::range_iterator<Rng1>::type,
+        typename hpx::traits::range_iterator<Rng2>::type>
+    partial_sort_copy(Rng1&& rng1, Rng2&& rng2, Comp&& comp = Comp(),
+        Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts some of the elements in the range \a rng1 in ascending
+    /// order, storing the result in the range \a rng2. At most n elements
+    /// are placed sorted to the beginning of \a rng2, where n is the
+    /// smaller of the sizes of the two ranges. The order of equal elements
+    /// is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately std::size(rng1) * log(n)
+    ///         comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng1        The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Rng2        The type of the destination range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj1       The type of an optional projection function
+    ///                     applied to the elements of the source range.
+    ///                     This defaults to \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function
+    ///                     applied to the elements of the destination range.
+    ///                     This defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng1         Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param rng2         Refers to the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     source range as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     destination range as a projection operation before
+    ///                     the actual predicate \a comp is invoked.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a partial_sort_copy algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<partial_sort_copy_result<iterator_t<Rng1>,
+    ///           iterator_t<Rng2>>> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a partial_sort_copy_result<iterator_t<Rng1>,
+    ///           iterator_t<Rng2>> otherwise. The algorithm returns an object
+    ///           equal to {end(rng1), begin(rng2) + n}.
+    ///
+    template <typename ExPolicy, typename Rng1, typename Rng2, typename Comp,
+        typename Proj1, typename Proj2>
+    typename util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>>::type
+    partial_sort_copy(ExPolicy&& policy, Rng1&& rng1, Rng2&& rng2,
+        Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+        Proj2&& proj2 = Proj2());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    template <typename I, typename O>
+    using partial_sort_copy_result = parallel::util::in_out_result<I, O>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::ranges::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::detail::tag_parallel_algorithm<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename InIter, typename Sent1, typename RandomIt,
+            typename Sent2, typename Comp = ranges::less,
+            typename Proj1 = parallel::util::projection_identity,
+            typename Proj2 = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<InIter>::value &&
+                hpx::traits::is_sentinel_for<Sent1, InIter>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::traits::is_sentinel_for<Sent2, RandomIt>::value &&
+                parallel::traits::is_projected<Proj1, InIter>::value &&
+                parallel::traits::is_projected<Proj2, RandomIt>::value &&
+                parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    parallel::traits::projected<Proj1, InIter>,
+                    parallel::traits::projected<Proj2, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<InIter, RandomIt> tag_fallback_dispatch(
+            hpx::ranges::partial_sort_copy_t, InIter first, Sent1 last,
+            RandomIt d_first, Sent2 d_last, Comp&& comp = Comp(),
+            Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires a random access iterator.");
+
+            using result_type = partial_sort_copy_result<InIter, RandomIt>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(hpx::execution::seq, first, last, d_first, d_last,
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Sent1,
+            typename RandomIt, typename Sent2, typename Comp = ranges::less,
+            typename Proj1 = parallel::util::projection_identity,
+            typename Proj2 = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_sentinel_for<Sent1, FwdIter>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::traits::is_sentinel_for<Sent2, RandomIt>::value &&
+                parallel::traits::is_projected<Proj1, FwdIter>::value &&
+                parallel::traits::is_projected<Proj2, RandomIt>::value &&
+                parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    parallel::traits::projected<Proj1, FwdIter>,
+                    parallel::traits::projected<Proj2, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<FwdIter, RandomIt>>::type
+        tag_fallback_dispatch(hpx::ranges::partial_sort_copy_t,
+            ExPolicy&& policy, FwdIter first, Sent1 last, RandomIt d_first,
+            Sent2 d_last, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires a random access iterator.");
+
+            using result_type = partial_sort_copy_result<FwdIter, RandomIt>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(std::forward<ExPolicy>(policy), first, last, d_first,
+                    d_last, std::forward<Comp>(comp),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename Rng1, typename Rng2,
+            typename Comp = ranges::less,
+            typename Proj1 = parallel::util::projection_identity,
+            typename Proj2 = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                parallel::traits::is_projected_range<Proj1, Rng1>::value &&
+                parallel::traits::is_projected_range<Proj2, Rng2>::value &&
+                parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    parallel::traits::projected_range<Proj1, Rng1>,
+                    parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>
+        tag_fallback_dispatch(hpx::ranges::partial_sort_copy_t, Rng1&& rng1,
+            Rng2&& rng2, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(hpx::traits::is_input_iterator<iterator_type1>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires a random access iterator.");
+
+            using result_type =
+                partial_sort_copy_result<iterator_type1, iterator_type2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(hpx::execution::seq, hpx::util::begin(rng1),
+                    hpx::util::end(rng1), hpx::util::begin(rng2),
+                    hpx::util::end(rng2), std::forward<Comp>(comp),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng1, typename Rng2,
+            typename Comp = ranges::less,
+            typename Proj1 = parallel::util::projection_identity,
+            typename Proj2 = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                parallel::traits::is_projected_range<Proj1, Rng1>::value &&
+                parallel::traits::is_projected_range<Proj2, Rng2>::value &&
+                parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    parallel::traits::projected_range<Proj1, Rng1>,
+                    parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<
+                typename hpx::traits::range_iterator<Rng1>::type,
+                typename hpx::traits::range_iterator<Rng2>::type>>::type
+        tag_fallback_dispatch(hpx::ranges::partial_sort_copy_t,
+            ExPolicy&& policy, Rng1&& rng1, Rng2&& rng2, Comp&& comp = Comp(),
+            Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_forward_iterator<iterator_type1>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires a random access iterator.");
+
+            using result_type =
+                partial_sort_copy_result<iterator_type1, iterator_type2>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<result_type>()
+                .call(std::forward<ExPolicy>(policy), hpx::util::begin(rng1),
+                    hpx::util::end(rng1), hpx::util::begin(rng2),
+                    hpx::util::end(rng2), std::forward<Comp>(comp),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
+        }
+    } partial_sort_copy{};
+}}    // namespace hpx::ranges
+
+#endif
@@ -12,9 +12,14 @@
 #if defined(HPX_HAVE_DATAPAR)
 
 #include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/parallel/datapar/equal.hpp>
 #include <hpx/parallel/datapar/fill.hpp>
+#include <hpx/parallel/datapar/find.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/datapar/minmax.hpp>
+#include <hpx/parallel/datapar/mismatch.hpp>
+#include <hpx/parallel/datapar/reduce.hpp>
 #include <hpx/parallel/datapar/transfer.hpp>
 #include <hpx/parallel/datapar/transform_loop.hpp>
 #include <hpx/parallel/datapar/zip_iterator.hpp>
@@ -0,0 +1,87 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/tag_dispatch.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/equal.hpp>
+#include <hpx/parallel/datapar/mismatch.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // equal is implemented in terms of the vectorized mismatch kernel
+    template <typename ExPolicy, typename Iter1, typename Sent1,
+        typename Iter2, typename Sent2, typename F, typename Proj1,
+        typename Proj2,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value&&
+                    hpx::traits::is_sentinel_for<Sent2, Iter2>::value&&
+                        is_datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                            Proj2>::value)>
+    HPX_FORCEINLINE bool tag_dispatch(sequential_equal_binary_t<ExPolicy>,
+        Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f, Proj1&&,
+        Proj2&&)
+    {
+        std::size_t count = detail::distance(first1, last1);
+        if (count != static_cast<std::size_t>(detail::distance(first2, last2)))
+        {
+            return false;
+        }
+        return datapar_mismatch::call(first1, first2, count, f) == count;
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_mismatch_compatible<Iter1, Iter2, F,
+                    util::projection_identity,
+                    util::projection_identity>::value)>
+    HPX_FORCEINLINE bool tag_dispatch(sequential_equal_t<ExPolicy>,
+        Iter1 first1, Iter1 last1, Iter2 first2, F&& f)
+    {
+        std::size_t count = detail::distance(first1, last1);
+        return datapar_mismatch::call(first1, first2, count, f) == count;
+    }
+
+    // run equal on a single partition, cancel the token if a mismatch was
+    // found
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                    Proj2>::value)>
+    HPX_FORCEINLINE void tag_dispatch(sequential_equal_t<ExPolicy>,
+        hpx::util::zip_iterator<Iter1, Iter2> it, std::size_t part_count,
+        Token& tok, F&& f, Proj1&&, Proj2&&)
+    {
+        auto const& iters = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch::find_offset(hpx::get<0>(iters),
+            hpx::get<1>(iters), part_count, f,
+            [&](std::size_t) { return tok.was_cancelled(); });
+        if (offset != part_count)
+        {
+            tok.cancel();
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,233 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_dispatch.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_find
+    {
+        // Return the offset of the first element in [it, it + count) the
+        // predicate holds for, count if there is no such element or if
+        // cancelled(offset) returned true. The predicate is invoked with
+        // whole vector packs for the aligned part of the range and with
+        // single elements otherwise.
+        template <typename Iter, typename Pred, typename Cancelled>
+        static std::size_t find_offset(
+            Iter it, std::size_t count, Pred& pred, Cancelled&& cancelled)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V>::value;
+
+            std::size_t i = 0;
+            for (/**/; i != count && !util::detail::is_data_aligned(it);
+                 (void) ++i, ++it)
+            {
+                if (cancelled(i))
+                    return count;
+                if (HPX_INVOKE(pred, *it))
+                    return i;
+            }
+
+            for (/**/; count - i >= size; i += size)
+            {
+                if (cancelled(i))
+                    return count;
+
+                int offset = traits::find_first_of(HPX_INVOKE(pred,
+                    traits::vector_pack_load<V, value_type>::aligned(it)));
+                if (offset != -1)
+                    return i + offset;
+
+                std::advance(it, size);
+            }
+
+            for (/**/; i != count; (void) ++i, ++it)
+            {
+                if (cancelled(i))
+                    return count;
+                if (HPX_INVOKE(pred, *it))
+                    return i;
+            }
+            return count;
+        }
+
+        template <typename Iter, typename Pred>
+        static Iter call(Iter first, std::size_t count, Pred& pred)
+        {
+            std::advance(first,
+                find_offset(
+                    first, count, pred, [](std::size_t) { return false; }));
+            return first;
+        }
+
+        // run the search on a single partition, cancel the token at the
+        // index of the first match
+        template <typename Iter, typename Token, typename Pred>
+        static void call(std::size_t base_idx, Iter it, std::size_t count,
+            Token& tok, Pred& pred)
+        {
+            std::size_t idx = find_offset(it, count, pred,
+                [&](std::size_t i) { return tok.was_cancelled(base_idx + i); });
+            if (idx != count)
+            {
+                tok.cancel(base_idx + idx);
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized searches are used for identity projections only. The
+    // searched value has to be of the element type, a predicate has to map
+    // vector packs onto masks. Everything else is handled by the scalar
+    // fallbacks in detail/find.hpp.
+    template <typename Iter, typename Proj, typename Enable = void>
+    struct is_datapar_find_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Proj>
+    struct is_datapar_find_compatible<Iter, Proj,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter>::value>::type>
+      : std::is_same<typename std::decay<Proj>::type, util::projection_identity>
+    {
+    };
+
+    template <typename Iter, typename T, typename Proj>
+    struct is_datapar_find_value_compatible
+      : std::integral_constant<bool,
+            is_datapar_find_compatible<Iter, Proj>::value &&
+                std::is_same<T,
+                    typename std::iterator_traits<Iter>::value_type>::value>
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct is_datapar_find_pred_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct is_datapar_find_pred_compatible<Iter, Pred, Proj,
+        typename std::enable_if<
+            is_datapar_find_compatible<Iter, Proj>::value>::type>
+      : util::detail::is_vector_pack_invocable<
+            typename traits::vector_pack_type<typename std::iterator_traits<
+                Iter>::value_type>::type::mask_type,
+            Pred,
+            typename traits::vector_pack_type<
+                typename std::iterator_traits<Iter>::value_type>::type>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent, Iter>::value&&
+                    is_datapar_find_value_compatible<Iter, T, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_find_t<ExPolicy>, Iter first,
+        Sent last, T const& value, Proj&&)
+    {
+        auto pred = [&value](auto const& v) { return v == value; };
+        return datapar_find::call(first, detail::distance(first, last), pred);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename T,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_find_value_compatible<Iter, T, Proj>::value)>
+    HPX_FORCEINLINE void tag_dispatch(sequential_find_t<ExPolicy>,
+        std::size_t base_idx, Iter it, std::size_t count, Token& tok,
+        T const& value, Proj&&)
+    {
+        auto pred = [&value](auto const& v) { return v == value; };
+        datapar_find::call(base_idx, it, count, tok, pred);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent, Iter>::value&&
+                    is_datapar_find_pred_compatible<Iter, Pred, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_find_if_t<ExPolicy>,
+        Iter first, Sent last, Pred&& pred, Proj&&)
+    {
+        return datapar_find::call(first, detail::distance(first, last), pred);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_find_pred_compatible<Iter, Pred, Proj>::value)>
+    HPX_FORCEINLINE void tag_dispatch(sequential_find_if_t<ExPolicy>,
+        std::size_t base_idx, Iter it, std::size_t count, Token& tok,
+        Pred&& pred, Proj&&)
+    {
+        datapar_find::call(base_idx, it, count, tok, pred);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent, Iter>::value&&
+                    is_datapar_find_pred_compatible<Iter, Pred, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_find_if_not_t<ExPolicy>,
+        Iter first, Sent last, Pred&& pred, Proj&&)
+    {
+        auto not_pred = [&pred](auto const& v) { return !HPX_INVOKE(pred, v); };
+        return datapar_find::call(
+            first, detail::distance(first, last), not_pred);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Token, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_find_pred_compatible<Iter, Pred, Proj>::value)>
+    HPX_FORCEINLINE void tag_dispatch(sequential_find_if_not_t<ExPolicy>,
+        std::size_t base_idx, Iter it, std::size_t count, Token& tok,
+        Pred&& pred, Proj&&)
+    {
+        auto not_pred = [&pred](auto const& v) { return !HPX_INVOKE(pred, v); };
+        datapar_find::call(base_idx, it, count, tok, not_pred);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -10,12 +10,15 @@
 
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/traits/vector_pack_alignment_size.hpp>
 #include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/type_support/pack.hpp>
 
 #include <cstddef>
 #include <iterator>
@@ -90,6 +93,79 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized algorithm kernels invoke the user supplied function
+    // objects with whole vector packs. They fall back to the scalar code path
+    // if the function object can't be applied to the packs or doesn't return
+    // the expected pack (or mask) type.
+    template <typename Result, typename F, typename Args,
+        typename Enable = void>
+    struct is_vector_pack_invocable_impl : std::false_type
+    {
+    };
+
+    template <typename Result, typename F, typename... Vs>
+    struct is_vector_pack_invocable_impl<Result, F, hpx::util::pack<Vs...>,
+        typename std::enable_if<hpx::is_invocable_v<F, Vs const&...>>::type>
+      : std::is_same<Result,
+            typename std::decay<typename hpx::util::invoke_result<F,
+                Vs const&...>::type>::type>
+    {
+    };
+
+    template <typename Result, typename F, typename... Vs>
+    struct is_vector_pack_invocable
+      : is_vector_pack_invocable_impl<Result,
+            typename std::remove_reference<F>::type&,
+            hpx::util::pack<Vs...>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The default comparison predicates return bool and can't be applied to
+    // vector packs, the kernels use their element-wise equivalents instead.
+    struct vector_pack_equal_to
+    {
+        template <typename T1, typename T2>
+        HPX_HOST_DEVICE HPX_FORCEINLINE auto operator()(
+            T1 const& t1, T2 const& t2) const
+        {
+            return t1 == t2;
+        }
+    };
+
+    struct vector_pack_less
+    {
+        template <typename T1, typename T2>
+        HPX_HOST_DEVICE HPX_FORCEINLINE auto operator()(
+            T1 const& t1, T2 const& t2) const
+        {
+            return t1 < t2;
+        }
+    };
+
+    template <typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE F& get_vector_pack_predicate(F& f)
+    {
+        return f;
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE vector_pack_equal_to
+    get_vector_pack_predicate(hpx::parallel::v1::detail::equal_to)
+    {
+        return {};
+    }
+
+    HPX_HOST_DEVICE HPX_FORCEINLINE vector_pack_less get_vector_pack_predicate(
+        hpx::parallel::v1::detail::less)
+    {
+        return {};
+    }
+
+    template <typename F>
+    using vector_pack_predicate_t = decltype(
+        get_vector_pack_predicate(std::declval<F&>()));
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iter, typename V, typename Enable = void>
     struct store_on_exit
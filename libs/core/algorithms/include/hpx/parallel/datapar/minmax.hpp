@@ -0,0 +1,253 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_minmax
+    {
+        // Visit all elements in [it, it + count) with the scalar update
+        // function. Whole packs of elements for which the vectorized test
+        // doesn't hold for any of the lanes are skipped, which is the common
+        // case once the current minimum (maximum) has settled. This keeps
+        // the position of the first (last) extremum identical to the scalar
+        // algorithms.
+        template <typename Iter, typename Test, typename Update>
+        static void call(
+            Iter it, std::size_t count, Test&& test, Update&& update)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V>::value;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(it);
+                 (void) --count, ++it)
+            {
+                update(it);
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                if (traits::any_of(
+                        test(traits::vector_pack_load<V, value_type>::aligned(
+                            it))))
+                {
+                    for (std::size_t i = 0; i != size; (void) ++i, ++it)
+                    {
+                        update(it);
+                    }
+                }
+                else
+                {
+                    std::advance(it, size);
+                }
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                update(it);
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized searches are used for identity projections and
+    // comparison functions mapping two vector packs onto a mask only.
+    // Everything else is handled by the scalar fallbacks in detail/minmax.hpp.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct is_datapar_minmax_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct is_datapar_minmax_compatible<Iter, F, Proj,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter>::value>::type>
+      : std::integral_constant<bool,
+            std::is_same<typename std::decay<Proj>::type,
+                util::projection_identity>::value &&
+                util::detail::is_vector_pack_invocable<
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter>::value_type>::type::
+                        mask_type,
+                    util::detail::vector_pack_predicate_t<F>,
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter>::value_type>::type,
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter>::value_type>::type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_min_element_t<ExPolicy>,
+        Iter it, std::size_t count, F const& f, Proj const&)
+    {
+        using V = typename traits::vector_pack_type<
+            typename std::iterator_traits<Iter>::value_type>::type;
+
+        if (count == 0 || count == 1)
+            return it;
+
+        auto&& pred = util::detail::get_vector_pack_predicate(f);
+
+        Iter smallest = it;
+        auto value = *it;
+
+        datapar_minmax::call(
+            ++it, count - 1,
+            [&](V const& x) { return HPX_INVOKE(pred, x, V(value)); },
+            [&](Iter curr) {
+                if (HPX_INVOKE(pred, *curr, value))
+                {
+                    smallest = curr;
+                    value = *curr;
+                }
+            });
+
+        return smallest;
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_min_element_t<ExPolicy> tag,
+        Iter first, Iter last, F&& f, Proj&& proj)
+    {
+        return tag_dispatch(
+            tag, first, detail::distance(first, last), f, proj);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_max_element_t<ExPolicy>,
+        Iter it, std::size_t count, F const& f, Proj const&)
+    {
+        using V = typename traits::vector_pack_type<
+            typename std::iterator_traits<Iter>::value_type>::type;
+
+        if (count == 0 || count == 1)
+            return it;
+
+        auto&& pred = util::detail::get_vector_pack_predicate(f);
+
+        Iter greatest = it;
+        auto value = *it;
+
+        datapar_minmax::call(
+            ++it, count - 1,
+            [&](V const& x) { return HPX_INVOKE(pred, V(value), x); },
+            [&](Iter curr) {
+                if (HPX_INVOKE(pred, value, *curr))
+                {
+                    greatest = curr;
+                    value = *curr;
+                }
+            });
+
+        return greatest;
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE Iter tag_dispatch(sequential_max_element_t<ExPolicy> tag,
+        Iter first, Iter last, F&& f, Proj&& proj)
+    {
+        return tag_dispatch(
+            tag, first, detail::distance(first, last), f, proj);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE std::pair<Iter, Iter> tag_dispatch(
+        sequential_minmax_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        using V = typename traits::vector_pack_type<
+            typename std::iterator_traits<Iter>::value_type>::type;
+
+        std::pair<Iter, Iter> result(it, it);
+
+        if (count == 0 || count == 1)
+            return result;
+
+        auto&& pred = util::detail::get_vector_pack_predicate(f);
+
+        auto min_value = *it;
+        auto max_value = min_value;
+
+        datapar_minmax::call(
+            ++it, count - 1,
+            [&](V const& x) {
+                return HPX_INVOKE(pred, x, V(min_value)) ||
+                    !HPX_INVOKE(pred, x, V(max_value));
+            },
+            [&](Iter curr) {
+                if (HPX_INVOKE(pred, *curr, min_value))
+                {
+                    result.first = curr;
+                    min_value = *curr;
+                }
+
+                if (!HPX_INVOKE(pred, *curr, max_value))
+                {
+                    result.second = curr;
+                    max_value = *curr;
+                }
+            });
+
+        return result;
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax_compatible<Iter, F, Proj>::value)>
+    HPX_FORCEINLINE std::pair<Iter, Iter> tag_dispatch(
+        sequential_minmax_element_t<ExPolicy> tag, Iter first, Iter last,
+        F&& f, Proj&& proj)
+    {
+        return tag_dispatch(
+            tag, first, detail::distance(first, last), f, proj);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
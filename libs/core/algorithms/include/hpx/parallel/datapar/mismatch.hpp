@@ -0,0 +1,197 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_dispatch.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_mismatch
+    {
+        // Return the offset of the first position in [0, count) the
+        // predicate doesn't hold for, count if there is no such position or
+        // if cancelled(offset) returned true. The two ranges are not
+        // necessarily aligned relative to each other, all packs are loaded
+        // unaligned.
+        template <typename Iter1, typename Iter2, typename F,
+            typename Cancelled>
+        static std::size_t find_offset(Iter1 it1, Iter2 it2,
+            std::size_t count, F& f, Cancelled&& cancelled)
+        {
+            using value1_type =
+                typename std::iterator_traits<Iter1>::value_type;
+            using value2_type =
+                typename std::iterator_traits<Iter2>::value_type;
+            using V1 = typename traits::vector_pack_type<value1_type>::type;
+            using V2 = typename traits::vector_pack_type<value2_type>::type;
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V1>::value;
+
+            auto&& pred = util::detail::get_vector_pack_predicate(f);
+
+            std::size_t i = 0;
+            for (/**/; count - i >= size; i += size)
+            {
+                if (cancelled(i))
+                    return count;
+
+                auto mask = HPX_INVOKE(pred,
+                    traits::vector_pack_load<V1, value1_type>::unaligned(it1),
+                    traits::vector_pack_load<V2, value2_type>::unaligned(it2));
+                if (!traits::all_of(mask))
+                    return i + traits::find_first_of(!mask);
+
+                std::advance(it1, size);
+                std::advance(it2, size);
+            }
+
+            for (/**/; i != count; (void) ++i, ++it1, ++it2)
+            {
+                if (cancelled(i))
+                    return count;
+                if (!HPX_INVOKE(pred, *it1, *it2))
+                    return i;
+            }
+            return count;
+        }
+
+        template <typename Iter1, typename Iter2, typename F>
+        static std::size_t call(
+            Iter1 it1, Iter2 it2, std::size_t count, F& f)
+        {
+            return find_offset(
+                it1, it2, count, f, [](std::size_t) { return false; });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized comparisons are used for identity projections and
+    // predicates mapping two vector packs onto a mask only. Everything else
+    // is handled by the scalar fallbacks in detail/mismatch.hpp and
+    // detail/equal.hpp.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2, typename Enable = void>
+    struct is_datapar_mismatch_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    struct is_datapar_mismatch_compatible<Iter1, Iter2, F, Proj1, Proj2,
+        typename std::enable_if<
+            util::detail::iterator_datapar_compatible<Iter1>::value &&
+            util::detail::iterator_datapar_compatible<Iter2>::value>::type>
+      : std::integral_constant<bool,
+            util::detail::iterators_datapar_compatible<Iter1, Iter2>::value &&
+                std::is_same<typename std::decay<Proj1>::type,
+                    util::projection_identity>::value &&
+                std::is_same<typename std::decay<Proj2>::type,
+                    util::projection_identity>::value &&
+                util::detail::is_vector_pack_invocable<
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter1>::value_type>::type::
+                        mask_type,
+                    util::detail::vector_pack_predicate_t<F>,
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter1>::value_type>::type,
+                    typename traits::vector_pack_type<typename std::
+                            iterator_traits<Iter2>::value_type>::type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter1, typename Sent1,
+        typename Iter2, typename Sent2, typename F, typename Proj1,
+        typename Proj2,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value&&
+                    hpx::traits::is_sentinel_for<Sent2, Iter2>::value&&
+                        is_datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                            Proj2>::value)>
+    HPX_FORCEINLINE util::in_in_result<Iter1, Iter2> tag_dispatch(
+        sequential_mismatch_binary_t<ExPolicy>, Iter1 first1, Sent1 last1,
+        Iter2 first2, Sent2 last2, F&& f, Proj1&&, Proj2&&)
+    {
+        std::size_t count = (std::min)(
+            static_cast<std::size_t>(detail::distance(first1, last1)),
+            static_cast<std::size_t>(detail::distance(first2, last2)));
+
+        std::size_t offset = datapar_mismatch::call(first1, first2, count, f);
+        std::advance(first1, offset);
+        std::advance(first2, offset);
+        return {first1, first2};
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Sent, typename Iter2,
+        typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_sentinel_for<Sent, Iter1>::value&&
+                    is_datapar_mismatch_compatible<Iter1, Iter2, F,
+                        util::projection_identity,
+                        util::projection_identity>::value)>
+    HPX_FORCEINLINE std::pair<Iter1, Iter2> tag_dispatch(
+        sequential_mismatch_t<ExPolicy>, Iter1 first1, Sent last1,
+        Iter2 first2, F&& f)
+    {
+        std::size_t offset = datapar_mismatch::call(
+            first1, first2, detail::distance(first1, last1), f);
+        std::advance(first1, offset);
+        std::advance(first2, offset);
+        return std::make_pair(first1, first2);
+    }
+
+    // run mismatch on a single partition, cancel the token at the index of
+    // the first mismatch
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_mismatch_compatible<Iter1, Iter2, F, Proj1,
+                    Proj2>::value)>
+    HPX_FORCEINLINE void tag_dispatch(sequential_mismatch_t<ExPolicy>,
+        std::size_t base_idx, hpx::util::zip_iterator<Iter1, Iter2> it,
+        std::size_t part_count, Token& tok, F&& f, Proj1&&, Proj2&&)
+    {
+        auto const& iters = it.get_iterator_tuple();
+        std::size_t offset = datapar_mismatch::find_offset(hpx::get<0>(iters),
+            hpx::get<1>(iters), part_count, f,
+            [&](std::size_t i) { return tok.was_cancelled(base_idx + i); });
+        if (offset != part_count)
+        {
+            tok.cancel(base_idx + offset);
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/tag_dispatch.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_reduce
+    {
+        // The elements are accumulated pack-wise, the partial results held by
+        // the lanes of the accumulator are combined at the end. This requires
+        // the (converted) elements to be of the same type as the result.
+        template <typename Iter, typename T, typename Reduce, typename Convert,
+            typename ValueType =
+                typename std::iterator_traits<Iter>::value_type,
+            typename V = typename traits::vector_pack_type<ValueType>::type>
+        using is_vectorizable = std::integral_constant<bool,
+            std::is_same<T, ValueType>::value &&
+                util::detail::is_vector_pack_invocable<V, Convert, V>::value &&
+                util::detail::is_vector_pack_invocable<V, Reduce, V,
+                    V>::value>;
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        static T call(Iter it, std::size_t count, T init, Reduce& r,
+            Convert& conv, std::false_type)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *it));
+            }
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        static T call(Iter it, std::size_t count, T init, Reduce& r,
+            Convert& conv, std::true_type)
+        {
+            using V = typename traits::vector_pack_type<T>::type;
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V>::value;
+
+            for (/**/; count != 0 && !util::detail::is_data_aligned(it);
+                 (void) --count, ++it)
+            {
+                init = HPX_INVOKE(r, init, HPX_INVOKE(conv, *it));
+            }
+
+            if (count >= size)
+            {
+                V accum = HPX_INVOKE(
+                    conv, traits::vector_pack_load<V, T>::aligned(it));
+                std::advance(it, size);
+                count -= size;
+
+                for (/**/; count >= size; count -= size)
+                {
+                    accum = HPX_INVOKE(r, accum,
+                        HPX_INVOKE(
+                            conv, traits::vector_pack_load<V, T>::aligned(it)));
+                    std::advance(it, size);
+                }
+
+                // horizontal reduction of the partial results
+                init = HPX_INVOKE(r, init, traits::reduce(r, accum));
+            }
+
+            // remaining elements
+            return call(it, count, std::move(init), r, conv, std::false_type());
+        }
+
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        HPX_FORCEINLINE static T call(
+            Iter it, std::size_t count, T init, Reduce& r, Convert& conv)
+        {
+            return call(it, count, std::move(init), r, conv,
+                is_vectorizable<Iter, T, Reduce, Convert>());
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value&& hpx::traits::is_sentinel_for<Sent,
+                    Iter>::value)>
+    HPX_FORCEINLINE T tag_dispatch(sequential_reduce_t<ExPolicy>, Iter first,
+        Sent last, T init, Reduce&& r)
+    {
+        util::projection_identity conv;
+        return datapar_reduce::call(
+            first, detail::distance(first, last), std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value)>
+    HPX_FORCEINLINE T tag_dispatch(sequential_reduce_t<ExPolicy>, Iter it,
+        std::size_t count, T init, Reduce&& r)
+    {
+        util::projection_identity conv;
+        return datapar_reduce::call(it, count, std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value&& hpx::traits::is_sentinel_for<Sent,
+                    Iter>::value)>
+    HPX_FORCEINLINE T tag_dispatch(sequential_reduce_t<ExPolicy>, Iter first,
+        Sent last, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_reduce::call(
+            first, detail::distance(first, last), std::move(init), r, conv);
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                hpx::parallel::util::detail::iterator_datapar_compatible<
+                    Iter>::value)>
+    HPX_FORCEINLINE T tag_dispatch(sequential_reduce_t<ExPolicy>, Iter it,
+        std::size_t count, T init, Reduce&& r, Convert&& conv)
+    {
+        return datapar_reduce::call(it, count, std::move(init), r, conv);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,190 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the larger sizes are partitioned in parallel
+constexpr std::size_t sizes[] = {0, 1, 2, 1000, 100007, 1000003};
+
+template <typename T, typename Compare>
+void verify_nth_element(std::vector<T> const& c, std::vector<T> const& sorted,
+    std::size_t n, Compare comp)
+{
+    HPX_TEST(c[n] == sorted[n]);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        if (comp(c[n], c[i]))
+        {
+            HPX_TEST(false);
+            break;
+        }
+    }
+    for (std::size_t i = n + 1; i < c.size(); ++i)
+    {
+        if (comp(c[i], c[n]))
+        {
+            HPX_TEST(false);
+            break;
+        }
+    }
+}
+
+template <typename Generate>
+void test_nth_element(Generate generate)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::uint64_t> data(size);
+        std::generate(std::begin(data), std::end(data), generate);
+
+        std::vector<std::uint64_t> sorted = data;
+        std::sort(std::begin(sorted), std::end(sorted));
+
+        for (std::size_t n : {std::size_t(0), size / 3, size / 2, size - 1})
+        {
+            if (n >= size)
+            {
+                continue;
+            }
+
+            std::vector<std::uint64_t> c = data;
+            hpx::nth_element(std::begin(c), std::begin(c) + n, std::end(c));
+            verify_nth_element(c, sorted, n, std::less<std::uint64_t>());
+
+            c = data;
+            hpx::nth_element(hpx::execution::seq, std::begin(c),
+                std::begin(c) + n, std::end(c));
+            verify_nth_element(c, sorted, n, std::less<std::uint64_t>());
+
+            c = data;
+            hpx::nth_element(hpx::execution::par, std::begin(c),
+                std::begin(c) + n, std::end(c));
+            verify_nth_element(c, sorted, n, std::less<std::uint64_t>());
+
+            c = data;
+            hpx::nth_element(hpx::execution::par_unseq, std::begin(c),
+                std::begin(c) + n, std::end(c));
+            verify_nth_element(c, sorted, n, std::less<std::uint64_t>());
+
+            c = data;
+            hpx::future<void> f = hpx::nth_element(hpx::execution::par(
+                                                       hpx::execution::task),
+                std::begin(c), std::begin(c) + n, std::end(c));
+            f.get();
+            verify_nth_element(c, sorted, n, std::less<std::uint64_t>());
+        }
+    }
+}
+
+void test_nth_element_comp()
+{
+    std::vector<double> data(1000003);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (auto& d : data)
+    {
+        d = dist(gen);
+    }
+
+    std::vector<double> sorted = data;
+    std::sort(std::begin(sorted), std::end(sorted), std::greater<double>());
+
+    for (std::size_t n : {std::size_t(10), data.size() / 2})
+    {
+        std::vector<double> c = data;
+        hpx::nth_element(hpx::execution::par, std::begin(c), std::begin(c) + n,
+            std::end(c), std::greater<double>());
+        verify_nth_element(c, sorted, n, std::greater<double>());
+    }
+}
+
+void test_nth_element_exception()
+{
+    std::vector<std::uint64_t> c(1000003);
+    std::iota(std::begin(c), std::end(c), 0);
+    std::shuffle(std::begin(c), std::end(c), gen);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::nth_element(hpx::execution::par, std::begin(c),
+            std::begin(c) + c.size() / 2, std::end(c),
+            [](std::uint64_t, std::uint64_t) -> bool {
+                throw std::runtime_error("test");
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_nth_element([]() { return std::uint64_t(gen()); });
+    test_nth_element([]() { return std::uint64_t(gen() % 7); });
+    test_nth_element([]() { return std::uint64_t(42); });
+    test_nth_element_comp();
+    test_nth_element_exception();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
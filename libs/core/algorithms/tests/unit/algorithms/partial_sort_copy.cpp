@@ -0,0 +1,149 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the larger sizes are handled in parallel
+constexpr std::size_t sizes[] = {0, 1, 1000, 100007, 1000003};
+
+template <typename ExPolicy, typename Generate>
+void test_partial_sort_copy(ExPolicy policy, Generate generate)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::uint64_t> data(size);
+        std::generate(std::begin(data), std::end(data), generate);
+
+        std::vector<std::uint64_t> sorted = data;
+        std::sort(std::begin(sorted), std::end(sorted));
+
+        for (std::size_t count : {std::size_t(0), std::size_t(1),
+                 std::size_t(100), size / 2, size, size + 10})
+        {
+            std::vector<std::uint64_t> c(count);
+            auto result = hpx::partial_sort_copy(policy, std::begin(data),
+                std::end(data), std::begin(c), std::end(c));
+
+            std::size_t const n = (std::min)(size, count);
+            HPX_TEST(result == std::begin(c) + n);
+            HPX_TEST(std::equal(
+                std::begin(c), std::begin(c) + n, std::begin(sorted)));
+        }
+    }
+}
+
+template <typename Generate>
+void test_partial_sort_copy(Generate generate)
+{
+    using namespace hpx::execution;
+
+    test_partial_sort_copy(seq, generate);
+    test_partial_sort_copy(par, generate);
+    test_partial_sort_copy(par_unseq, generate);
+}
+
+void test_partial_sort_copy_async()
+{
+    std::vector<std::uint64_t> data(1000003);
+    std::generate(
+        std::begin(data), std::end(data), []() { return std::uint64_t(gen()); });
+
+    std::vector<std::uint64_t> sorted = data;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    std::vector<std::uint64_t> c(1000);
+    hpx::future<std::vector<std::uint64_t>::iterator> f =
+        hpx::partial_sort_copy(hpx::execution::par(hpx::execution::task),
+            std::begin(data), std::end(data), std::begin(c), std::end(c));
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(sorted)));
+}
+
+void test_partial_sort_copy_comp()
+{
+    // use a forward iterator and a custom comparison
+    std::list<double> data;
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (std::size_t i = 0; i != 1000003; ++i)
+    {
+        data.push_back(dist(gen));
+    }
+
+    std::vector<double> sorted(std::begin(data), std::end(data));
+    std::sort(std::begin(sorted), std::end(sorted), std::greater<double>());
+
+    std::vector<double> c(10007);
+    auto result = hpx::partial_sort_copy(hpx::execution::par, std::begin(data),
+        std::end(data), std::begin(c), std::end(c), std::greater<double>());
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(sorted)));
+
+    std::fill(std::begin(c), std::end(c), 0.0);
+    result = hpx::partial_sort_copy(std::begin(data), std::end(data),
+        std::begin(c), std::end(c), std::greater<double>());
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(sorted)));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_partial_sort_copy([]() { return std::uint64_t(gen()); });
+    test_partial_sort_copy([]() { return std::uint64_t(gen() % 7); });
+    test_partial_sort_copy_async();
+    test_partial_sort_copy_comp();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -145,6 +145,17 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+void test_sort3()
+{
+    using namespace hpx::execution;
+
+    test_sort3(seq, int(), 1);
+    test_sort3(par, int(), 1);
+    test_sort3(par, int(), 7);
+    test_sort3(par, double(), 1000);
+    test_sort3(par_unseq, int(), 100);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -157,6 +168,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
     sort_benchmark();
 
     return hpx::local::finalize();
@@ -0,0 +1,360 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// the radix sort is used for ranges of at least 64k elements only
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 17)
+#else
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 20)
+#endif
+
+std::size_t const radix_sort_threshold = 65536;
+
+std::mt19937 gen;
+
+template <typename It, typename Compare,
+    typename Proj = hpx::parallel::util::projection_identity>
+constexpr bool is_radix_sortable()
+{
+    return hpx::parallel::v1::detail::is_radix_sortable_v<It, Compare, Proj>;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> random_keys(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        for (auto& elem : c)
+        {
+            elem = dist(gen);
+        }
+    }
+    else
+    {
+        // uniform_int_distribution is not defined for character types
+        using dist_type = std::conditional_t<std::is_signed_v<T>,
+            std::int64_t, std::uint64_t>;
+        std::uniform_int_distribution<dist_type> dist(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        for (auto& elem : c)
+        {
+            elem = static_cast<T>(dist(gen));
+        }
+    }
+    return c;
+}
+
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort(ExPolicy&& policy, std::vector<T> c, Compare comp)
+{
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, c.begin(), c.end(), comp);
+
+    HPX_TEST(std::is_sorted(c.begin(), c.end(), comp));
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all supported key types, in ascending and descending order
+template <typename T>
+void test_radix_keys()
+{
+    using namespace hpx::execution;
+    using iterator = typename std::vector<T>::iterator;
+
+    static_assert(is_radix_sortable<iterator, std::less<T>>(),
+        "std::less<T> is radix sorted");
+    static_assert(is_radix_sortable<iterator, std::greater<>>(),
+        "std::greater<> is radix sorted");
+
+    test_sort(par, random_keys<T>(HPX_RADIX_SORT_TEST_SIZE), std::less<T>());
+    test_sort(par, random_keys<T>(HPX_RADIX_SORT_TEST_SIZE), std::less<>());
+    test_sort(
+        par_unseq, random_keys<T>(HPX_RADIX_SORT_TEST_SIZE), std::greater<>());
+    test_sort(
+        par, random_keys<T>(HPX_RADIX_SORT_TEST_SIZE), std::greater<T>());
+
+    // the default comparison
+    std::vector<T> c = random_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end());
+
+    hpx::sort(par, c.begin(), c.end());
+    HPX_TEST(c == expected);
+
+    // asynchronous execution
+    c = random_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::sort(par(task), c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+// user supplied comparisons are not radix sorted
+void test_radix_comparisons()
+{
+    using iterator = std::vector<int>::iterator;
+    auto user_less = [](int lhs, int rhs) { return lhs < rhs; };
+
+    static_assert(!is_radix_sortable<iterator, decltype(user_less)>(),
+        "user supplied comparisons are not radix sorted");
+    static_assert(!is_radix_sortable<iterator, std::less<std::string>>(),
+        "mismatching comparisons are not radix sorted");
+    static_assert(!is_radix_sortable<std::vector<std::string>::iterator,
+                      std::less<>>(),
+        "non-arithmetic keys are not radix sorted");
+
+    test_sort(hpx::execution::par,
+        random_keys<int>(HPX_RADIX_SORT_TEST_SIZE), user_less);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// negative zero, infinities, denormals and the extreme values of floating
+// point keys
+template <typename T>
+void test_radix_special_values()
+{
+    using namespace hpx::execution;
+    using limits = std::numeric_limits<T>;
+
+    std::vector<T> const special = {-T(0), T(0), limits::infinity(),
+        -limits::infinity(), (limits::max)(), limits::lowest(),
+        (limits::min)(), -(limits::min)(), limits::denorm_min(),
+        -limits::denorm_min(), T(1), T(-1)};
+
+    std::vector<T> c = random_keys<T>(HPX_RADIX_SORT_TEST_SIZE);
+    for (std::size_t i = 0; i != c.size(); i += 7)
+    {
+        c[i] = special[(i / 7) % special.size()];
+    }
+
+    test_sort(par, c, std::less<>());
+    test_sort(par, c, std::greater<>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// passes over digits shared by all elements are skipped
+void test_radix_uniform_digits()
+{
+    using namespace hpx::execution;
+
+    // all elements are equal
+    test_sort(par,
+        std::vector<std::uint64_t>(HPX_RADIX_SORT_TEST_SIZE, 42),
+        std::less<>());
+
+    // the elements differ in the most significant byte only
+    std::vector<std::uint64_t> c = random_keys<std::uint64_t>(
+        HPX_RADIX_SORT_TEST_SIZE);
+    for (auto& elem : c)
+    {
+        elem = (elem >> 56) << 56;
+    }
+    test_sort(par, c, std::less<>());
+
+    // the elements differ in the least significant byte only
+    c = random_keys<std::uint64_t>(HPX_RADIX_SORT_TEST_SIZE);
+    for (auto& elem : c)
+    {
+        elem = 0x0102030405060700ull | (elem & 0xff);
+    }
+    test_sort(par, c, std::greater<>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ranges right below and at the size threshold of the radix sort
+void test_radix_threshold()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1),
+             radix_sort_threshold - 1, radix_sort_threshold,
+             radix_sort_threshold + 1})
+    {
+        test_sort(par, random_keys<std::int32_t>(size), std::less<>());
+        test_sort(par, random_keys<double>(size), std::greater<>());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// call sort on records using a projection to an arithmetic key, which covers
+// negative keys (and negative zero and infinities for floating point keys)
+template <typename T>
+struct sort_record
+{
+    T key;
+    std::size_t index;
+};
+
+template <typename ExPolicy, typename T, typename Compare>
+void test_radix_projected(ExPolicy&& policy, T, Compare comp)
+{
+    static_assert(
+        is_radix_sortable<typename std::vector<sort_record<T>>::iterator,
+            Compare, T sort_record<T>::*>(),
+        "projections to arithmetic keys are radix sorted");
+
+    std::vector<sort_record<T>> c(HPX_RADIX_SORT_TEST_SIZE);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i].key = static_cast<T>(std::rand() % 20001 - 10000);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            c[i].key /= 7;
+        }
+        c[i].index = i;
+    }
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        c[0].key = -T(0);
+        c[1].key = (std::numeric_limits<T>::infinity)();
+        c[2].key = -(std::numeric_limits<T>::infinity)();
+    }
+
+    std::vector<sort_record<T>> expected(c);
+    std::stable_sort(std::begin(expected), std::end(expected),
+        [&](sort_record<T> const& lhs, sort_record<T> const& rhs) {
+            return comp(lhs.key, rhs.key);
+        });
+
+    hpx::sort(std::forward<ExPolicy>(policy), c.begin(), c.end(), comp,
+        &sort_record<T>::key);
+
+    // the order of the elements with equal keys is unspecified
+    std::vector<T> keys(c.size());
+    std::vector<T> expected_keys(c.size());
+    std::vector<std::size_t> indices(c.size());
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        keys[i] = c[i].key;
+        expected_keys[i] = expected[i].key;
+        indices[i] = c[i].index;
+    }
+    std::sort(std::begin(indices), std::end(indices));
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end(), comp));
+    HPX_TEST(keys == expected_keys);
+
+    bool is_permutation = true;
+    for (std::size_t i = 0; i != indices.size(); ++i)
+    {
+        is_permutation = is_permutation && indices[i] == i;
+    }
+    HPX_TEST(is_permutation);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sort_by_key radix sorts arithmetic keys as well
+void test_radix_sort_by_key()
+{
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    using namespace hpx::execution;
+
+    std::vector<std::int64_t> keys =
+        random_keys<std::int64_t>(HPX_RADIX_SORT_TEST_SIZE);
+    std::vector<std::int64_t> values(keys);
+
+    hpx::parallel::sort_by_key(par, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    HPX_TEST(keys == values);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+    gen.seed(seed);
+
+    test_radix_keys<std::int8_t>();
+    test_radix_keys<std::uint8_t>();
+    test_radix_keys<std::int16_t>();
+    test_radix_keys<std::uint16_t>();
+    test_radix_keys<std::int32_t>();
+    test_radix_keys<std::uint32_t>();
+    test_radix_keys<std::int64_t>();
+    test_radix_keys<std::uint64_t>();
+    test_radix_keys<float>();
+    test_radix_keys<double>();
+
+    test_radix_comparisons();
+
+    test_radix_special_values<float>();
+    test_radix_special_values<double>();
+
+    test_radix_uniform_digits();
+    test_radix_threshold();
+
+    {
+        using namespace hpx::execution;
+
+        test_radix_projected(seq, int(), std::less<int>());
+        test_radix_projected(par, int(), std::less<int>());
+        test_radix_projected(par, std::int64_t(), std::greater<>());
+        test_radix_projected(par, float(), std::less<>());
+        test_radix_projected(par_unseq, double(), std::greater<double>());
+    }
+
+    test_radix_sort_by_key();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -630,6 +630,46 @@ void test_sort2_async(ExPolicy&& policy, T, Compare comp = Compare())
     HPX_TEST(is_sorted);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// many duplicates, arithmetic values compared using the default order are
+// radix sorted, use a user supplied comparison to exercise the sample sort
+template <typename T>
+struct user_less
+{
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_sort3(ExPolicy&& policy, T, int num_values)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "user", sync, duplicates);
+
+    // Fill vector with a small number of distinct values
+    std::vector<T> c(HPX_SORT_TEST_SIZE);
+    for (auto& elem : c)
+    {
+        elem = static_cast<T>(std::rand() % num_values);
+    }
+
+    std::vector<T> expected(c);
+    std::sort(std::begin(expected), std::end(expected));
+
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    // sort, blocking when seq, par, par_vec
+    hpx::sort(
+        std::forward<ExPolicy>(policy), c.begin(), c.end(), user_less<T>());
+    std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify_(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+    HPX_TEST(c == expected);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // overload of test routine 1 for strings
 // call sort on a string array with no comparison operator
@@ -30,6 +30,9 @@ void stable_partition_test()
 {
     test_stable_partition<std::random_access_iterator_tag>();
     test_stable_partition<std::bidirectional_iterator_tag>();
+
+    test_stable_partition_large(hpx::execution::seq);
+    test_stable_partition_large(hpx::execution::par);
 }
 
 template <typename IteratorTag>
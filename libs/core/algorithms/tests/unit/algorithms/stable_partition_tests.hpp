@@ -9,7 +9,9 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -107,6 +109,28 @@ void test_stable_partition(ExPolicy policy, IteratorTag)
     HPX_TEST_EQ(count, d.size());
 }
 
+// the partitions of large sequences are merged in parallel
+template <typename ExPolicy>
+void test_stable_partition_large(ExPolicy policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c(1 << 20);
+    std::generate(std::begin(c), std::end(c), std::rand);
+    std::vector<int> d = c;
+
+    int partition_at = RAND_MAX / 3;
+
+    auto result = hpx::parallel::stable_partition(
+        policy, std::begin(c), std::end(c), less_than(partition_at));
+
+    auto partition_pt = std::stable_partition(
+        std::begin(d), std::end(d), less_than(partition_at));
+    HPX_TEST(result - std::begin(c) == partition_pt - std::begin(d));
+    HPX_TEST(c == d);
+}
+
 template <typename ExPolicy, typename IteratorTag>
 void test_stable_partition_async(ExPolicy p, IteratorTag)
 {
@@ -0,0 +1,208 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/tests/iter_sent.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// large enough to be partitioned in parallel
+#define ARR_SIZE 1000003
+
+struct element
+{
+    std::int64_t key;
+    std::int64_t payload;
+};
+
+std::vector<element> make_data(std::size_t size)
+{
+    std::vector<element> data(size);
+    std::int64_t i = 0;
+    for (auto& e : data)
+    {
+        e.key = std::int64_t(gen() % 1000) - 500;
+        e.payload = i++;
+    }
+    return data;
+}
+
+std::int64_t sorted_key(std::vector<element> const& data, std::size_t n)
+{
+    std::vector<std::int64_t> keys(data.size());
+    std::transform(std::begin(data), std::end(data), std::begin(keys),
+        [](element const& e) { return e.key; });
+    std::nth_element(std::begin(keys), std::begin(keys) + n, std::end(keys));
+    return keys[n];
+}
+
+bool verify(std::vector<element> const& c, std::size_t n, std::int64_t key)
+{
+    return c[n].key == key &&
+        std::all_of(std::begin(c), std::begin(c) + n,
+            [&](element const& e) { return e.key <= key; }) &&
+        std::all_of(std::begin(c) + n, std::end(c),
+            [&](element const& e) { return e.key >= key; });
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy policy)
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::size_t const n = ARR_SIZE / 3;
+    std::int64_t const key = sorted_key(data, n);
+
+    std::vector<element> c = data;
+    auto result = hpx::ranges::nth_element(policy, c, std::begin(c) + n,
+        hpx::ranges::less(), &element::key);
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(verify(c, n, key));
+
+    c = data;
+    result = hpx::ranges::nth_element(policy, std::begin(c), std::begin(c) + n,
+        std::end(c), hpx::ranges::less(), &element::key);
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(verify(c, n, key));
+}
+
+void test_nth_element()
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::size_t const n = ARR_SIZE / 2;
+    std::int64_t const key = sorted_key(data, n);
+
+    std::vector<element> c = data;
+    auto result = hpx::ranges::nth_element(
+        c, std::begin(c) + n, hpx::ranges::less(), &element::key);
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(verify(c, n, key));
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy policy)
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::size_t const n = 17;
+    std::int64_t const key = sorted_key(data, n);
+
+    std::vector<element> c = data;
+    auto f = hpx::ranges::nth_element(
+        policy, c, std::begin(c) + n, hpx::ranges::less(), &element::key);
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(verify(c, n, key));
+}
+
+template <typename ExPolicy>
+void test_nth_element_sender(ExPolicy&& policy)
+{
+    namespace ex = hpx::execution::experimental;
+
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::size_t const n = ARR_SIZE - 17;
+    std::int64_t const key = sorted_key(data, n);
+
+    std::vector<element> c = data;
+    auto rng = hpx::util::make_iterator_range(std::begin(c), std::end(c));
+    auto result = ex::just(rng, std::begin(c) + n, hpx::ranges::less(),
+                      &element::key) |
+        hpx::ranges::nth_element(std::forward<ExPolicy>(policy)) |
+        ex::sync_wait();
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(verify(c, n, key));
+}
+
+template <typename ExPolicy>
+void test_nth_element_sent(ExPolicy policy)
+{
+    // the largest value marks the end of the sequence
+    std::vector<std::size_t> c(ARR_SIZE);
+    std::iota(std::begin(c), std::end(c), 0);
+    std::shuffle(std::begin(c), std::end(c) - 1, gen);
+
+    std::size_t const n = ARR_SIZE / 2;
+    auto result = hpx::ranges::nth_element(policy, std::begin(c),
+        std::begin(c) + n, sentinel<std::size_t>{ARR_SIZE - 1});
+
+    HPX_TEST(result == std::end(c) - 1);
+    HPX_TEST_EQ(c[n], n);
+    HPX_TEST(std::all_of(std::begin(c), std::begin(c) + n,
+        [](std::size_t v) { return v < n; }));
+    HPX_TEST_EQ(c.back(), std::size_t(ARR_SIZE - 1));
+}
+
+void nth_element_test()
+{
+    using namespace hpx::execution;
+
+    test_nth_element();
+    test_nth_element(seq);
+    test_nth_element(par);
+    test_nth_element(par_unseq);
+
+    test_nth_element_async(seq(task));
+    test_nth_element_async(par(task));
+
+    test_nth_element_sender(seq);
+    test_nth_element_sender(par);
+    test_nth_element_sender(par(task));
+
+    test_nth_element_sent(seq);
+    test_nth_element_sent(par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    nth_element_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
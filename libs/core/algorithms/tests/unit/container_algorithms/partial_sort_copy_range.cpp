@@ -0,0 +1,312 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/tests/iter_sent.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// large enough to be handled in parallel
+#define ARR_SIZE 1000003
+
+struct element
+{
+    std::int64_t key;
+    std::int64_t payload;
+};
+
+std::vector<element> make_data(std::size_t size)
+{
+    std::vector<element> data(size);
+    std::int64_t i = 0;
+    for (auto& e : data)
+    {
+        e.key = std::int64_t(gen() % 100000) - 50000;
+        e.payload = i++;
+    }
+    return data;
+}
+
+std::vector<std::int64_t> sorted_keys(std::vector<element> const& data)
+{
+    std::vector<std::int64_t> keys(data.size());
+    std::transform(std::begin(data), std::end(data), std::begin(keys),
+        [](element const& e) { return e.key; });
+    std::sort(std::begin(keys), std::end(keys));
+    return keys;
+}
+
+bool verify(std::vector<element> const& c, std::size_t n,
+    std::vector<std::int64_t> const& keys)
+{
+    return std::equal(std::begin(c), std::begin(c) + n, std::begin(keys),
+        [](element const& e, std::int64_t key) { return e.key == key; });
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy policy)
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::vector<std::int64_t> const keys = sorted_keys(data);
+
+    for (std::size_t count : {std::size_t(0), std::size_t(1000),
+             std::size_t(ARR_SIZE / 2), std::size_t(ARR_SIZE + 1)})
+    {
+        std::vector<element> c(count);
+        auto result = hpx::ranges::partial_sort_copy(
+            policy, data, c, hpx::ranges::less(), &element::key);
+
+        std::size_t const n = (std::min)(count, data.size());
+        HPX_TEST(result.in == std::end(data));
+        HPX_TEST(result.out == std::begin(c) + n);
+        HPX_TEST(verify(c, n, keys));
+
+        std::vector<element> d(count);
+        auto result2 = hpx::ranges::partial_sort_copy(policy, std::begin(data),
+            std::end(data), std::begin(d), std::end(d), hpx::ranges::less(),
+            &element::key);
+
+        HPX_TEST(result2.in == std::end(data));
+        HPX_TEST(result2.out == std::begin(d) + n);
+        HPX_TEST(verify(d, n, keys));
+    }
+}
+
+void test_partial_sort_copy()
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::vector<std::int64_t> const keys = sorted_keys(data);
+
+    std::vector<element> c(1000);
+    auto result = hpx::ranges::partial_sort_copy(
+        data, c, hpx::ranges::less(), &element::key);
+
+    HPX_TEST(result.in == std::end(data));
+    HPX_TEST(result.out == std::end(c));
+    HPX_TEST(verify(c, c.size(), keys));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy policy)
+{
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::vector<std::int64_t> const keys = sorted_keys(data);
+
+    std::vector<element> c(ARR_SIZE / 3);
+    auto f = hpx::ranges::partial_sort_copy(
+        policy, data, c, hpx::ranges::less(), &element::key);
+
+    auto result = f.get();
+    HPX_TEST(result.in == std::end(data));
+    HPX_TEST(result.out == std::end(c));
+    HPX_TEST(verify(c, c.size(), keys));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_sender(ExPolicy&& policy)
+{
+    namespace ex = hpx::execution::experimental;
+
+    std::vector<element> const data = make_data(ARR_SIZE);
+    std::vector<std::int64_t> const keys = sorted_keys(data);
+
+    std::vector<element> c(100);
+    auto rng1 = hpx::util::make_iterator_range(std::begin(data), std::end(data));
+    auto rng2 = hpx::util::make_iterator_range(std::begin(c), std::end(c));
+
+    auto result = ex::just(rng1, rng2, hpx::ranges::less(), &element::key) |
+        hpx::ranges::partial_sort_copy(std::forward<ExPolicy>(policy)) |
+        ex::sync_wait();
+
+    HPX_TEST(result.in == std::end(data));
+    HPX_TEST(result.out == std::end(c));
+    HPX_TEST(verify(c, c.size(), keys));
+}
+
+// the elements of the source and the destination range are projected
+// separately
+struct record
+{
+    record() = default;
+
+    record(std::int64_t k)
+      : key(k)
+    {
+    }
+
+    std::int64_t key = 0;
+};
+
+template <typename ExPolicy>
+void test_partial_sort_copy_proj(ExPolicy policy)
+{
+    std::vector<std::int64_t> data(ARR_SIZE);
+    for (auto& value : data)
+    {
+        value = std::int64_t(gen() % 100000) - 50000;
+    }
+
+    std::vector<std::int64_t> keys(data);
+    std::sort(std::begin(keys), std::end(keys), std::greater<>());
+
+    auto negate = [](std::int64_t value) { return -value; };
+    auto negate_key = [](record const& r) { return -r.key; };
+
+    for (std::size_t count : {std::size_t(0), std::size_t(1000),
+             std::size_t(ARR_SIZE / 2), std::size_t(ARR_SIZE + 1)})
+    {
+        std::size_t const n = (std::min)(count, data.size());
+
+        std::vector<record> c(count);
+        auto result = hpx::ranges::partial_sort_copy(
+            policy, data, c, hpx::ranges::less(), negate, negate_key);
+
+        HPX_TEST(result.in == std::end(data));
+        HPX_TEST(result.out == std::begin(c) + n);
+        HPX_TEST(std::equal(std::begin(c), std::begin(c) + n,
+            std::begin(keys),
+            [](record const& r, std::int64_t key) { return r.key == key; }));
+
+        std::vector<record> d(count);
+        auto result2 = hpx::ranges::partial_sort_copy(policy, std::begin(data),
+            std::end(data), std::begin(d), std::end(d), hpx::ranges::less(),
+            hpx::parallel::util::projection_identity(), &record::key);
+
+        std::vector<std::int64_t> ascending(data);
+        std::sort(std::begin(ascending), std::end(ascending));
+
+        HPX_TEST(result2.in == std::end(data));
+        HPX_TEST(result2.out == std::begin(d) + n);
+        HPX_TEST(std::equal(std::begin(d), std::begin(d) + n,
+            std::begin(ascending),
+            [](record const& r, std::int64_t key) { return r.key == key; }));
+    }
+}
+
+void test_partial_sort_copy_proj()
+{
+    std::vector<std::int64_t> data(ARR_SIZE);
+    for (auto& value : data)
+    {
+        value = std::int64_t(gen() % 100000) - 50000;
+    }
+
+    std::vector<std::int64_t> keys(data);
+    std::sort(std::begin(keys), std::end(keys));
+
+    std::vector<record> c(1000);
+    auto result = hpx::ranges::partial_sort_copy(data, c, hpx::ranges::less(),
+        hpx::parallel::util::projection_identity(), &record::key);
+
+    HPX_TEST(result.in == std::end(data));
+    HPX_TEST(result.out == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(keys),
+        [](record const& r, std::int64_t key) { return r.key == key; }));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_sent(ExPolicy policy)
+{
+    // the largest value marks the end of the sequence
+    std::vector<std::size_t> data(ARR_SIZE);
+    std::iota(std::begin(data), std::end(data), 0);
+    std::shuffle(std::begin(data), std::end(data) - 1, gen);
+
+    std::vector<std::size_t> c(ARR_SIZE);
+    auto result = hpx::ranges::partial_sort_copy(policy, std::begin(data),
+        sentinel<std::size_t>{ARR_SIZE - 1}, std::begin(c), std::end(c));
+
+    HPX_TEST(result.in == std::end(data) - 1);
+    HPX_TEST(result.out == std::end(c) - 1);
+    for (std::size_t i = 0; i != ARR_SIZE - 1; ++i)
+    {
+        if (c[i] != i)
+        {
+            HPX_TEST_EQ(c[i], i);
+            break;
+        }
+    }
+}
+
+void partial_sort_copy_test()
+{
+    using namespace hpx::execution;
+
+    test_partial_sort_copy();
+    test_partial_sort_copy(seq);
+    test_partial_sort_copy(par);
+    test_partial_sort_copy(par_unseq);
+
+    test_partial_sort_copy_proj();
+    test_partial_sort_copy_proj(seq);
+    test_partial_sort_copy_proj(par);
+
+    test_partial_sort_copy_async(seq(task));
+    test_partial_sort_copy_async(par(task));
+
+    test_partial_sort_copy_sender(seq);
+    test_partial_sort_copy_sender(par);
+    test_partial_sort_copy_sender(par(task));
+
+    test_partial_sort_copy_sent(seq);
+    test_partial_sort_copy_sent(par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_copy_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
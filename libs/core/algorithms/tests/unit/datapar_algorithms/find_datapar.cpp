@@ -0,0 +1,155 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/all_any_none.hpp>
+#include <hpx/parallel/algorithms/find.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(1, 30);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_find(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    // the sizes exercise the unaligned head and the scalar tail
+    for (std::size_t size : {1, 7, 33, 10007})
+    {
+        std::vector<int> c(size);
+        std::generate(std::begin(c), std::end(c), []() { return dis(gen); });
+
+        // place the searched element at a random position, the element
+        // might be missing from the sequence
+        std::size_t pos = gen() % (size + 1);
+        if (pos != size)
+        {
+            c[pos] = 0;
+        }
+        base_iterator ref = std::begin(c) + pos;
+
+        iterator r1 = hpx::find(
+            policy, iterator(std::begin(c)), iterator(std::end(c)), int(0));
+        HPX_TEST(r1.base() == ref);
+
+        iterator r2 = hpx::find_if(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](auto const& v) { return v == 0; });
+        HPX_TEST(r2.base() == ref);
+
+        iterator r3 = hpx::find_if_not(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](auto const& v) { return v != 0; });
+        HPX_TEST(r3.base() == ref);
+
+        // function objects not accepting vector packs use the scalar path
+        iterator r4 = hpx::find_if(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](int v) { return v == 0; });
+        HPX_TEST(r4.base() == ref);
+
+        bool r5 = hpx::any_of(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](auto const& v) { return v == 0; });
+        HPX_TEST_EQ(r5, pos != size);
+
+        bool r6 = hpx::all_of(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](auto const& v) { return v != 0; });
+        HPX_TEST_EQ(r6, pos == size);
+
+        bool r7 = hpx::none_of(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), [](auto const& v) { return v == 0; });
+        HPX_TEST_EQ(r7, pos == size);
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_find_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return dis(gen); });
+
+    std::size_t pos = gen() % c.size();
+    c[pos] = 0;
+
+    hpx::future<iterator> f = hpx::find_if(p, iterator(std::begin(c)),
+        iterator(std::end(c)), [](auto const& v) { return v == 0; });
+
+    HPX_TEST(f.get().base() == std::begin(c) + pos);
+}
+
+template <typename IteratorTag>
+void test_find()
+{
+    using namespace hpx::execution;
+
+    test_find(simd, IteratorTag());
+    test_find(par_simd, IteratorTag());
+
+    test_find_async(simd(task), IteratorTag());
+    test_find_async(par_simd(task), IteratorTag());
+}
+
+void find_test()
+{
+    test_find<std::random_access_iterator_tag>();
+    test_find<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
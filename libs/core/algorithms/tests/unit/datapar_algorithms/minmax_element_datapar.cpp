@@ -0,0 +1,143 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy&& policy, IteratorTag, int range)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(-range, range);
+
+    // the sizes exercise the unaligned head and the scalar tail, a small
+    // range of values makes sure the first (last) of several equal extrema
+    // is reported
+    for (std::size_t size : {1, 7, 33, 10007})
+    {
+        std::vector<int> c(size);
+        std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+        iterator first(std::begin(c));
+        iterator last(std::end(c));
+
+        iterator r1 = hpx::parallel::min_element(policy, first, last);
+        HPX_TEST(r1.base() == std::min_element(std::begin(c), std::end(c)));
+
+        iterator r2 = hpx::parallel::max_element(policy, first, last);
+        HPX_TEST(r2.base() == std::max_element(std::begin(c), std::end(c)));
+
+        auto r3 = hpx::parallel::minmax_element(
+            policy, first, last, std::less<>());
+        auto ref = std::minmax_element(std::begin(c), std::end(c));
+        HPX_TEST(r3.min.base() == ref.first);
+        HPX_TEST(r3.max.base() == ref.second);
+
+        // function objects not accepting vector packs use the scalar path
+        iterator r4 = hpx::parallel::min_element(
+            policy, first, last, [](int v1, int v2) { return v1 < v2; });
+        HPX_TEST(r4.base() == std::min_element(std::begin(c), std::end(c)));
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c = test::random_iota<int>(10007);
+
+    auto f = hpx::parallel::minmax_element(
+        p, iterator(std::begin(c)), iterator(std::end(c)));
+
+    auto r = f.get();
+    auto ref = std::minmax_element(std::begin(c), std::end(c));
+    HPX_TEST(r.min.base() == ref.first);
+    HPX_TEST(r.max.base() == ref.second);
+}
+
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    for (int range : {3, 1000000})
+    {
+        test_minmax_element(simd, IteratorTag(), range);
+        test_minmax_element(par_simd, IteratorTag(), range);
+    }
+
+    test_minmax_element_async(simd(task), IteratorTag());
+    test_minmax_element_async(par_simd(task), IteratorTag());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,161 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+#include <hpx/parallel/algorithms/mismatch.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(1, 30);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_mismatch(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    // the sizes exercise the scalar tail
+    for (std::size_t size : {1, 7, 33, 10007})
+    {
+        std::vector<int> c1(size);
+        std::generate(std::begin(c1), std::end(c1), []() { return dis(gen); });
+
+        // the second sequence is shifted to be misaligned relative to the
+        // first one
+        std::vector<int> buffer(size + 1);
+        std::copy(std::begin(c1), std::end(c1), std::begin(buffer) + 1);
+        base_iterator begin2 = std::begin(buffer) + 1;
+
+        // introduce a mismatch at a random position, the sequences might
+        // be equal
+        std::size_t pos = gen() % (size + 1);
+        if (pos != size)
+        {
+            ++begin2[pos];
+        }
+
+        iterator end1(std::end(c1));
+        auto r1 = hpx::mismatch(
+            policy, iterator(std::begin(c1)), end1, iterator(begin2));
+        HPX_TEST(r1.first.base() == std::begin(c1) + pos);
+        HPX_TEST(r1.second.base() == begin2 + pos);
+
+        auto r2 = hpx::mismatch(policy, iterator(std::begin(c1)), end1,
+            iterator(begin2), iterator(std::end(buffer)),
+            [](auto const& v1, auto const& v2) { return v1 == v2; });
+        HPX_TEST(r2.first.base() == std::begin(c1) + pos);
+        HPX_TEST(r2.second.base() == begin2 + pos);
+
+        bool r3 = hpx::equal(
+            policy, iterator(std::begin(c1)), end1, iterator(begin2));
+        HPX_TEST_EQ(r3, pos == size);
+
+        bool r4 = hpx::equal(policy, iterator(std::begin(c1)), end1,
+            iterator(begin2), iterator(std::end(buffer)));
+        HPX_TEST_EQ(r4, pos == size);
+
+        // function objects not accepting vector packs use the scalar path
+        bool r5 = hpx::equal(policy, iterator(std::begin(c1)), end1,
+            iterator(begin2), [](int v1, int v2) { return v1 == v2; });
+        HPX_TEST_EQ(r5, pos == size);
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_mismatch_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c1(10007);
+    std::generate(std::begin(c1), std::end(c1), []() { return dis(gen); });
+    std::vector<int> c2 = c1;
+
+    std::size_t pos = gen() % c1.size();
+    ++c2[pos];
+
+    auto f = hpx::mismatch(p, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(std::begin(c2)));
+    HPX_TEST(f.get().first.base() == std::begin(c1) + pos);
+
+    hpx::future<bool> f2 = hpx::equal(p, iterator(std::begin(c1)),
+        iterator(std::end(c1)), iterator(std::begin(c2)));
+    HPX_TEST(!f2.get());
+}
+
+template <typename IteratorTag>
+void test_mismatch()
+{
+    using namespace hpx::execution;
+
+    test_mismatch(simd, IteratorTag());
+    test_mismatch(par_simd, IteratorTag());
+
+    test_mismatch_async(simd(task), IteratorTag());
+    test_mismatch_async(par_simd(task), IteratorTag());
+}
+
+void mismatch_test()
+{
+    test_mismatch<std::random_access_iterator_tag>();
+    test_mismatch<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    mismatch_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,140 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+std::uniform_int_distribution<> dis(-1000, 1000);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_reduce(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    // the sizes exercise the unaligned head and the scalar tail
+    for (std::size_t size : {0, 1, 7, 33, 10007})
+    {
+        std::vector<int> c(size);
+        std::generate(std::begin(c), std::end(c), []() { return dis(gen); });
+
+        int const val = 42;
+        int const ref = std::accumulate(std::begin(c), std::end(c), val);
+
+        // generic function objects are invoked with whole vector packs
+        int r1 = hpx::reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), val,
+            [](auto const& v1, auto const& v2) { return v1 + v2; });
+        HPX_TEST_EQ(r1, ref);
+
+        int r2 = hpx::reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), val, std::plus<>());
+        HPX_TEST_EQ(r2, ref);
+
+        // function objects not accepting vector packs use the scalar path
+        int r3 = hpx::reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), val, [](int v1, int v2) { return v1 + v2; });
+        HPX_TEST_EQ(r3, ref);
+
+        int r4 = hpx::transform_reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), val, std::plus<>(),
+            [](auto const& v) { return v * 2; });
+        HPX_TEST_EQ(r4, 2 * ref - val);
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_reduce_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return dis(gen); });
+
+    int const val = 42;
+    hpx::future<int> f = hpx::reduce(p, iterator(std::begin(c)),
+        iterator(std::end(c)), val, std::plus<>());
+
+    HPX_TEST_EQ(f.get(), std::accumulate(std::begin(c), std::end(c), val));
+}
+
+template <typename IteratorTag>
+void test_reduce()
+{
+    using namespace hpx::execution;
+
+    test_reduce(simd, IteratorTag());
+    test_reduce(par_simd, IteratorTag());
+
+    test_reduce_async(simd(task), IteratorTag());
+    test_reduce_async(par_simd(task), IteratorTag());
+}
+
+void reduce_test()
+{
+    test_reduce<std::random_access_iterator_tag>();
+    test_reduce<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    reduce_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,543 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+
+    namespace detail {
+
+        template <typename Key, typename Entry>
+        struct unordered_cache_node
+        {
+            unordered_cache_node(Key const& key, Entry const& entry)
+              : value_(key, entry)
+              , count_(1)
+            {
+            }
+
+            std::pair<Key, Entry> value_;
+            std::size_t count_;    // number of accesses, used by LFU only
+        };
+    }    // namespace detail
+
+    namespace policies {
+
+        namespace detail {
+
+            template <typename List>
+            struct lru_eviction_impl
+            {
+                using iterator = typename List::iterator;
+
+                iterator insert(List& l, typename List::value_type&& node)
+                {
+                    l.push_front(std::move(node));
+                    return l.begin();
+                }
+
+                void touch(List& l, iterator it)
+                {
+                    l.splice(l.begin(), l, it);
+                }
+
+                iterator victim(List& l)
+                {
+                    return std::prev(l.end());
+                }
+
+                // the entry to evict after the given one, l.end() if none
+                iterator next_victim(List& l, iterator it)
+                {
+                    return it == l.begin() ? l.end() : std::prev(it);
+                }
+
+                void erase(List&, iterator) {}
+
+                void clear() {}
+            };
+
+            template <typename List>
+            struct fifo_eviction_impl
+            {
+                using iterator = typename List::iterator;
+
+                iterator insert(List& l, typename List::value_type&& node)
+                {
+                    l.push_front(std::move(node));
+                    return l.begin();
+                }
+
+                void touch(List&, iterator) {}
+
+                iterator victim(List& l)
+                {
+                    return std::prev(l.end());
+                }
+
+                // the entry to evict after the given one, l.end() if none
+                iterator next_victim(List& l, iterator it)
+                {
+                    return it == l.begin() ? l.end() : std::prev(it);
+                }
+
+                void erase(List&, iterator) {}
+
+                void clear() {}
+            };
+
+            // The entries are kept sorted by their access count, entries with
+            // the same access count form a contiguous group. The last element
+            // of each group is tracked to allow moving an entry to the next
+            // group in constant time.
+            template <typename List>
+            struct lfu_eviction_impl
+            {
+                using iterator = typename List::iterator;
+
+                iterator insert(List& l, typename List::value_type&& node)
+                {
+                    node.count_ = 1;
+
+                    auto g = groups_.find(1);
+                    auto pos =
+                        (g != groups_.end()) ? std::next(g->second) : l.begin();
+
+                    iterator it = l.insert(pos, std::move(node));
+                    groups_[1] = it;
+                    return it;
+                }
+
+                void touch(List& l, iterator it)
+                {
+                    std::size_t const count = it->count_;
+
+                    erase(l, it);
+
+                    auto next_group = groups_.find(count + 1);
+                    if (next_group != groups_.end())
+                    {
+                        l.splice(std::next(next_group->second), l, it);
+                    }
+                    else
+                    {
+                        // if the entry was the only one with this count it
+                        // can stay where it is
+                        auto this_group = groups_.find(count);
+                        if (this_group != groups_.end())
+                        {
+                            l.splice(std::next(this_group->second), l, it);
+                        }
+                    }
+
+                    it->count_ = count + 1;
+                    groups_[count + 1] = it;
+                }
+
+                iterator victim(List& l)
+                {
+                    return l.begin();
+                }
+
+                // the entry to evict after the given one, l.end() if none
+                iterator next_victim(List&, iterator it)
+                {
+                    return std::next(it);
+                }
+
+                // remove the entry from its access count group
+                void erase(List& l, iterator it)
+                {
+                    auto g = groups_.find(it->count_);
+                    if (g != groups_.end() && g->second == it)
+                    {
+                        if (it != l.begin() &&
+                            std::prev(it)->count_ == it->count_)
+                        {
+                            g->second = std::prev(it);
+                        }
+                        else
+                        {
+                            groups_.erase(g);
+                        }
+                    }
+                }
+
+                void clear()
+                {
+                    groups_.clear();
+                }
+
+            private:
+                std::unordered_map<std::size_t, iterator> groups_;
+            };
+        }    // namespace detail
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Evict the least recently used entry first.
+        struct lru_eviction
+        {
+            template <typename List>
+            struct apply
+            {
+                using type = detail::lru_eviction_impl<List>;
+            };
+        };
+
+        /// \brief Evict the entry which was inserted first, regardless of how
+        ///        often or how recently it was accessed.
+        struct fifo_eviction
+        {
+            template <typename List>
+            struct apply
+            {
+                using type = detail::fifo_eviction_impl<List>;
+            };
+        };
+
+        /// \brief Evict the least frequently used entry first. Ties are broken
+        ///        by evicting the least recently used entry.
+        struct lfu_eviction
+        {
+            template <typename List>
+            struct apply
+            {
+                using type = detail::lfu_eviction_impl<List>;
+            };
+        };
+    }    // namespace policies
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class unordered_cache unordered_cache.hpp hpx/cache/unordered_cache.hpp
+    ///
+    /// \brief The \a unordered_cache implements a local (non-distributed)
+    ///        cache backed by a hash table. Looking up, inserting and evicting
+    ///        entries are constant time operations.
+    ///
+    /// The entries are additionally linked in a list ordered according to the
+    /// eviction policy. The interface is the same as the one of the
+    /// \a lru_cache, which allows to use both interchangeably whenever the
+    /// key type is hashable.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam EvictionPolicy The policy deciding which entry to evict if the
+    ///                       cache is full, one of \a policies#lru_eviction
+    ///                       (the default), \a policies#lfu_eviction, or
+    ///                       \a policies#fifo_eviction.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    /// \tparam Hash          The hash function to use for the keys.
+    /// \tparam KeyEqual      The function object used to compare keys.
+    template <typename Key, typename Entry,
+        typename EvictionPolicy = policies::lru_eviction,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class unordered_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using eviction_policy_type = EvictionPolicy;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using node_type = detail::unordered_cache_node<key_type, entry_type>;
+        using storage_type = std::list<node_type>;
+        using map_type = std::unordered_map<key_type,
+            typename storage_type::iterator, Hash, KeyEqual>;
+
+        using policy_type = typename eviction_policy_type::template apply<
+            storage_type>::type;
+
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of an unordered_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time. The default is zero
+        ///                   (no size limitation).
+        explicit unordered_cache(size_type max_size = 0)
+          : max_size_(max_size)
+        {
+            if (max_size_ != 0)
+            {
+                map_.reserve(max_size_);
+            }
+        }
+
+        unordered_cache(unordered_cache&& other) = default;
+        unordered_cache& operator=(unordered_cache&& other) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        size_type size() const
+        {
+            return map_.size();
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        /// \brief Change the maximum size this cache can grow to, evicting
+        ///        entries if the new size is smaller than the current one.
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            while (max_size_ != 0 && map_.size() > max_size_)
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key. This does not touch the entry.
+        bool holds_key(key_type const& key) const
+        {
+            return map_.find(key) != map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key, touching
+        ///        the entry if found.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            policy_.touch(storage_, it->second);
+
+            // update statistics
+            statistics_.got_hit();
+
+            realkey = it->first;
+            entry = it->second->value_.second;
+            return true;
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache, returns \a false if an
+        ///        entry with the given key is already held by the cache.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+            if (map_.find(key) != map_.end())
+            {
+                return false;
+            }
+
+            insert_nonexist(key, entry);
+            return true;
+        }
+
+        /// \brief Insert a new entry into this cache, the entry must not be
+        ///        held by the cache already.
+        void insert_nonexist(key_type const& key, entry_type const& entry)
+        {
+            // make room for the new entry first
+            if (max_size_ != 0 && map_.size() >= max_size_)
+            {
+                evict();
+            }
+
+            auto it = policy_.insert(storage_, node_type(key, entry));
+            map_.emplace(key, it);
+
+            // update statistics
+            statistics_.got_insertion();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, inserting it if
+        ///        it is not held by the cache yet. Touches the entry.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return;
+            }
+
+            it->second->value_.second = entry;
+            policy_.touch(storage_, it->second);
+
+            // update statistics
+            statistics_.got_hit();
+        }
+
+        /// \brief Update an existing element in this cache, inserting it if
+        ///        it is not held by the cache yet. The update of an existing
+        ///        element is aborted if \a f, invoked with \a key and the key
+        ///        found in the cache, returns \a true (this is consistent with
+        ///        \a lru_cache#update_if).
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return true;
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            policy_.touch(storage_, it->second);
+            it->second->value_.second = entry;
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true. The function object is invoked
+        ///        with a \a std::pair<key_type, entry_type>.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (auto it = map_.begin(); it != map_.end();)
+            {
+                auto jt = it->second;
+                if (ep(jt->value_))
+                {
+                    ++erased;
+
+                    policy_.erase(storage_, jt);
+                    storage_.erase(jt);
+                    it = map_.erase(it);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        size_type clear()
+        {
+            size_type erased = map_.size();
+            map_.clear();
+            storage_.clear();
+            policy_.clear();
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        void evict()
+        {
+            auto it = policy_.victim(storage_);
+
+            statistics_.got_eviction();
+
+            policy_.erase(storage_, it);
+            map_.erase(it->value_.first);
+            storage_.erase(it);
+        }
+
+        size_type max_size_;
+
+        storage_type storage_;
+        map_type map_;
+
+        policy_type policy_;
+        statistics_type statistics_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A hash table based drop-in replacement for \a lru_cache
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics>
+    using unordered_lru_cache =
+        unordered_cache<Key, Entry, policies::lru_eviction, Statistics>;
+}}}    // namespace hpx::util::cache
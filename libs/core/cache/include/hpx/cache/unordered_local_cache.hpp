@@ -0,0 +1,444 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/cache/unordered_cache.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class unordered_local_cache unordered_local_cache.hpp hpx/cache/unordered_local_cache.hpp
+    ///
+    /// \brief The \a unordered_local_cache is a hash table based variant of
+    ///        the \a local_cache. Looking up, inserting and evicting entries
+    ///        are constant time operations.
+    ///
+    /// The entries must model the CacheEntry concept, as for the
+    /// \a local_cache. The order in which entries are evicted is however
+    /// decided by the \a EvictionPolicy instead of a heap sorted by an
+    /// UpdatePolicy, which would require to be rebuilt whenever an entry is
+    /// touched. The entry's \a entry#touch function is still invoked, but its
+    /// return value is ignored.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache,
+    ///                       must model the CacheEntry concept
+    /// \tparam EvictionPolicy The policy deciding which entry to evict if the
+    ///                       cache is full, one of \a policies#lru_eviction
+    ///                       (the default), \a policies#lfu_eviction, or
+    ///                       \a policies#fifo_eviction.
+    /// \tparam InsertPolicy  A (optional) type specifying a (unary) function
+    ///                       object used to allow global decisions whether a
+    ///                       particular entry should be added to the cache or
+    ///                       not. The default is \a policies#always.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics.
+    /// \tparam Hash          The hash function to use for the keys.
+    /// \tparam KeyEqual      The function object used to compare keys.
+    template <typename Key, typename Entry,
+        typename EvictionPolicy = policies::lru_eviction,
+        typename InsertPolicy = policies::always<Entry>,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class unordered_local_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using eviction_policy_type = EvictionPolicy;
+        using insert_policy_type = InsertPolicy;
+        using statistics_type = Statistics;
+
+        using value_type = typename entry_type::value_type;
+        using size_type = std::size_t;
+        using storage_value_type = std::pair<key_type, entry_type>;
+
+    private:
+        using node_type = detail::unordered_cache_node<key_type, entry_type>;
+        using storage_type = std::list<node_type>;
+        using iterator = typename storage_type::iterator;
+        using map_type =
+            std::unordered_map<key_type, iterator, Hash, KeyEqual>;
+
+        using policy_type = typename eviction_policy_type::template apply<
+            storage_type>::type;
+
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of an unordered_local_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is determined
+        ///                   by the unit of the values returned by the entry's
+        ///                   \a get_size function.
+        /// \param ip         [in] An instance of the \a InsertPolicy to use for
+        ///                   this cache.
+        explicit unordered_local_cache(size_type max_size = 0,
+            insert_policy_type const& ip = insert_policy_type())
+          : max_size_(max_size)
+          , current_size_(0)
+          , insert_policy_(ip)
+        {
+        }
+
+        unordered_local_cache(unordered_local_cache&& other) = default;
+        unordered_local_cache& operator=(
+            unordered_local_cache&& other) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        size_type size() const
+        {
+            return current_size_;
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \returns    This function returns \a false if the new \a max_size
+        ///             is smaller than the current limit and the cache could
+        ///             not be shrunk to the new maximum size.
+        bool reserve(size_type max_size)
+        {
+            bool retval = true;
+            if (max_size && max_size < current_size_ &&
+                !free_space(current_size_ - max_size))
+            {
+                retval = false;    // not able to shrink cache
+            }
+
+            max_size_ = max_size;    // change capacity in any case
+            return retval;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key. This does not touch the entry.
+        bool holds_key(key_type const& k) const
+        {
+            return map_.find(k) != map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key, touching
+        ///        the entry if found.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& k, key_type& realkey, entry_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == storage_.end())
+                return false;
+
+            realkey = it->value_.first;
+            val = it->value_.second;
+            return true;
+        }
+
+        bool get_entry(key_type const& k, entry_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == storage_.end())
+                return false;
+
+            val = it->value_.second;
+            return true;
+        }
+
+        bool get_entry(key_type const& k, value_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == storage_.end())
+                return false;
+
+            val = it->value_.second.get();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new element into this cache
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache. It returns \a false
+        ///               if either the insert policy or the entry refused the
+        ///               insertion, if the key is already held by the cache,
+        ///               or if no space could be freed for the new entry.
+        bool insert(key_type const& k, value_type const& val)
+        {
+            entry_type e(val);
+            return insert(k, e);
+        }
+
+        bool insert(key_type const& k, entry_type& e)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+
+            if (map_.find(k) != map_.end())
+                return false;
+
+            // ask entry if it really wants to be inserted
+            if (!insert_policy_(e) || !e.insert())
+                return false;
+
+            // make sure cache doesn't get too large
+            size_type entry_size = e.get_size();
+            if (0 != max_size_ && current_size_ + entry_size > max_size_ &&
+                !free_space(current_size_ + entry_size - max_size_))
+            {
+                return false;
+            }
+
+            iterator it = policy_.insert(storage_, node_type(k, e));
+            map_.emplace(k, it);
+            current_size_ += entry_size;
+
+            // update statistics
+            statistics_.got_insertion();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update the value of an existing element in this cache,
+        ///        inserting it if it is not held by the cache yet. Touches
+        ///        the entry.
+        bool update(key_type const& k, value_type const& val)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == storage_.end())
+                return insert(k, val);    // insert into cache
+
+            it->value_.second.get() = val;
+            return true;
+        }
+
+        /// \brief Update the value of an existing element in this cache,
+        ///        inserting it if it is not held by the cache yet. The update
+        ///        of an existing element is performed only if \a f, invoked
+        ///        with \a k and the key found in the cache, returns \a true
+        ///        (this is consistent with \a local_cache#update_if).
+        template <typename F>
+        bool update_if(key_type const& k, value_type const& val, F f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto mit = map_.find(k);
+            if (mit == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                return insert(k, val);     // insert into cache
+            }
+
+            if (!f(k, mit->first))
+                return false;
+
+            iterator it = mit->second;
+            it->value_.second.get() = val;
+            it->value_.second.touch();
+            policy_.touch(storage_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        /// \brief Replace an existing entry in this cache, inserting it if it
+        ///        is not held by the cache yet.
+        bool update(key_type const& k, entry_type& e)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto mit = map_.find(k);
+            if (mit == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                return insert(k, e);       // insert into cache
+            }
+
+            iterator it = mit->second;
+
+            // make sure the old entry agrees to be removed and the new entry
+            // agrees to be inserted
+            if (!it->value_.second.remove())
+                return false;
+            if (!insert_policy_(e) || !e.insert())
+                return false;
+
+            current_size_ -= it->value_.second.get_size();
+            current_size_ += e.get_size();
+
+            it->value_.second = e;
+            it->value_.second.touch();
+            policy_.touch(storage_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true. The function object is invoked
+        ///        with a \a std::pair<key_type, entry_type>. An entry is kept
+        ///        if its \a entry#remove function returns false.
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (iterator it = storage_.begin(); it != storage_.end(); /**/)
+            {
+                iterator next = std::next(it);
+                if (ep(it->value_) && it->value_.second.remove())
+                {
+                    erased += remove(it);
+                }
+                it = next;
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache for which the
+        ///        \a entry#remove function returns true.
+        size_type erase()
+        {
+            return erase([](storage_value_type const&) { return true; });
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        void clear()
+        {
+            map_.clear();
+            storage_.clear();
+            policy_.clear();
+            statistics_.clear();
+            current_size_ = 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    protected:
+        ///////////////////////////////////////////////////////////////////////
+        // Free some space in the cache, evicting entries in the order given
+        // by the eviction policy. Entries refusing to be removed are skipped.
+        bool free_space(size_type num_free)
+        {
+            size_type freed = 0;
+            iterator it = storage_.empty() ? storage_.end() :
+                                             policy_.victim(storage_);
+            while (freed < num_free && it != storage_.end())
+            {
+                iterator next = policy_.next_victim(storage_, it);
+                if (it->value_.second.remove())
+                {
+                    freed += remove(it);
+                }
+                it = next;
+            }
+
+            return freed >= num_free;
+        }
+
+    private:
+        iterator find_and_touch(key_type const& k)
+        {
+            auto mit = map_.find(k);
+            if (mit == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                return storage_.end();
+            }
+
+            iterator it = mit->second;
+            it->value_.second.touch();
+            policy_.touch(storage_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return it;
+        }
+
+        // remove the given entry, returns its size
+        size_type remove(iterator it)
+        {
+            size_type entry_size = it->value_.second.get_size();
+            current_size_ -= entry_size;
+
+            policy_.erase(storage_, it);
+            map_.erase(it->value_.first);
+            storage_.erase(it);
+
+            // update statistics
+            statistics_.got_eviction();
+
+            return entry_size;
+        }
+
+        size_type max_size_;        // cache capacity
+        size_type current_size_;    // current cache size
+
+        storage_type storage_;
+        map_type map_;
+
+        policy_type policy_;
+        insert_policy_type insert_policy_;
+
+        statistics_type statistics_;    // embedded statistics instance
+    };
+}}}    // namespace hpx::util::cache
@@ -0,0 +1,258 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/unordered_cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy>
+void test_insert()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_cache<std::string, std::string, Policy,
+        statistics::local_statistics>;
+
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<std::size_t>(3));
+    }
+
+    // inserting an existing item fails
+    HPX_TEST(!c.insert("black", "0,0,0"));
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+
+    HPX_TEST_EQ(c.get_statistics().insertions(), std::size_t(6));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(3));
+
+    // the last three items are held by the cache
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+
+    c.clear();
+    HPX_TEST_EQ(static_cast<std::size_t>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// touch the first item and insert another one, returns the cache
+template <typename Policy>
+hpx::util::cache::unordered_cache<std::string, std::string, Policy,
+    hpx::util::cache::statistics::local_statistics>
+insert_with_touch()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_cache<std::string, std::string, Policy,
+        statistics::local_statistics>;
+
+    cache_type c(3);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // touch white twice and green once
+    std::string value;
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST_EQ(value, "255,255,255");
+    HPX_TEST(c.get_entry("green", value));
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST(!c.get_entry("blue", value));
+
+    HPX_TEST_EQ(c.get_statistics().hits(), std::size_t(3));
+    HPX_TEST_EQ(c.get_statistics().misses(), std::size_t(1));
+
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+
+    return c;
+}
+
+void test_lru_insert_with_touch()
+{
+    auto c = insert_with_touch<hpx::util::cache::policies::lru_eviction>();
+
+    // yellow is the least recently used item
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+}
+
+void test_fifo_insert_with_touch()
+{
+    auto c = insert_with_touch<hpx::util::cache::policies::fifo_eviction>();
+
+    // white was inserted first
+    HPX_TEST(!c.holds_key("white"));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+}
+
+void test_lfu_insert_with_touch()
+{
+    auto c = insert_with_touch<hpx::util::cache::policies::lfu_eviction>();
+
+    // yellow was never accessed
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+
+    // blue has been accessed less often than green
+    std::string value;
+    HPX_TEST(c.get_entry("blue", value));
+    HPX_TEST(c.get_entry("blue", value));
+    HPX_TEST(c.insert("black", "0,0,0"));
+
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("black"));
+
+    // shrinking the cache evicts the least frequently used entries
+    c.reserve(2);
+    HPX_TEST_EQ(std::size_t(2), c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(c.holds_key("blue"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct erase_func
+{
+    erase_func(std::string const& key)
+      : key_(key)
+    {
+    }
+
+    template <typename Entry>
+    bool operator()(Entry const& e) const
+    {
+        return key_ == e.first;
+    }
+
+    std::string key_;
+};
+
+template <typename Policy>
+void test_erase_one()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_cache<std::string, std::string, Policy>;
+
+    cache_type c(3);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    std::string blue;
+    HPX_TEST(c.get_entry("blue", blue));
+
+    HPX_TEST_EQ(c.erase(erase_func("blue")), std::size_t(1));
+
+    // there should be 2 items in the cache
+    HPX_TEST(!c.get_entry("blue", blue));
+    HPX_TEST_EQ(static_cast<std::size_t>(2), c.size());
+
+    // the remaining entries are still accessible and evictable
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy>
+void test_update()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_cache<std::string, std::string, Policy>;
+
+    cache_type c(4);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // update an item which isn't in the cache
+    c.update("black", "255,0,0");
+    HPX_TEST_EQ(static_cast<std::size_t>(4), c.size());
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST_EQ(static_cast<std::size_t>(4), c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    // update_if aborts the update if the given function returns true
+    auto reject = [](std::string const&, std::string const&) { return true; };
+    HPX_TEST(!c.update_if("yellow", "0,0,0", reject));
+
+    auto accept = [](std::string const&, std::string const&) { return false; };
+    HPX_TEST(c.update_if("yellow", "0,0,0", accept));
+
+    std::string key;
+    HPX_TEST(c.get_entry("yellow", key, yellow));
+    HPX_TEST_EQ(key, "yellow");
+    HPX_TEST_EQ(yellow, "0,0,0");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using namespace hpx::util::cache;
+
+    test_insert<policies::lru_eviction>();
+    test_insert<policies::fifo_eviction>();
+    test_insert<policies::lfu_eviction>();
+
+    test_lru_insert_with_touch();
+    test_fifo_insert_with_touch();
+    test_lfu_insert_with_touch();
+
+    test_erase_one<policies::lru_eviction>();
+    test_erase_one<policies::fifo_eviction>();
+    test_erase_one<policies::lfu_eviction>();
+
+    test_update<policies::lru_eviction>();
+    test_update<policies::fifo_eviction>();
+    test_update<policies::lfu_eviction>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,300 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/entries/entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/unordered_local_cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+using entry_type = hpx::util::cache::entries::lru_entry<std::string>;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy>
+void test_insert()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_local_cache<std::string, entry_type, Policy,
+        policies::always<entry_type>, statistics::local_statistics>;
+
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<std::size_t>(3));
+    }
+
+    // inserting an existing item fails
+    HPX_TEST(!c.insert("black", "0,0,0"));
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+
+    HPX_TEST_EQ(c.get_statistics().insertions(), std::size_t(6));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(3));
+
+    // the last three items are held by the cache
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+
+    c.clear();
+    HPX_TEST_EQ(static_cast<std::size_t>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_insert_with_touch()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_local_cache<std::string, entry_type>;
+
+    cache_type c(3);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // now touch the first item
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // the touch was forwarded to the entry
+    entry_type e;
+    HPX_TEST(c.get_entry("white", e));
+    HPX_TEST_EQ(e.get(), "255,255,255");
+
+    // add two more items
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST(c.insert("magenta", "255,0,255"));
+
+    // there should be 3 items in the cache, and white should be there as well
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the size of the cache is the sum of the sizes of its entries
+void test_size_entries()
+{
+    using namespace hpx::util::cache;
+    using sized_entry_type = entries::size_entry<std::string>;
+    using cache_type = unordered_local_cache<std::string, sized_entry_type,
+        policies::fifo_eviction>;
+
+    cache_type c(10);
+
+    sized_entry_type white("255,255,255", 4);
+    sized_entry_type yellow("255,255,0", 4);
+    sized_entry_type green("0,255,0", 5);
+    sized_entry_type huge("0,0,0", 11);
+
+    HPX_TEST(c.insert("white", white));
+    HPX_TEST(c.insert("yellow", yellow));
+    HPX_TEST_EQ(static_cast<std::size_t>(8), c.size());
+
+    // white has to go to make room for green
+    HPX_TEST(c.insert("green", green));
+    HPX_TEST_EQ(static_cast<std::size_t>(9), c.size());
+    HPX_TEST(!c.holds_key("white"));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+
+    // an entry larger than the capacity can't be inserted
+    HPX_TEST(!c.insert("black", huge));
+    HPX_TEST_EQ(static_cast<std::size_t>(0), c.size());
+
+    // replacing an entry updates the size of the cache
+    HPX_TEST(c.insert("white", white));
+    HPX_TEST(c.update("white", green));
+    HPX_TEST_EQ(static_cast<std::size_t>(5), c.size());
+
+    // shrinking the cache below the current size evicts entries
+    HPX_TEST(c.insert("yellow", yellow));
+    HPX_TEST(c.reserve(5));
+    HPX_TEST_EQ(static_cast<std::size_t>(4), c.size());
+    HPX_TEST(c.holds_key("yellow"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// entry which refuses to be removed from the cache
+struct pinned_entry : hpx::util::cache::entries::entry<std::string>
+{
+    pinned_entry() = default;
+
+    explicit pinned_entry(std::string const& val)
+      : hpx::util::cache::entries::entry<std::string>(val)
+    {
+    }
+
+    bool remove()
+    {
+        return get() != "pinned";
+    }
+};
+
+void test_pinned_entries()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_local_cache<std::string, pinned_entry>;
+
+    cache_type c(2);
+
+    HPX_TEST(c.insert("first", "pinned"));
+    HPX_TEST(c.insert("second", "0,0,0"));
+
+    // the least recently used entry is pinned, the next one is evicted
+    HPX_TEST(c.insert("third", "255,255,255"));
+    HPX_TEST(c.holds_key("first"));
+    HPX_TEST(!c.holds_key("second"));
+    HPX_TEST(c.holds_key("third"));
+
+    // erase skips the pinned entry
+    HPX_TEST_EQ(c.erase(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(static_cast<std::size_t>(1), c.size());
+    HPX_TEST(c.holds_key("first"));
+
+    // no space can be freed if all entries are pinned
+    HPX_TEST(c.update("first", "pinned"));
+    HPX_TEST(c.insert("second", "pinned"));
+    HPX_TEST(!c.insert("third", "255,255,255"));
+    HPX_TEST_EQ(static_cast<std::size_t>(2), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct erase_func
+{
+    erase_func(std::string const& key)
+      : key_(key)
+    {
+    }
+
+    template <typename Entry>
+    bool operator()(Entry const& e) const
+    {
+        return key_ == e.first;
+    }
+
+    std::string key_;
+};
+
+template <typename Policy>
+void test_erase_one()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_local_cache<std::string, entry_type, Policy>;
+
+    cache_type c(3);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    entry_type blue;
+    HPX_TEST(c.get_entry("blue", blue));
+
+    HPX_TEST_EQ(c.erase(erase_func("blue")), std::size_t(1));
+
+    // there should be 2 items in the cache
+    HPX_TEST(!c.get_entry("blue", blue));
+    HPX_TEST_EQ(static_cast<std::size_t>(2), c.size());
+
+    // the remaining entries are still accessible and evictable
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST_EQ(static_cast<std::size_t>(3), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy>
+void test_update()
+{
+    using namespace hpx::util::cache;
+    using cache_type = unordered_local_cache<std::string, entry_type, Policy>;
+
+    cache_type c(4);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // update an item which isn't in the cache
+    HPX_TEST(c.update("black", "255,0,0"));
+    HPX_TEST_EQ(static_cast<std::size_t>(4), c.size());
+
+    HPX_TEST(c.update("yellow", "255,0,0"));
+    HPX_TEST_EQ(static_cast<std::size_t>(4), c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    // update_if continues the update only if the given function returns true
+    auto reject = [](std::string const&, std::string const&) { return false; };
+    HPX_TEST(!c.update_if("yellow", "0,0,0", reject));
+
+    auto accept = [](std::string const&, std::string const&) { return true; };
+    HPX_TEST(c.update_if("yellow", "0,0,0", accept));
+
+    std::string key;
+    entry_type e;
+    HPX_TEST(c.get_entry("yellow", key, e));
+    HPX_TEST_EQ(key, "yellow");
+    HPX_TEST_EQ(e.get(), "0,0,0");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using namespace hpx::util::cache;
+
+    test_insert<policies::lru_eviction>();
+    test_insert<policies::fifo_eviction>();
+    test_insert<policies::lfu_eviction>();
+
+    test_lru_insert_with_touch();
+    test_size_entries();
+    test_pinned_entries();
+
+    test_erase_one<policies::lru_eviction>();
+    test_erase_one<policies::fifo_eviction>();
+    test_erase_one<policies::lfu_eviction>();
+
+    test_update<policies::lru_eviction>();
+    test_update<policies::fifo_eviction>();
+    test_update<policies::lfu_eviction>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,221 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    /// \brief A single-owner, multi-thief work-stealing deque.
+    ///
+    /// This is the dynamic circular work-stealing deque by Chase and Lev
+    /// (SPAA 2005), using the memory orderings derived for weak memory models
+    /// by Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013). The owning thread
+    /// pushes and pops at the bottom end using plain loads and stores (a CAS
+    /// is needed only when racing for the very last element), while any
+    /// number of other threads may concurrently steal from the top end.
+    ///
+    /// Only a single thread may call \a push and \a pop at any point in time.
+    /// \a steal, \a empty and \a size may be called from any thread.
+    ///
+    /// The deque grows as needed. Buffers which were replaced while growing
+    /// are kept alive until the deque is destroyed as concurrent thieves may
+    /// still be reading from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable elements, as thieves "
+            "read elements before taking ownership of them");
+
+        struct buffer
+        {
+            explicit buffer(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , data_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            void put(std::int64_t i, T val) noexcept
+            {
+                data_[std::size_t(i & mask_)].store(
+                    val, std::memory_order_relaxed);
+            }
+
+            T get(std::int64_t i) const noexcept
+            {
+                return data_[std::size_t(i & mask_)].load(
+                    std::memory_order_relaxed);
+            }
+
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+        static constexpr std::int64_t round_up_capacity(
+            std::size_t initial_size) noexcept
+        {
+            std::int64_t capacity = 64;
+            while (capacity < std::int64_t(initial_size))
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t initial_size = 0)
+          : buffer_(new buffer(round_up_capacity(initial_size)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete buffer_.load(std::memory_order_relaxed);
+        }
+
+        /// Push a new element to the bottom of the deque (owner only).
+        void push(T val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                a = grow(a, b, t);
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Pop the most recently pushed element from the bottom of the deque
+        /// (owner only). Returns false if the deque was empty.
+        bool pop(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last element, race against thieves for it
+                bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        /// Steal the least recently pushed element from the top of the deque
+        /// (any thread). Returns false if the deque was empty or if another
+        /// thread won the race for the top element.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            // memory_order_consume is promoted to acquire by all current
+            // compilers anyways
+            buffer* a = buffer_.load(std::memory_order_acquire);
+            T tmp = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = tmp;
+            return true;
+        }
+
+        /// Returns whether the deque is empty. The result is approximate if
+        /// other threads modify the deque concurrently.
+        bool empty() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        /// Returns the number of elements in the deque. The result is
+        /// approximate if other threads modify the deque concurrently.
+        std::size_t size() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? std::size_t(b - t) : 0;
+        }
+
+    private:
+        buffer* grow(buffer* a, std::int64_t b, std::int64_t t)
+        {
+            std::unique_ptr<buffer> new_buffer(new buffer(2 * a->capacity()));
+            for (std::int64_t i = t; i != b; ++i)
+            {
+                new_buffer->put(i, a->get(i));
+            }
+
+            // thieves may still be accessing the old buffer
+            retired_buffers_.emplace_back(a);
+
+            buffer* result = new_buffer.release();
+            buffer_.store(result, std::memory_order_release);
+            return result;
+        }
+
+    private:
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<buffer*> buffer_;
+
+        // owner only
+        std::vector<std::unique_ptr<buffer>> retired_buffers_;
+    };
+}}    // namespace hpx::concurrency
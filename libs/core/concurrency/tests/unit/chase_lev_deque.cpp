@@ -0,0 +1,117 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+void test_basic()
+{
+    deque_type q;
+    std::uint64_t val = 0;
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop(val));
+    HPX_TEST(!q.steal(val));
+
+    // force the deque to grow a couple of times
+    std::uint64_t const count = 1000;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        q.push(i);
+    }
+    HPX_TEST_EQ(q.size(), std::size_t(count));
+
+    // the owner pops in LIFO order, thieves steal in FIFO order
+    HPX_TEST(q.pop(val));
+    HPX_TEST_EQ(val, count - 1);
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, std::uint64_t(0));
+
+    for (std::uint64_t i = count - 2; i != 0; --i)
+    {
+        HPX_TEST(q.pop(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop(val));
+    HPX_TEST(!q.steal(val));
+}
+
+void test_concurrent(std::size_t num_thieves, std::uint64_t items)
+{
+    deque_type q(16);
+
+    std::atomic<bool> done(false);
+    std::vector<std::atomic<std::uint64_t>> seen(items);
+    for (auto& s : seen)
+    {
+        s.store(0);
+    }
+
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t val = 0;
+            while (!done.load() || !q.empty())
+            {
+                if (q.steal(val))
+                {
+                    ++seen[val];
+                }
+            }
+        });
+    }
+
+    // the owner interleaves pushes and pops while being robbed
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        q.push(i);
+        if (i % 3 == 0 && q.pop(val))
+        {
+            ++seen[val];
+        }
+    }
+    while (q.pop(val))
+    {
+        ++seen[val];
+    }
+
+    done.store(true);
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    // every element has to be retrieved exactly once
+    for (auto& s : seen)
+    {
+        HPX_TEST_EQ(s.load(), std::uint64_t(1));
+    }
+}
+
+int main()
+{
+    test_basic();
+
+    std::size_t num_thieves = (std::max)(
+        std::size_t(std::thread::hardware_concurrency()), std::size_t(2));
+    test_concurrent(num_thieves, 100000);
+
+    return hpx::util::report_errors();
+}
@@ -174,6 +174,26 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+/// This defines the number of independently locked partitions (shards) the
+/// local AGAS cache is divided into. The cache size is distributed evenly over
+/// all shards.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.local_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_LOCAL_CACHE_SHARDS)
+#if !defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+#  define HPX_AGAS_LOCAL_CACHE_SHARDS 16
+#endif
+
+/// This defines the number of independently locked partitions (shards) the
+/// tables of the AGAS primary namespace service are divided into.
+#if !defined(HPX_AGAS_PRIMARY_NAMESPACE_SHARDS)
+#  define HPX_AGAS_PRIMARY_NAMESPACE_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
@@ -443,6 +463,68 @@
 #  define HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS 100
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of terminated threads (per stack size) kept for reuse by a
+// thread queue, zero means no limit.
+#if !defined(HPX_THREAD_QUEUE_MAX_IDLE_THREADS)
+#  define HPX_THREAD_QUEUE_MAX_IDLE_THREADS 1000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of released thread stacks (per stack size) kept unmodified by the
+// stack pool of an OS thread.
+#if !defined(HPX_STACK_POOL_LOW_WATERMARK)
+#  define HPX_STACK_POOL_LOW_WATERMARK 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of released thread stacks (per stack size) kept by the stack
+// pool of an OS thread, zero disables pooling of stacks.
+#if !defined(HPX_STACK_POOL_HIGH_WATERMARK)
+#  define HPX_STACK_POOL_HIGH_WATERMARK 128
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of pages at the top of a newly allocated thread stack touched by the
+// allocating OS thread.
+#if !defined(HPX_STACK_PREFAULT_PAGES)
+#  define HPX_STACK_PREFAULT_PAGES 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of thread stacks allocated at once.
+#if !defined(HPX_STACK_ARENA_STACKS)
+#  define HPX_STACK_ARENA_STACKS 1
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Advise the operating system to back new thread stacks by transparent huge
+// pages.
+#if !defined(HPX_STACK_USE_HUGE_PAGES)
+#  define HPX_STACK_USE_HUGE_PAGES 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Release the memory of pooled thread stacks using MADV_FREE instead of
+// MADV_DONTNEED.
+#if !defined(HPX_STACK_LAZY_RELEASE)
+#  define HPX_STACK_LAZY_RELEASE 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of threads of a description which have to be observed before a
+// smaller stack is selected for new threads of that description.
+#if !defined(HPX_STACK_AUTO_SELECT_MIN_SAMPLES)
+#  define HPX_STACK_AUTO_SELECT_MIN_SAMPLES 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Factor by which an automatically selected stack has to be larger than the
+// maximal stack usage recorded for the thread description.
+#if !defined(HPX_STACK_AUTO_SELECT_MARGIN)
+#  define HPX_STACK_AUTO_SELECT_MARGIN 2
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
@@ -158,6 +158,13 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
         }
 
+        // Return the number of bytes of stack used by the last invocation of
+        // the thread function, if measuring the stack usage is enabled
+        std::ptrdiff_t get_stack_usage() const
+        {
+            return impl_.get_stack_usage();
+        }
+
         impl_type* impl()
         {
             return &impl_;
@@ -196,6 +196,7 @@ namespace hpx { namespace threads { namespace coroutines {
               , stack_size_((stack_size == -1) ? alloc_.minimum_stacksize() :
                                                  std::size_t(stack_size))
               , stack_pointer_(nullptr)
+              , stack_usage_(0)
             {
             }
 
@@ -239,6 +240,13 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
             }
 
+            // Return the stack usage measured when the stack was reset the
+            // last time.
+            std::ptrdiff_t get_stack_usage() const
+            {
+                return stack_usage_;
+            }
+
             void reset_stack()
             {
                 if (ctx_)
@@ -246,6 +254,11 @@ namespace hpx { namespace threads { namespace coroutines {
 #if defined(_POSIX_VERSION)
                     void* limit =
                         static_cast<char*>(stack_pointer_) - stack_size_;
+                    if (posix::measure_stack_usage)
+                    {
+                        stack_usage_ = static_cast<std::ptrdiff_t>(
+                            posix::stack_usage(limit, stack_size_));
+                    }
                     if (posix::reset_stack(limit, stack_size_))
                     {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -336,6 +349,7 @@ namespace hpx { namespace threads { namespace coroutines {
             stack_allocator alloc_;
             std::size_t stack_size_;
             void* stack_pointer_;
+            std::ptrdiff_t stack_usage_;
         };
     }}    // namespace detail::generic_context
 }}}       // namespace hpx::threads::coroutines
@@ -206,6 +206,7 @@ namespace hpx { namespace threads { namespace coroutines {
                         static_cast<std::ptrdiff_t>(default_stack_size) :
                         stack_size)
               , m_stack(nullptr)
+              , m_stack_usage(0)
             {
             }
 
@@ -350,9 +351,23 @@ namespace hpx { namespace threads { namespace coroutines {
                             return m_stack_size;
                         }
 
+                        // Return the stack usage measured when the stack
+                        // was reset the last time.
+                        std::ptrdiff_t get_stack_usage() const
+                        {
+                            return m_stack_usage;
+                        }
+
                         void reset_stack()
                         {
                             HPX_ASSERT(m_stack);
+                            if (posix::measure_stack_usage)
+                            {
+                                m_stack_usage = static_cast<std::ptrdiff_t>(
+                                    posix::stack_usage(m_stack,
+                                        static_cast<std::size_t>(
+                                            m_stack_size)));
+                            }
                             if (posix::reset_stack(m_stack,
                                     static_cast<std::size_t>(m_stack_size)))
                             {
@@ -514,6 +529,7 @@ namespace hpx { namespace threads { namespace coroutines {
 
                         std::ptrdiff_t m_stack_size;
                         void* m_stack;
+                        std::ptrdiff_t m_stack_usage;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
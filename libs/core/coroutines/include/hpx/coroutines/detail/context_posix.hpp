@@ -235,6 +235,7 @@ namespace hpx { namespace threads { namespace coroutines {
                     stack_size == -1 ? this->default_stack_size : stack_size)
               , m_stack(nullptr)
               , funp_(&trampoline<CoroutineImpl>)
+              , m_stack_usage(0)
             {
             }
 
@@ -346,10 +347,23 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
             }
 
+            // Return the stack usage measured when the stack was reset the
+            // last time.
+            std::ptrdiff_t get_stack_usage() const
+            {
+                return m_stack_usage;
+            }
+
             void reset_stack()
             {
                 if (m_stack)
                 {
+                    if (posix::measure_stack_usage)
+                    {
+                        m_stack_usage = static_cast<std::ptrdiff_t>(
+                            posix::stack_usage(m_stack,
+                                static_cast<std::size_t>(m_stack_size)));
+                    }
                     if (posix::reset_stack(
                             m_stack, static_cast<std::size_t>(m_stack_size)))
                     {
@@ -421,6 +435,7 @@ namespace hpx { namespace threads { namespace coroutines {
             std::ptrdiff_t m_stack_size;
             void* m_stack;
             void (*funp_)(void*);
+            std::ptrdiff_t m_stack_usage;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
             struct sigaction action;
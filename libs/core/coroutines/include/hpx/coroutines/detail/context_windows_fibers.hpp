@@ -290,6 +290,12 @@ namespace hpx { namespace threads { namespace coroutines {
                 return stacksize_;
             }
 
+            // Measuring the stack usage is not supported
+            constexpr std::ptrdiff_t get_stack_usage() const noexcept
+            {
+                return 0;
+            }
+
             constexpr void reset_stack() noexcept {}
 
             void rebind_stack() noexcept
@@ -44,6 +44,7 @@
  * Most of these utilities are really pure C++, but they are useful
  * only on posix systems.
  */
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
 #include <cstdlib>
@@ -74,10 +75,44 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Parameters controlling the per-worker pool of thread stacks. Freed
+        // stacks are kept by the OS thread releasing them, separately for
+        // each stack size:
+        //  - up to low_watermark stacks are kept as they are (hot),
+        //  - up to high_watermark stacks are kept after their pages have been
+        //    handed back to the OS (cold),
+        //  - all other stacks are unmapped.
+        // A high_watermark of zero disables pooling.
+        struct stack_pool_parameters
+        {
+            std::size_t low_watermark = HPX_STACK_POOL_LOW_WATERMARK;
+            std::size_t high_watermark = HPX_STACK_POOL_HIGH_WATERMARK;
+
+            // number of pages at the top of a stack to touch when handing
+            // out a stack which has no backing memory (zero: don't touch)
+            std::size_t prefault_pages = HPX_STACK_PREFAULT_PAGES;
+
+            // number of stacks to allocate with a single mmap() call
+            std::size_t arena_stacks = HPX_STACK_ARENA_STACKS;
+
+            // advise the kernel to back new stacks by transparent huge pages
+            bool use_huge_pages = HPX_STACK_USE_HUGE_PAGES != 0;
+
+            // release the memory of cold stacks using MADV_FREE, if available
+            bool lazy_release = HPX_STACK_LAZY_RELEASE != 0;
+        };
+
+        HPX_CORE_EXPORT extern stack_pool_parameters stack_pool_params;
+
+        // this global variable controls whether the stack usage of threads
+        // is measured when those terminate
+        HPX_CORE_EXPORT extern bool measure_stack_usage;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-        inline void* alloc_stack(std::size_t size)
+        inline void* map_stack(std::size_t size)
         {
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -149,7 +184,36 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
-        inline void free_stack(void* stack, std::size_t size)
+        // Return the number of bytes of the stack which have been touched
+        // (with page granularity). This relies on the pages of the stack
+        // being released by reset_stack() after each use.
+        inline std::size_t stack_usage(void* stack, std::size_t size)
+        {
+            constexpr std::size_t chunk_pages = 64;
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            unsigned char resident[chunk_pages];
+#else
+            char resident[chunk_pages];
+#endif
+            // find the lowest resident page, stacks grow downwards
+            std::size_t pages = size / EXEC_PAGESIZE;
+            for (std::size_t first = 0; first < pages; first += chunk_pages)
+            {
+                std::size_t count = (std::min)(chunk_pages, pages - first);
+                char* addr = static_cast<char*>(stack) + first * EXEC_PAGESIZE;
+                if (::mincore(addr, count * EXEC_PAGESIZE, resident) != 0)
+                    return 0;
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    if (resident[i] & 1)
+                        return size - (first + i) * EXEC_PAGESIZE;
+                }
+            }
+            return 0;
+        }
+
+        inline void unmap_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
@@ -167,6 +231,35 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        // Allocate and release stacks using the pool of the calling OS thread
+        HPX_CORE_EXPORT void* alloc_pooled_stack(std::size_t size);
+        HPX_CORE_EXPORT void free_pooled_stack(void* stack, std::size_t size);
+
+        // Return the number of stacks of the given size held by the pool of
+        // the calling OS thread, either with populated pages (hot) or with
+        // released pages (cold)
+        HPX_CORE_EXPORT std::size_t get_pooled_stack_count(
+            std::size_t size, bool hot);
+
+        inline void* alloc_stack(std::size_t size)
+        {
+            if (stack_pool_params.high_watermark != 0)
+            {
+                return alloc_pooled_stack(size);
+            }
+            return map_stack(size);
+        }
+
+        inline void free_stack(void* stack, std::size_t size)
+        {
+            if (stack_pool_params.high_watermark != 0)
+            {
+                free_pooled_stack(stack, size);
+                return;
+            }
+            unmap_stack(stack, size);
+        }
+
 #else    // non-mmap()
 
         //this should be a fine default.
@@ -201,6 +294,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
+        inline std::size_t stack_usage(
+            void* /* stack */, std::size_t /* size */)
+        {
+            return 0;
+        }
+
         inline void free_stack(void* stack, std::size_t size)
         {
             delete[] static_cast<stack_aligner*>(stack);
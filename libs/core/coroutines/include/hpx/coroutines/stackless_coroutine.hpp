@@ -183,6 +183,19 @@ namespace hpx { namespace threads { namespace coroutines {
             state_ = stackless_coroutine::ctx_ready;
         }
 
+        // Hand the thread function over to a stackful coroutine which runs
+        // it instead, this coroutine is regarded as finished afterwards.
+        functor_type release_function()
+        {
+            HPX_ASSERT(is_ready());
+
+            functor_type f = std::move(f_);
+            util::detail::reset_function(f_);
+
+            state_ = stackless_coroutine::ctx_exited;
+            return f;
+        }
+
         void reset_tss()
         {
 #if defined(HPX_HAVE_THREAD_LOCAL_STORAGE)
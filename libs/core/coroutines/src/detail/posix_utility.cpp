@@ -10,11 +10,262 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // this global variable controls the per-worker stack pools
+        HPX_CORE_EXPORT stack_pool_parameters stack_pool_params;
+
+        // this global variable enables measuring the stack usage of threads
+        HPX_CORE_EXPORT bool measure_stack_usage = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+        namespace {
+            ///////////////////////////////////////////////////////////////////
+            // The stacks cached by one OS thread, grouped by stack size. As
+            // the stack memory is touched first by the thread allocating it
+            // (which is the worker thread creating HPX threads) the cached
+            // stacks are local to the NUMA domain of that worker.
+            struct stack_pool
+            {
+                struct entry
+                {
+                    std::size_t size_;
+                    std::vector<void*> hot_;     // pages are populated
+                    std::vector<void*> cold_;    // pages have been released
+                };
+
+                ~stack_pool()
+                {
+                    for (entry& e : entries_)
+                    {
+                        for (void* stack : e.hot_)
+                            unmap_stack(stack, e.size_);
+                        for (void* stack : e.cold_)
+                            unmap_stack(stack, e.size_);
+                    }
+                }
+
+                entry& get_entry(std::size_t size)
+                {
+                    // there are only very few different stack sizes in use
+                    for (entry& e : entries_)
+                    {
+                        if (e.size_ == size)
+                            return e;
+                    }
+                    entries_.push_back(entry{size, {}, {}});
+                    return entries_.back();
+                }
+
+                std::vector<entry> entries_;
+            };
+
+            // The pool is accessed through a trivially destructible pointer,
+            // as stacks may still be freed by this thread after the pool was
+            // destroyed (e.g. during static destruction).
+            thread_local stack_pool* current_pool = nullptr;
+            thread_local bool pool_released = false;
+
+            struct stack_pool_holder
+            {
+                ~stack_pool_holder()
+                {
+                    delete current_pool;
+                    current_pool = nullptr;
+                    pool_released = true;
+                }
+            };
+
+            stack_pool* get_stack_pool()
+            {
+                if (current_pool == nullptr && !pool_released)
+                {
+                    static thread_local stack_pool_holder holder;
+                    (void) holder;
+
+                    current_pool = new stack_pool;
+                }
+                return current_pool;
+            }
+
+            std::size_t guard_page_size()
+            {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                return use_guard_pages ? EXEC_PAGESIZE : 0;
+#else
+                return 0;
+#endif
+            }
+
+            // Hand the pages of an unused stack back to the OS. As for
+            // reset_stack(), the top page is kept as it is needed first.
+            void release_stack_pages(void* stack, std::size_t size)
+            {
+#if defined(MADV_FREE)
+                if (stack_pool_params.lazy_release &&
+                    ::madvise(stack, size - EXEC_PAGESIZE, MADV_FREE) == 0)
+                {
+                    return;
+                }
+#endif
+                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+            }
+
+            // Touch the top pages of the stack (stacks grow downwards) to
+            // avoid page faults while running the first HPX thread.
+            void prefault_stack(void* stack, std::size_t size)
+            {
+                std::size_t pages = (std::min)(
+                    stack_pool_params.prefault_pages, size / EXEC_PAGESIZE);
+
+                char* top = static_cast<char*>(stack) + size;
+                for (std::size_t i = 1; i <= pages; ++i)
+                {
+                    *static_cast<char volatile*>(top - i * EXEC_PAGESIZE) = 0;
+                }
+            }
+
+            // Map a number of stacks using one call to mmap(). All stacks are
+            // separated by guard pages (if enabled). The first stack is
+            // returned, all others are added to the cold stacks of the pool.
+            // The stacks can be unmapped individually later on.
+            void* map_stack_arena(std::size_t size, stack_pool::entry& e)
+            {
+                std::size_t count = (std::max)(std::size_t(1),
+                    (std::min)(stack_pool_params.arena_stacks,
+                        stack_pool_params.high_watermark));
+
+                if (count == 1 && !stack_pool_params.use_huge_pages)
+                    return map_stack(size);
+
+                std::size_t guard_size = guard_page_size();
+                std::size_t stack_size = size + guard_size;
+
+                void* arena = ::mmap(nullptr, count * stack_size,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (arena == MAP_FAILED)
+                {
+                    // fall back to allocating a single stack, this reports
+                    // the error if that fails as well
+                    return map_stack(size);
+                }
+
+#if defined(MADV_HUGEPAGE)
+                // huge pages can be used only for the parts of the arena not
+                // split by guard pages
+                if (stack_pool_params.use_huge_pages)
+                {
+                    ::madvise(arena, count * stack_size, MADV_HUGEPAGE);
+                }
+#endif
+
+                char* base = static_cast<char*>(arena);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    char* stack = base + i * stack_size;
+                    if (guard_size != 0)
+                    {
+                        ::mprotect(stack, guard_size, PROT_NONE);
+                    }
+                    if (i != 0)
+                    {
+                        e.cold_.push_back(stack + guard_size);
+                    }
+                }
+                return base + guard_size;
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        void* alloc_pooled_stack(std::size_t size)
+        {
+            stack_pool* pool = get_stack_pool();
+            if (pool == nullptr)
+                return map_stack(size);
+
+            stack_pool::entry& e = pool->get_entry(size);
+            if (!e.hot_.empty())
+            {
+                void* stack = e.hot_.back();
+                e.hot_.pop_back();
+                return stack;
+            }
+
+            void* stack = nullptr;
+            if (!e.cold_.empty())
+            {
+                stack = e.cold_.back();
+                e.cold_.pop_back();
+            }
+            else
+            {
+                stack = map_stack_arena(size, e);
+            }
+
+            if (stack_pool_params.prefault_pages != 0)
+                prefault_stack(stack, size);
+
+            return stack;
+        }
+
+        void free_pooled_stack(void* stack, std::size_t size)
+        {
+            stack_pool* pool = get_stack_pool();
+            if (pool == nullptr)
+            {
+                unmap_stack(stack, size);
+                return;
+            }
+
+            std::size_t high_watermark = stack_pool_params.high_watermark;
+            std::size_t low_watermark =
+                (std::min)(stack_pool_params.low_watermark, high_watermark);
+
+            stack_pool::entry& e = pool->get_entry(size);
+            if (e.hot_.size() < low_watermark)
+            {
+                e.hot_.push_back(stack);
+            }
+            else if (e.hot_.size() + e.cold_.size() < high_watermark)
+            {
+                release_stack_pages(stack, size);
+                e.cold_.push_back(stack);
+            }
+            else
+            {
+                unmap_stack(stack, size);
+            }
+        }
+
+        std::size_t get_pooled_stack_count(std::size_t size, bool hot)
+        {
+            stack_pool* pool = get_stack_pool();
+            if (pool == nullptr)
+                return 0;
+
+            stack_pool::entry const& e = pool->get_entry(size);
+            return hot ? e.hot_.size() : e.cold_.size();
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -0,0 +1,247 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+std::size_t const page_size = EXEC_PAGESIZE;
+
+///////////////////////////////////////////////////////////////////////////////
+// the stacks are mapped as long as mincore() succeeds
+bool is_mapped(void* addr)
+{
+    unsigned char resident = 0;
+    return ::mincore(addr, page_size, &resident) == 0 || errno != ENOMEM;
+}
+
+// number of resident pages in [addr, addr + size)
+std::size_t resident_pages(void* addr, std::size_t size)
+{
+    std::vector<unsigned char> resident(size / page_size);
+    if (::mincore(addr, size, resident.data()) != 0)
+        return 0;
+
+    return static_cast<std::size_t>(
+        std::count_if(resident.begin(), resident.end(),
+            [](unsigned char r) { return (r & 1) != 0; }));
+}
+
+// the permissions of the mapping containing the given address, as listed in
+// /proc/self/maps (e.g. "rwxp" or "---p")
+std::string get_protection(void* addr)
+{
+    std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(addr);
+
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        std::istringstream strm(line);
+        std::uintptr_t begin = 0, end = 0;
+        char dash = 0;
+        std::string perms;
+        strm >> std::hex >> begin >> dash >> end >> perms;
+
+        if (begin <= address && address < end)
+            return perms;
+    }
+    return std::string();
+}
+
+void set_parameters(std::size_t low_watermark, std::size_t high_watermark,
+    std::size_t arena_stacks = 1)
+{
+    posix::stack_pool_params.low_watermark = low_watermark;
+    posix::stack_pool_params.high_watermark = high_watermark;
+    posix::stack_pool_params.arena_stacks = arena_stacks;
+    posix::stack_pool_params.prefault_pages = 0;
+    posix::stack_pool_params.use_huge_pages = false;
+    posix::stack_pool_params.lazy_release = false;
+}
+
+// Each of the tests below uses a different stack size, as the pool keeps the
+// stacks of different sizes separately.
+
+///////////////////////////////////////////////////////////////////////////////
+// released stacks are handed out again
+void test_reuse()
+{
+    std::size_t const size = 16 * page_size;
+    set_parameters(2, 4);
+
+    void* stack = posix::alloc_stack(size);
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(0));
+
+    posix::free_stack(stack, size);
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(1));
+    HPX_TEST(is_mapped(stack));
+
+    void* reused = posix::alloc_stack(size);
+    HPX_TEST(reused == stack);
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(0));
+
+    // stacks of a different size are not reused
+    posix::free_stack(reused, size);
+
+    void* other = posix::alloc_stack(2 * size);
+    HPX_TEST(other != stack);
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(1));
+
+    posix::free_stack(other, 2 * size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// up to low_watermark stacks are kept as they are, up to high_watermark after
+// releasing their pages, all others are unmapped
+void test_watermarks()
+{
+    std::size_t const size = 17 * page_size;
+    set_parameters(2, 4);
+
+    std::vector<void*> stacks;
+    for (int i = 0; i != 6; ++i)
+    {
+        void* stack = posix::alloc_stack(size);
+        std::memset(stack, 0xff, size);
+        stacks.push_back(stack);
+    }
+
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, size);
+    }
+
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(2));
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, false), std::size_t(2));
+
+    // the hot stacks are still populated
+    HPX_TEST_EQ(resident_pages(stacks[0], size), size / page_size);
+    HPX_TEST_EQ(resident_pages(stacks[1], size), size / page_size);
+
+    // the pages of the cold stacks have been released using madvise(), except
+    // for the top page
+    HPX_TEST_EQ(resident_pages(stacks[2], size - page_size), std::size_t(0));
+    HPX_TEST_EQ(resident_pages(stacks[3], size - page_size), std::size_t(0));
+    HPX_TEST(is_mapped(stacks[2]));
+    HPX_TEST(is_mapped(stacks[3]));
+
+    // the stacks beyond the high watermark have been unmapped
+    HPX_TEST(!is_mapped(stacks[4]));
+    HPX_TEST(!is_mapped(stacks[5]));
+
+    // hot stacks are handed out before cold ones
+    void* first = posix::alloc_stack(size);
+    void* second = posix::alloc_stack(size);
+    HPX_TEST(first == stacks[1]);
+    HPX_TEST(second == stacks[0]);
+
+    void* third = posix::alloc_stack(size);
+    HPX_TEST(third == stacks[3]);
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, false), std::size_t(1));
+
+    // released pages are zero filled when touched again
+    HPX_TEST(*static_cast<unsigned char*>(third) == 0);
+
+    posix::free_stack(first, size);
+    posix::free_stack(second, size);
+    posix::free_stack(third, size);
+
+    // a high watermark of zero disables the pool
+    set_parameters(0, 0);
+
+    void* stack = posix::alloc_stack(size);
+    posix::free_stack(stack, size);
+    HPX_TEST(!is_mapped(stack));
+    HPX_TEST_EQ(posix::get_pooled_stack_count(size, true), std::size_t(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the stacks allocated as one arena are separated by guard pages
+void test_guard_pages()
+{
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+    bool const use_guard_pages = posix::use_guard_pages;
+    posix::use_guard_pages = true;
+
+    for (std::size_t arena_stacks : {std::size_t(1), std::size_t(4)})
+    {
+        std::size_t const size = (18 + arena_stacks) * page_size;
+        set_parameters(4, 8, arena_stacks);
+
+        std::vector<void*> stacks;
+        for (std::size_t i = 0; i != 4; ++i)
+        {
+            stacks.push_back(posix::alloc_stack(size));
+        }
+
+        std::vector<void*> sorted(stacks);
+        std::sort(sorted.begin(), sorted.end());
+        for (std::size_t i = 0; i != sorted.size(); ++i)
+        {
+            char* stack = static_cast<char*>(sorted[i]);
+
+            // the page right below each stack is a guard page
+            HPX_TEST_EQ(get_protection(stack - page_size), std::string("---p"));
+            HPX_TEST_EQ(get_protection(stack).substr(0, 2), std::string("rw"));
+            HPX_TEST_EQ(get_protection(stack + size - page_size).substr(0, 2),
+                std::string("rw"));
+
+            // the stacks do not overlap each other or the guard pages
+            if (i != 0)
+            {
+                HPX_TEST(static_cast<char*>(sorted[i - 1]) + size <=
+                    stack - page_size);
+            }
+        }
+
+        for (void* stack : stacks)
+        {
+            posix::free_stack(stack, size);
+        }
+    }
+
+    posix::use_guard_pages = use_guard_pages;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    posix::stack_pool_parameters const params = posix::stack_pool_params;
+
+    test_reuse();
+    test_watermarks();
+    test_guard_pages();
+
+    posix::stack_pool_params = params;
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
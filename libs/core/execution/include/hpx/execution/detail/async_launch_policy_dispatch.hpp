@@ -15,6 +15,10 @@
 #include <hpx/functional/traits/is_action.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/futures_factory.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_data_stackless.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -58,6 +62,39 @@ namespace hpx { namespace detail {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Work launched with launch::async is run child-first (as if launch::fork
+    // was used) if the scheduler of the target pool was asked to do so and the
+    // new thread would be created on the scheduler of the calling thread
+    // anyways. Explicit schedule hints are always honored.
+    HPX_FORCEINLINE bool spawn_child_first(threads::thread_pool_base* pool,
+        threads::thread_schedule_hint hint)
+    {
+        if (hint.mode != threads::thread_schedule_hint_mode::none)
+            return false;
+
+        threads::thread_id_type tid_self = threads::get_self_id();
+        if (!tid_self)
+            return false;
+
+        // threads without a stack of their own can't suspend to let the
+        // new thread run first, except for those created by the stackless
+        // fast path (which are given a stack when suspending)
+        threads::thread_data* self = get_thread_id_data(tid_self);
+        if (self->is_stackless() &&
+            !static_cast<threads::thread_data_stackless*>(self)
+                 ->is_promotable())
+        {
+            return false;
+        }
+
+        threads::policies::scheduler_base* scheduler = pool->get_scheduler();
+        return scheduler != nullptr &&
+            scheduler->has_scheduler_mode(
+                threads::policies::spawn_child_first) &&
+            self->get_scheduler_base() == scheduler;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Action>
     struct async_launch_policy_dispatch<Action,
@@ -85,6 +122,12 @@ namespace hpx { namespace detail {
                 std::forward<F>(f), std::forward<Ts>(ts)...));
             if (hpx::detail::has_async_policy(policy))
             {
+                if (policy == launch::async &&
+                    detail::spawn_child_first(pool, hint))
+                {
+                    policy = launch::fork;
+                }
+
                 threads::thread_id_ref_type tid = p.apply(pool,
                     desc.get_description(), policy, priority, stacksize, hint);
                 if (tid)
@@ -157,6 +200,12 @@ namespace hpx { namespace detail {
         {
             HPX_ASSERT(pool);
 
+            if (detail::spawn_child_first(pool, hint))
+            {
+                return call(launch::fork, desc, pool, priority, stacksize,
+                    hint, std::forward<F>(f), std::forward<Ts>(ts)...);
+            }
+
             using result_type =
                 util::detail::invoke_deferred_result_t<F, Ts...>;
 
@@ -0,0 +1,38 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool all_of(
+        std::experimental::simd_mask<T, Abi> const& mask)
+    {
+        return std::experimental::all_of(mask);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool any_of(
+        std::experimental::simd_mask<T, Abi> const& mask)
+    {
+        return std::experimental::any_of(mask);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool none_of(
+        std::experimental::simd_mask<T, Abi> const& mask)
+    {
+        return std::experimental::none_of(mask);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
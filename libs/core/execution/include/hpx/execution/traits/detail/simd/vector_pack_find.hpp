@@ -0,0 +1,28 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(
+        std::experimental::simd_mask<T, Abi> const& mask)
+    {
+        if (std::experimental::any_of(mask))
+        {
+            return std::experimental::find_first_set(mask);
+        }
+        return -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,66 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool all_of(Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isFull();
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool any_of(Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isNotEmpty();
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool none_of(Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isEmpty();
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool all_of(Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::all_of(mask);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool any_of(Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE bool none_of(Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::none_of(mask);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
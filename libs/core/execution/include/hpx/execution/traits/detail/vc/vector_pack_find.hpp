@@ -0,0 +1,52 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(
+        Vc::Mask<T, Abi> const& mask)
+    {
+        if (mask.isNotEmpty())
+        {
+            return mask.firstOne();
+        }
+        return -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_first_of(
+        Vc::mask<T, Abi> const& mask)
+    {
+        if (Vc::any_of(mask))
+        {
+            return Vc::find_first_set(mask);
+        }
+        return -1;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
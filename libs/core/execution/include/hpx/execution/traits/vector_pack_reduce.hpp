@@ -0,0 +1,36 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/functional/detail/invoke.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // Horizontally reduce all elements of the given vector pack using the
+    // given binary operation, the elements are combined in order.
+    template <typename Reduce, typename Vector>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename Vector::value_type reduce(
+        Reduce&& r, Vector const& value)
+    {
+        using value_type = typename Vector::value_type;
+
+        value_type accum = value[0];
+        for (std::size_t i = 1; i != value.size(); ++i)
+        {
+            accum = HPX_INVOKE(r, accum, value_type(value[i]));
+        }
+        return accum;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,22 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+
+namespace hpx { namespace local { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Apply the settings from the hpx.stacks section of the configuration:
+    // guard pages and the stack pool, stack usage profiling, and the
+    // stackless fast path.
+    HPX_CORE_EXPORT void init_stacks(util::runtime_configuration const& ini);
+
+    /// \endcond
+}}}    // namespace hpx::local::detail
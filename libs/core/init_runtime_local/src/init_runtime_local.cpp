@@ -17,6 +17,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/init_runtime_local/detail/init_logging.hpp>
+#include <hpx/init_runtime_local/detail/init_stacks.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -232,11 +233,8 @@ namespace hpx {
             void activate_global_options(
                 local::detail::command_line_handling& cmdline)
             {
-#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
-    defined(__FreeBSD__)
-                threads::coroutines::detail::posix::use_guard_pages =
-                    cmdline.rtcfg_.use_stack_guard_pages();
-#endif
+                init_stacks(cmdline.rtcfg_);
+
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
                 {
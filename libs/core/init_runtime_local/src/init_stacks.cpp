@@ -0,0 +1,67 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/init_runtime_local/detail/init_stacks.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace local { namespace detail {
+
+    void init_stacks(util::runtime_configuration const& ini)
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+        threads::coroutines::detail::posix::use_guard_pages =
+            ini.use_stack_guard_pages();
+        {
+            auto& params =
+                threads::coroutines::detail::posix::stack_pool_params;
+            params.low_watermark = hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.stacks.pool_low_watermark", HPX_STACK_POOL_LOW_WATERMARK);
+            params.high_watermark = hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.stacks.pool_high_watermark",
+                HPX_STACK_POOL_HIGH_WATERMARK);
+            params.prefault_pages = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.stacks.prefault_pages", HPX_STACK_PREFAULT_PAGES);
+            params.arena_stacks = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.stacks.arena_stacks", HPX_STACK_ARENA_STACKS);
+            params.use_huge_pages = hpx::util::get_entry_as<int>(ini,
+                                        "hpx.stacks.use_huge_pages",
+                                        HPX_STACK_USE_HUGE_PAGES) != 0;
+            params.lazy_release = hpx::util::get_entry_as<int>(ini,
+                                      "hpx.stacks.lazy_release",
+                                      HPX_STACK_LAZY_RELEASE) != 0;
+        }
+#endif
+        {
+            threads::stack_usage_parameters params;
+            params.profile = hpx::util::get_entry_as<int>(
+                                 ini, "hpx.stacks.profile_usage", 0) != 0;
+            params.auto_select = hpx::util::get_entry_as<int>(
+                                     ini, "hpx.stacks.auto_select", 0) != 0;
+            params.min_samples = hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.stacks.auto_select_min_samples",
+                HPX_STACK_AUTO_SELECT_MIN_SAMPLES);
+            params.margin = hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.stacks.auto_select_margin", HPX_STACK_AUTO_SELECT_MARGIN);
+            threads::set_stack_usage_parameters(params);
+        }
+        {
+            threads::stackless_fast_path_parameters params;
+            params.enabled = hpx::util::get_entry_as<int>(
+                                 ini, "hpx.stacks.stackless_fast_path", 0) != 0;
+            params.strict = hpx::util::get_entry_as<int>(
+                                ini, "hpx.stacks.stackless_strict", 0) != 0;
+            threads::set_stackless_fast_path_parameters(params);
+        }
+    }
+}}}    // namespace hpx::local::detail
@@ -219,7 +219,35 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_low_watermark = "
+            "${HPX_STACK_POOL_LOW_WATERMARK:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_LOW_WATERMARK)) "}",
+            "pool_high_watermark = "
+            "${HPX_STACK_POOL_HIGH_WATERMARK:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_HIGH_WATERMARK)) "}",
+            "prefault_pages = "
+            "${HPX_STACK_PREFAULT_PAGES:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_PREFAULT_PAGES)) "}",
+            "arena_stacks = "
+            "${HPX_STACK_ARENA_STACKS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_ARENA_STACKS)) "}",
+            "use_huge_pages = "
+            "${HPX_STACK_USE_HUGE_PAGES:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_USE_HUGE_PAGES)) "}",
+            "lazy_release = "
+            "${HPX_STACK_LAZY_RELEASE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_LAZY_RELEASE)) "}",
 #endif
+            "profile_usage = ${HPX_STACK_PROFILE_USAGE:0}",
+            "auto_select = ${HPX_STACK_AUTO_SELECT:0}",
+            "auto_select_min_samples = "
+            "${HPX_STACK_AUTO_SELECT_MIN_SAMPLES:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_AUTO_SELECT_MIN_SAMPLES)) "}",
+            "auto_select_margin = "
+            "${HPX_STACK_AUTO_SELECT_MARGIN:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_AUTO_SELECT_MARGIN)) "}",
+            "stackless_fast_path = ${HPX_STACKLESS_FAST_PATH:0}",
+            "stackless_strict = ${HPX_STACKLESS_STRICT:0}",
 
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
@@ -259,6 +287,9 @@ namespace hpx { namespace util {
             "max_terminated_threads = "
             "${HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS)) "}",
+            "max_idle_threads = "
+            "${HPX_THREAD_QUEUE_MAX_IDLE_THREADS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_IDLE_THREADS)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -309,6 +340,9 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = "
+            "${HPX_AGAS_LOCAL_CACHE_SHARDS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SHARDS)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -638,15 +638,24 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
+                bool steal_half =
+                    victim_threads_[num_thread].data_.hierarchical_;
+                bool stolen = for_each_victim(num_thread, [&](std::size_t idx) {
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
                         num_thread < num_high_priority_queues_)
                     {
                         thread_queue_type* q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, running, true))
+                        if (steal_half)
+                        {
+                            if (this_high_priority_queue->steal_half_pending(
+                                    q, thrd, running))
+                            {
+                                return true;
+                            }
+                        }
+                        else if (q->get_next_thread(thrd, running, true))
                         {
                             q->increment_num_stolen_from_pending();
                             this_high_priority_queue
@@ -655,14 +664,23 @@ namespace hpx { namespace threads { namespace policies {
                         }
                     }
 
-                    if (queues_[idx].data_->get_next_thread(
-                            thrd, running, true))
+                    thread_queue_type* q = queues_[idx].data_;
+                    if (steal_half)
                     {
-                        queues_[idx].data_->increment_num_stolen_from_pending();
+                        return this_queue->steal_half_pending(q, thrd, running);
+                    }
+
+                    if (q->get_next_thread(thrd, running, true))
+                    {
+                        q->increment_num_stolen_from_pending();
                         this_queue->increment_num_stolen_to_pending();
                         return true;
                     }
-                }
+                    return false;
+                });
+
+                if (stolen)
+                    return true;
             }
 
             return low_priority_queue_.get_next_thread(thrd);
@@ -1134,8 +1152,9 @@ namespace hpx { namespace threads { namespace policies {
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
+                bool steal_half =
+                    victim_threads_[num_thread].data_.hierarchical_;
+                bool stolen = for_each_victim(num_thread, [&](std::size_t idx) {
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
@@ -1143,7 +1162,7 @@ namespace hpx { namespace threads { namespace policies {
                     {
                         thread_queue_type* q = high_priority_queues_[idx].data_;
                         result = this_high_priority_queue->wait_or_add_new(
-                                     true, added, q) &&
+                                     true, added, q, false, steal_half) &&
                             result;
 
                         if (0 != added)
@@ -1151,22 +1170,26 @@ namespace hpx { namespace threads { namespace policies {
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue
                                 ->increment_num_stolen_to_staged(added);
-                            return result;
+                            return true;
                         }
                     }
 
+                    thread_queue_type* q = queues_[idx].data_;
                     result = this_queue->wait_or_add_new(
-                                 true, added, queues_[idx].data_) &&
+                                 true, added, q, false, steal_half) &&
                         result;
 
                     if (0 != added)
                     {
-                        queues_[idx].data_->increment_num_stolen_from_staged(
-                            added);
+                        q->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
-                        return result;
+                        return true;
                     }
-                }
+                    return false;
+                });
+
+                if (stolen)
+                    return result;
             }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -1249,13 +1272,15 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_threads = num_queues_;
             auto const& topo = create_topology();
 
-            // get NUMA domain masks of all queues...
+            // get NUMA domain, cache, and core masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> cache_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = affinity_data_.get_pu_num(i);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+                cache_masks[i] = topo.get_cache_affinity_mask(num_pu);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
             }
 
@@ -1263,11 +1288,20 @@ namespace hpx { namespace threads { namespace policies {
             // steal from
             std::ptrdiff_t radius =
                 std::lround(static_cast<double>(num_threads) / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
+
+            victim_data& victims = victim_threads_[num_thread].data_;
+            victims.victims_.clear();
+            victims.victims_.reserve(num_threads);
+            victims.tier_ends_.clear();
+            victims.hierarchical_ =
+                has_scheduler_mode(policies::enable_stealing_hierarchical);
+            victims.random_state_ =
+                static_cast<std::uint32_t>(num_thread + 1) * 2654435761u;
 
             std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type cache_mask = cache_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
@@ -1295,14 +1329,14 @@ namespace hpx { namespace threads { namespace policies {
 
                         if (f(std::size_t(left)))
                         {
-                            victim_threads_[num_thread].data_.push_back(
+                            victims.victims_.push_back(
                                 static_cast<std::size_t>(left));
                         }
 
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.victims_.push_back(right);
                         }
                     }
                     if ((num_threads % 2) == 0)
@@ -1310,9 +1344,10 @@ namespace hpx { namespace threads { namespace policies {
                         std::size_t right = (num_thread + i) % num_threads;
                         if (f(right))
                         {
-                            victim_threads_[num_thread].data_.push_back(right);
+                            victims.victims_.push_back(right);
                         }
                     }
+                    victims.tier_ends_.push_back(victims.victims_.size());
                 };
 
             // check for threads which share the same core...
@@ -1320,11 +1355,30 @@ namespace hpx { namespace threads { namespace policies {
                 return any(core_mask & core_masks[other_num_thread]);
             });
 
-            // check for threads which share the same NUMA domain...
-            iterate([&](std::size_t other_num_thread) {
-                return !any(core_mask & core_masks[other_num_thread]) &&
-                    any(numa_mask & numa_masks[other_num_thread]);
-            });
+            if (victims.hierarchical_)
+            {
+                // check for threads which share the last level cache...
+                iterate([&](std::size_t other_num_thread) {
+                    return !any(core_mask & core_masks[other_num_thread]) &&
+                        any(cache_mask & cache_masks[other_num_thread]) &&
+                        any(numa_mask & numa_masks[other_num_thread]);
+                });
+
+                // check for the remaining threads in the same NUMA domain...
+                iterate([&](std::size_t other_num_thread) {
+                    return !any(core_mask & core_masks[other_num_thread]) &&
+                        !any(cache_mask & cache_masks[other_num_thread]) &&
+                        any(numa_mask & numa_masks[other_num_thread]);
+                });
+            }
+            else
+            {
+                // check for threads which share the same NUMA domain...
+                iterate([&](std::size_t other_num_thread) {
+                    return !any(core_mask & core_masks[other_num_thread]) &&
+                        any(numa_mask & numa_masks[other_num_thread]);
+                });
+            }
 
             // check for the rest and if we are NUMA aware
             if (has_scheduler_mode(policies::enable_stealing_numa) &&
@@ -1369,6 +1423,51 @@ namespace hpx { namespace threads { namespace policies {
         }
 
     protected:
+        // The worker threads a worker thread may steal from, grouped into
+        // tiers of increasing distance (same core, same last level cache,
+        // same NUMA domain, other NUMA domains)
+        struct victim_data
+        {
+            std::vector<std::size_t> victims_;
+            std::vector<std::size_t> tier_ends_;    // end of each tier
+            bool hierarchical_ = false;
+            std::uint32_t random_state_ = 1;
+        };
+
+        // Invoke the given function for the victims of the given worker
+        // thread until it returns true. For hierarchical stealing the
+        // victims of each tier are visited starting at a random position.
+        template <typename F>
+        bool for_each_victim(std::size_t num_thread, F&& f)
+        {
+            victim_data& victims = victim_threads_[num_thread].data_;
+
+            std::size_t begin = 0;
+            for (std::size_t end : victims.tier_ends_)
+            {
+                std::size_t size = end - begin;
+                std::size_t offset = 0;
+                if (victims.hierarchical_ && size > 1)
+                {
+                    // xorshift32
+                    std::uint32_t x = victims.random_state_;
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    victims.random_state_ = x;
+                    offset = x % size;
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if (f(victims.victims_[begin + (offset + i) % size]))
+                        return true;
+                }
+                begin = end;
+            }
+            return false;
+        }
+
         std::atomic<std::size_t> curr_queue_;
 
         detail::affinity_data const& affinity_data_;
@@ -1381,8 +1480,7 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
-            victim_threads_;
+        std::vector<util::cache_line_data<victim_data>> victim_threads_;
     };
 }}}    // namespace hpx::threads::policies
 
@@ -18,12 +18,17 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -153,6 +158,179 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning worker + FIFO stealing at the opposite end, based on
+    // the Chase-Lev work-stealing deque. The owner pushes and pops without
+    // any CAS operations, only thieves have to synchronize on the top end.
+    //
+    // The owner is the first OS-thread that pops from the queue without
+    // stealing. All other threads push into a separate MPMC inbox which is
+    // drained after the deque. Queues that are not associated with a worker
+    // thread (num_thread == -1) have no owner and use the inbox and the
+    // stealing end of the deque only.
+    namespace detail {
+
+        // The deque needs trivially copyable elements. Reference counted
+        // thread ids are stored as raw pointers, holding on to the
+        // reference while inside the queue.
+        template <typename T, typename Enable = void>
+        struct chase_lev_element
+        {
+            using type = T;
+
+            static type store(T const& val) noexcept
+            {
+                return val;
+            }
+
+            static T load(type val) noexcept
+            {
+                return val;
+            }
+        };
+
+        template <>
+        struct chase_lev_element<threads::thread_id_ref>
+        {
+            using type = threads::thread_id_ref::thread_repr*;
+
+            static type store(threads::thread_id_ref const& val) noexcept
+            {
+                return threads::thread_id_ref(val).get().detach();
+            }
+
+            static type store(threads::thread_id_ref&& val) noexcept
+            {
+                return std::move(val).get().detach();
+            }
+
+            static threads::thread_id_ref load(type val) noexcept
+            {
+                return threads::thread_id_ref(
+                    val, threads::thread_id_ref::addref::no);
+            }
+        };
+    }    // namespace detail
+
+    struct chase_lev_lifo;
+
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using element_traits = detail::chase_lev_element<T>;
+        using container_type =
+            hpx::concurrency::chase_lev_deque<typename element_traits::type>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        chase_lev_lifo_backend(size_type initial_size = 0,
+            size_type num_thread = size_type(-1))
+          : deque_(std::size_t(initial_size))
+          , inbox_(std::size_t(initial_size))
+          , has_owner_(num_thread != size_type(-1))
+          , owner_(std::thread::id())
+        {
+        }
+
+        ~chase_lev_lifo_backend()
+        {
+            // release the elements left in the deque
+            typename element_traits::type val;
+            while (deque_.steal(val))
+            {
+                element_traits::load(val);
+            }
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                deque_.push(element_traits::store(val));
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                deque_.push(element_traits::store(std::move(val)));
+                return true;
+            }
+            return inbox_.enqueue(std::move(val));
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            typename element_traits::type v;
+            if (!steal && bind_owner())
+            {
+                if (deque_.pop(v))
+                {
+                    val = element_traits::load(v);
+                    return true;
+                }
+            }
+            else if (deque_.steal(v))
+            {
+                val = element_traits::load(v);
+                return true;
+            }
+            return inbox_.try_dequeue(val);
+        }
+
+        bool empty()
+        {
+            return deque_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return has_owner_ &&
+                owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        bool bind_owner() noexcept
+        {
+            if (!has_owner_)
+            {
+                return false;
+            }
+
+            std::thread::id const this_id = std::this_thread::get_id();
+            std::thread::id owner = owner_.load(std::memory_order_relaxed);
+            if (owner == this_id)
+            {
+                return true;
+            }
+            return owner == std::thread::id() &&
+                owner_.compare_exchange_strong(owner, this_id);
+        }
+
+        container_type deque_;
+        inbox_type inbox_;
+        bool const has_owner_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
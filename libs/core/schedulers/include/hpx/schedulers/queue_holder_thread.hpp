@@ -465,7 +465,10 @@ namespace hpx { namespace threads { namespace policies {
             HPX_ASSERT(data.stacksize >= thread_stacksize::minimal);
             HPX_ASSERT(data.stacksize <= thread_stacksize::maximal);
 
-            std::ptrdiff_t const stacksize =
+            // threads created by the stackless fast path don't get a stack of
+            // their own
+            std::ptrdiff_t const stacksize = data.stackless_fast_path ?
+                parameters_.nostack_stacksize_ :
                 data.scheduler_base->get_stack_size(data.stacksize);
 
             thread_heap_type* heap = nullptr;
@@ -73,6 +73,9 @@ namespace hpx { namespace threads { namespace policies {
             // this scheduler does not support stealing or numa stealing
             mode = scheduler_mode(mode & ~scheduler_mode::enable_stealing);
             mode = scheduler_mode(mode & ~scheduler_mode::enable_stealing_numa);
+            // without stealing nobody could pick up the parent continuation
+            // left behind by child-first spawning
+            mode = scheduler_mode(mode & ~scheduler_mode::spawn_child_first);
             scheduler_base::set_scheduler_mode(mode);
         }
 
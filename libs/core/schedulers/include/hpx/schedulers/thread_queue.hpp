@@ -131,7 +131,10 @@ namespace hpx { namespace threads { namespace policies {
         {
             HPX_ASSERT(lk.owns_lock());
 
-            std::ptrdiff_t const stacksize =
+            // threads created by the stackless fast path don't get a stack of
+            // their own
+            std::ptrdiff_t const stacksize = data.stackless_fast_path ?
+                parameters_.nostack_stacksize_ :
                 data.scheduler_base->get_stack_size(data.stacksize);
 
             thread_heap_type* heap = nullptr;
@@ -274,7 +277,8 @@ namespace hpx { namespace threads { namespace policies {
 
         ///////////////////////////////////////////////////////////////////////
         bool add_new_always(std::size_t& added, thread_queue* addfrom,
-            std::unique_lock<mutex_type>& lk, bool steal = false)
+            std::unique_lock<mutex_type>& lk, bool steal = false,
+            bool steal_half = false)
         {
             HPX_ASSERT(lk.owns_lock());
 
@@ -318,6 +322,24 @@ namespace hpx { namespace threads { namespace policies {
                 }
             }
 
+            // leave at least half of the staged tasks to the queue they were
+            // staged on, a single staged task is taken only if this queue has
+            // no work at all
+            if (steal_half)
+            {
+                std::int64_t staged = addfrom->new_tasks_count_.data_.load(
+                    std::memory_order_relaxed);
+                std::int64_t half = staged / 2;
+                if (half == 0 &&
+                    work_items_count_.data_.load(std::memory_order_relaxed) ==
+                        0)
+                {
+                    half = 1;
+                }
+                if (add_count < 0 || add_count > half)
+                    add_count = half;
+            }
+
             std::size_t addednew = add_new(add_count, addfrom, lk, steal);
             added += addednew;
             return addednew != 0;
@@ -328,31 +350,45 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
+            thread_heap_type* heap = nullptr;
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_front(thrd);
+                heap = &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_front(thrd);
+                heap = &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_front(thrd);
+                heap = &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_front(thrd);
+                heap = &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_front(thrd);
+                heap = &thread_heap_nostack_;
             }
             else
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // don't keep more threads than allowed, this hands the stacks
+            // back to the (per-worker) stack pool
+            if (parameters_.max_idle_threads_ != 0 &&
+                static_cast<std::int64_t>(heap->size()) >=
+                    parameters_.max_idle_threads_)
+            {
+                deallocate(get_thread_id_data(thrd));
+                return;
             }
+
+            heap->push_front(thrd);
         }
 
     public:
@@ -851,6 +887,34 @@ namespace hpx { namespace threads { namespace policies {
             return false;
         }
 
+        /// Steal the next thread to be executed from the given queue and move
+        /// up to half of the remaining pending threads of that queue to this
+        /// one, return false if nothing could be stolen
+        bool steal_half_pending(thread_queue* victim,
+            threads::thread_id_ref_type& thrd, bool allow_stealing) HPX_HOT
+        {
+            std::int64_t work_items_count =
+                victim->work_items_count_.data_.load(std::memory_order_relaxed);
+
+            if (!victim->get_next_thread(thrd, allow_stealing, true))
+                return false;
+
+            std::size_t stolen = 1;
+            for (std::int64_t i = 1; i < work_items_count / 2; ++i)
+            {
+                threads::thread_id_ref_type next;
+                if (!victim->get_next_thread(next, allow_stealing, true))
+                    break;
+
+                schedule_thread(std::move(next));
+                ++stolen;
+            }
+
+            victim->increment_num_stolen_from_pending(stolen);
+            increment_num_stolen_to_pending(stolen);
+            return true;
+        }
+
         /// Schedule the passed thread
         void schedule_thread(
             threads::thread_id_ref_type thrd, bool other_end = false)
@@ -1014,7 +1078,8 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         inline bool wait_or_add_new(bool running, std::size_t& added,
-            thread_queue* addfrom, bool steal = false) HPX_HOT
+            thread_queue* addfrom, bool steal = false,
+            bool steal_half = false) HPX_HOT
         {
             // try to generate new threads from task lists, but only if our
             // own list of threads is empty
@@ -1059,7 +1124,8 @@ namespace hpx { namespace threads { namespace policies {
                     return false;    // avoid long wait on lock
 
                 // stop running after all HPX threads have been terminated
-                bool added_new = add_new_always(added, addfrom, lk, steal);
+                bool added_new =
+                    add_new_always(added, addfrom, lk, steal, steal_half);
                 if (!added_new)
                 {
                     // Before exiting each of the OS threads deletes the
@@ -0,0 +1,373 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> count(0);
+
+std::uint64_t fibonacci(std::uint64_t n)
+{
+    ++count;
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> lhs = hpx::async(&fibonacci, n - 1);
+    std::uint64_t rhs = fibonacci(n - 2);
+
+    return lhs.get() + rhs;
+}
+
+void test_topology()
+{
+    auto const& topo = hpx::threads::create_topology();
+
+    // the last level cache is shared by the processing units of a core and
+    // does not span more than the machine
+    for (std::size_t i = 0; i != topo.get_number_of_pus(); ++i)
+    {
+        hpx::threads::mask_cref_type cache_mask =
+            topo.get_cache_affinity_mask(i);
+        hpx::threads::mask_cref_type core_mask = topo.get_core_affinity_mask(i);
+
+        HPX_TEST(hpx::threads::any(cache_mask));
+        HPX_TEST(hpx::threads::equal(cache_mask & core_mask, core_mask));
+        HPX_TEST(hpx::threads::equal(
+            cache_mask & topo.get_machine_affinity_mask(), cache_mask));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// expose the victims computed by the scheduler for each worker thread
+template <typename Scheduler>
+struct test_scheduler_type : Scheduler
+{
+    using Scheduler::Scheduler;
+
+    std::vector<std::size_t> const& get_victims(std::size_t num_thread) const
+    {
+        return this->victim_threads_[num_thread].data_.victims_;
+    }
+
+    std::vector<std::size_t> const& get_tier_ends(
+        std::size_t num_thread) const
+    {
+        return this->victim_threads_[num_thread].data_.tier_ends_;
+    }
+
+    std::size_t get_pu_num(std::size_t num_thread) const
+    {
+        return this->affinity_data_.get_pu_num(num_thread);
+    }
+};
+
+// the distance between two worker threads, as used for the radial order
+std::size_t distance(std::size_t lhs, std::size_t rhs, std::size_t num_threads)
+{
+    std::size_t const d = lhs < rhs ? rhs - lhs : lhs - rhs;
+    return (std::min)(d, num_threads - d);
+}
+
+template <typename Scheduler>
+void test_victims(test_scheduler_type<Scheduler> const& scheduler)
+{
+    auto const& topo = hpx::threads::create_topology();
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::vector<std::size_t> const& victims = scheduler.get_victims(i);
+        std::vector<std::size_t> const& tier_ends =
+            scheduler.get_tier_ends(i);
+
+        // the victims are split into tiers for threads sharing a core, the
+        // last level cache, the NUMA domain, and (optionally) the rest
+        HPX_TEST(tier_ends.size() == 3 || tier_ends.size() == 4);
+        HPX_TEST(std::is_sorted(tier_ends.begin(), tier_ends.end()));
+        HPX_TEST_EQ(tier_ends.back(), victims.size());
+
+        std::size_t const pu = scheduler.get_pu_num(i);
+        hpx::threads::mask_type const core_mask =
+            topo.get_core_affinity_mask(pu);
+        hpx::threads::mask_type const cache_mask =
+            topo.get_cache_affinity_mask(pu);
+        hpx::threads::mask_type const numa_mask =
+            topo.get_numa_node_affinity_mask(pu);
+
+        std::vector<bool> seen(num_threads, false);
+        std::size_t begin = 0;
+        for (std::size_t tier = 0; tier != tier_ends.size(); ++tier)
+        {
+            std::size_t last_distance = 0;
+            for (std::size_t j = begin; j != tier_ends[tier]; ++j)
+            {
+                std::size_t const victim = victims[j];
+
+                // each other worker thread is visited at most once
+                HPX_TEST_NEQ(victim, i);
+                HPX_TEST_LT(victim, num_threads);
+                if (victim >= num_threads)
+                    continue;
+                HPX_TEST(!seen[victim]);
+                seen[victim] = true;
+
+                std::size_t const victim_pu = scheduler.get_pu_num(victim);
+                bool const same_core = hpx::threads::any(
+                    core_mask & topo.get_core_affinity_mask(victim_pu));
+                bool const same_cache = hpx::threads::any(
+                    cache_mask & topo.get_cache_affinity_mask(victim_pu));
+                bool const same_numa = hpx::threads::any(
+                    numa_mask & topo.get_numa_node_affinity_mask(victim_pu));
+
+                switch (tier)
+                {
+                case 0:
+                    HPX_TEST(same_core);
+                    break;
+                case 1:
+                    HPX_TEST(!same_core && same_cache && same_numa);
+                    break;
+                case 2:
+                    HPX_TEST(!same_core && !same_cache && same_numa);
+                    break;
+                default:
+                    HPX_TEST(!same_numa);
+                    break;
+                }
+
+                // closer worker threads are visited first within each tier
+                std::size_t const d = distance(i, victim, num_threads);
+                HPX_TEST_LTE(last_distance, d);
+                last_distance = d;
+            }
+            begin = tier_ends[tier];
+        }
+
+        // all other worker threads of the same NUMA domain are victims
+        for (std::size_t j = 0; j != num_threads; ++j)
+        {
+            if (j != i &&
+                hpx::threads::any(numa_mask &
+                    topo.get_numa_node_affinity_mask(
+                        scheduler.get_pu_num(j))))
+            {
+                HPX_TEST(seen[j]);
+            }
+        }
+    }
+}
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+// An idle worker thread steals half of the pending threads of its victim at
+// once. The stolen threads block the thief until they are released, so the
+// stolen-to-pending count observed first stems from a single steal.
+template <typename Scheduler>
+void test_steal_half_pending(test_scheduler_type<Scheduler>& scheduler)
+{
+    std::size_t const num_tasks = 64;
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> queued(false);
+    std::atomic<bool> release(false);
+    std::vector<hpx::future<void>> tasks;
+
+    auto wait_for = [](std::atomic<bool> const& flag) {
+        auto const start = std::chrono::steady_clock::now();
+        while (!flag.load() &&
+            std::chrono::steady_clock::now() - start <
+                std::chrono::seconds(10))
+        {
+            continue;
+        }
+    };
+
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_schedule_hint(0));
+
+    hpx::async(exec, [&]() {
+        // this thread keeps its worker thread busy, the other worker thread
+        // has to steal the new threads
+        std::size_t const victim = hpx::get_worker_thread_num();
+        std::size_t const thief = victim == 0 ? 1 : 0;
+
+        std::vector<std::size_t> const& victims =
+            scheduler.get_victims(thief);
+        if (std::find(victims.begin(), victims.end(), victim) ==
+            victims.end())
+        {
+            return;
+        }
+
+        // keep the thief busy until all new threads have been queued
+        hpx::execution::parallel_executor thief_exec(
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(thief)));
+        hpx::future<void> blocker = hpx::async(thief_exec, [&]() {
+            started = true;
+            wait_for(queued);
+        });
+        wait_for(started);
+
+        scheduler.get_num_stolen_to_pending(std::size_t(-1), true);
+
+        hpx::execution::parallel_executor victim_exec(
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(victim)));
+        tasks.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(hpx::async(victim_exec, [&release]() {
+                while (!release.load())
+                    continue;
+            }));
+        }
+        queued = true;
+
+        auto const start = std::chrono::steady_clock::now();
+        std::int64_t stolen = 0;
+        while (stolen == 0 &&
+            std::chrono::steady_clock::now() - start <
+                std::chrono::seconds(10))
+        {
+            stolen = scheduler.get_num_stolen_to_pending(thief, false);
+        }
+        release = true;
+
+        HPX_TEST(started.load());
+        HPX_TEST_LT(std::int64_t(1), stolen);
+        HPX_TEST_LTE(stolen, std::int64_t(num_tasks / 2));
+
+        blocker.get();
+    }).get();
+
+    hpx::wait_all(tasks);
+}
+#endif
+
+std::function<void()> test_victim_selection;
+
+int hpx_main()
+{
+    test_topology();
+    test_victim_selection();
+
+    // many small tasks spawned from all cores
+    std::vector<hpx::future<std::uint64_t>> results;
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        results.push_back(hpx::async(&fibonacci, std::uint64_t(18)));
+    }
+
+    for (auto&& f : results)
+    {
+        HPX_TEST_EQ(f.get(), std::uint64_t(2584));
+    }
+    HPX_TEST_EQ(count.load(), std::size_t(8 * 8361));
+
+    return hpx::local::finalize();
+}
+
+template <typename Scheduler>
+void test_scheduler(int argc, char* argv[], bool two_threads)
+{
+    using scheduler_type = test_scheduler_type<Scheduler>;
+
+    count = 0;
+
+    hpx::local::init_params init_args;
+    if (two_threads)
+    {
+        init_args.cfg = {"hpx.os_threads=2"};
+    }
+
+    init_args.rp_callback = [two_threads](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [two_threads](
+                hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename scheduler_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<scheduler_type> scheduler(
+                    new scheduler_type(init));
+
+                scheduler_type* s = scheduler.get();
+                test_victim_selection = [s, two_threads]() {
+                    test_victims(*s);
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                    if (two_threads)
+                        test_steal_half_pending(*s);
+#endif
+                };
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::do_background_work |
+                    hpx::threads::policies::reduce_thread_priority |
+                    hpx::threads::policies::delay_exit |
+                    hpx::threads::policies::enable_stealing |
+                    hpx::threads::policies::enable_stealing_numa |
+                    hpx::threads::policies::enable_stealing_hierarchical);
+                scheduler->set_scheduler_mode(thread_pool_init.mode_);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    test_victim_selection = nullptr;
+}
+
+int main(int argc, char* argv[])
+{
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv, false);
+        test_scheduler<scheduler_type>(argc, argv, true);
+    }
+
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_lifo>;
+        test_scheduler<scheduler_type>(argc, argv, false);
+        test_scheduler<scheduler_type>(argc, argv, true);
+    }
+#endif
+
+    return hpx::util::report_errors();
+}
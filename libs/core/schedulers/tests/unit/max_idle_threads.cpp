@@ -0,0 +1,90 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The thread queues keep at most hpx.thread_queue.max_idle_threads terminated
+// threads of each stack size for reuse, all others are destroyed and their
+// stacks are handed back to the stack pool of the worker thread.
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+std::size_t const num_threads = 100;
+std::size_t const max_idle_threads = 8;
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#define HPX_TEST_STACK_POOL
+#endif
+
+int hpx_main()
+{
+#if defined(HPX_TEST_STACK_POOL)
+    namespace posix = hpx::threads::coroutines::detail::posix;
+
+    // all threads exist at the same time, each of those needs its own stack
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> gate = p.get_future().share();
+
+    std::vector<hpx::future<std::size_t>> threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([gate]() {
+            gate.get();
+            return static_cast<std::size_t>(
+                hpx::threads::get_thread_id_data(hpx::threads::get_self_id())
+                    ->get_stack_size());
+        }));
+    }
+
+    p.set_value();
+
+    std::size_t const stack_size = threads[0].get();
+    for (auto& f : threads)
+    {
+        f.get();
+    }
+
+    // The terminated threads are cleaned up while the worker is idle. Only
+    // max_idle_threads of those are kept, the stacks of all others end up in
+    // the stack pool of the (only) worker thread.
+    std::size_t const expected = num_threads - 2 * max_idle_threads;
+    for (int i = 0; i != 1000; ++i)
+    {
+        if (posix::get_pooled_stack_count(stack_size, true) >= expected)
+            break;
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    HPX_TEST_LTE(expected, posix::get_pooled_stack_count(stack_size, true));
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1",
+        "hpx.thread_queue.max_idle_threads=" + std::to_string(max_idle_threads),
+        "hpx.stacks.pool_low_watermark=" + std::to_string(num_threads),
+        "hpx.stacks.pool_high_watermark=" + std::to_string(num_threads)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
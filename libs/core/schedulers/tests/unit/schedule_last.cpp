@@ -89,6 +89,13 @@ int main(int argc, char* argv[])
         test_scheduler<scheduler_type>(argc, argv);
     }
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::chase_lev_lifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     {
         using scheduler_type =
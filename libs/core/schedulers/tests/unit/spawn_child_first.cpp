@@ -0,0 +1,211 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> lhs = hpx::async(&fibonacci, n - 1);
+    std::uint64_t rhs = fibonacci(n - 2);
+
+    return lhs.get() + rhs;
+}
+
+int hpx_main()
+{
+    // the new thread is run before async returns
+    {
+        bool run = false;
+        hpx::future<void> f = hpx::async([&run]() { run = true; });
+        HPX_TEST(run);
+        f.get();
+    }
+
+    {
+        bool run = false;
+        hpx::future<void> f =
+            hpx::async(hpx::launch::async, [&run]() { run = true; });
+        HPX_TEST(run);
+        f.get();
+    }
+
+    // recursive task trees produce the same results
+    HPX_TEST_EQ(fibonacci(15), std::uint64_t(610));
+
+    // explicit schedule hints are honored, the new thread is queued
+    {
+        bool run = false;
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_schedule_hint(0));
+        hpx::future<void> f = hpx::async(exec, [&run]() { run = true; });
+        HPX_TEST(!run);
+        f.get();
+        HPX_TEST(run);
+    }
+
+    // threads without a stack can't suspend, the new thread is queued
+    {
+        bool run = false;
+        hpx::future<void> child;
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_stacksize::nostack);
+        hpx::async(exec, [&run, &child]() {
+            child = hpx::async([&run]() { run = true; });
+            HPX_TEST(!run);
+        }).get();
+        child.get();
+        HPX_TEST(run);
+    }
+
+    // threads created by the stackless fast path are given a stack when
+    // suspending, the new thread is run first
+    {
+        using hpx::threads::stackless_fast_path_parameters;
+
+        stackless_fast_path_parameters const params =
+            hpx::threads::get_stackless_fast_path_parameters();
+
+        stackless_fast_path_parameters enabled = params;
+        enabled.enabled = true;
+        enabled.strict = false;
+        hpx::threads::set_stackless_fast_path_parameters(enabled);
+
+        std::int64_t promotions =
+            hpx::threads::get_stackless_promotion_count(false);
+
+        bool run = false;
+        hpx::future<void> child;
+        hpx::async([&run, &child]() {
+            child = hpx::async([&run]() { run = true; });
+            HPX_TEST(run);
+        }).get();
+        child.get();
+
+        // the parent had to suspend to let the new thread run
+        HPX_TEST(
+            hpx::threads::get_stackless_promotion_count(false) > promotions);
+
+        HPX_TEST_EQ(fibonacci(15), std::uint64_t(610));
+
+        hpx::threads::set_stackless_fast_path_parameters(params);
+    }
+
+    // without the mode, the parent continues first (help-first)
+    hpx::threads::remove_scheduler_mode(
+        hpx::threads::policies::spawn_child_first);
+    {
+        bool run = false;
+        hpx::future<void> f = hpx::async([&run]() { run = true; });
+        HPX_TEST(!run);
+        f.get();
+        HPX_TEST(run);
+    }
+
+    return hpx::local::finalize();
+}
+
+template <typename Scheduler, typename F>
+void test_scheduler(int argc, char* argv[], F make_init)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [make_init](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [make_init](
+                hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename Scheduler::init_parameter_type init =
+                    make_init(thread_pool_init, thread_queue_init);
+                std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::do_background_work |
+                    hpx::threads::policies::reduce_thread_priority |
+                    hpx::threads::policies::delay_exit |
+                    hpx::threads::policies::enable_stealing |
+                    hpx::threads::policies::spawn_child_first);
+                scheduler->set_scheduler_mode(thread_pool_init.mode_);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv,
+            [](hpx::threads::thread_pool_init_parameters const& pool_init,
+                hpx::threads::policies::thread_queue_init_parameters const&
+                    queue_init) {
+                return scheduler_type::init_parameter_type(
+                    pool_init.num_threads_, pool_init.affinity_data_,
+                    std::size_t(-1), queue_init);
+            });
+    }
+
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_lifo>;
+        test_scheduler<scheduler_type>(argc, argv,
+            [](hpx::threads::thread_pool_init_parameters const& pool_init,
+                hpx::threads::policies::thread_queue_init_parameters const&
+                    queue_init) {
+                return scheduler_type::init_parameter_type(
+                    pool_init.num_threads_, pool_init.affinity_data_,
+                    std::size_t(-1), queue_init);
+            });
+    }
+#endif
+
+    {
+        using scheduler_type =
+            hpx::threads::policies::shared_priority_queue_scheduler<>;
+        test_scheduler<scheduler_type>(argc, argv,
+            [](hpx::threads::thread_pool_init_parameters const& pool_init,
+                hpx::threads::policies::thread_queue_init_parameters const&
+                    queue_init) {
+                return scheduler_type::init_parameter_type(
+                    pool_init.num_threads_, {1, 1, 1},
+                    pool_init.affinity_data_, queue_init);
+            });
+    }
+
+    return hpx::util::report_errors();
+}
@@ -15,6 +15,7 @@
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -204,6 +205,194 @@ namespace hpx { namespace lcos { namespace local {
         bool closed_;
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free implementation of the bounded channel concept supporting
+    // multiple producers and multiple consumers. The data is stored in a
+    // ring-buffer of cells, each tagged with a sequence number (see Dmitry
+    // Vyukov's bounded MPMC queue). Producers and consumers contend only on
+    // the tail and head counters respectively, they never take a lock.
+    template <typename T>
+    class bounded_lockfree_channel
+    {
+    private:
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+    public:
+        explicit bounded_lockfree_channel(std::size_t size)
+          : size_(size)
+          , buffer_(new cell[size])
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != size_; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        bounded_lockfree_channel(bounded_lockfree_channel&& rhs) noexcept
+          : size_(rhs.size_)
+          , buffer_(std::move(rhs.buffer_))
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
+        }
+
+        bounded_lockfree_channel& operator=(
+            bounded_lockfree_channel&& rhs) noexcept
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            size_ = rhs.size_;
+            buffer_ = std::move(rhs.buffer_);
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_release);
+            return *this;
+        }
+
+        bool get(T* val = nullptr) const noexcept
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            cell* c = nullptr;
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                c = &buffer_[head % size_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq - (head + 1));
+
+                if (diff == 0)
+                {
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            head, head + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the channel is empty
+                    return false;
+                }
+                else
+                {
+                    // another consumer has taken this cell
+                    head = head_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            *val = std::move(c->data_);
+            c->sequence_.store(head + size_, std::memory_order_release);
+
+            return true;
+        }
+
+        bool set(T&& t) noexcept
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            cell* c = nullptr;
+            std::size_t tail = tail_.data_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                c = &buffer_[tail % size_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - tail);
+
+                if (diff == 0)
+                {
+                    if (tail_.data_.compare_exchange_weak(
+                            tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the channel is full
+                    return false;
+                }
+                else
+                {
+                    // another producer has taken this cell
+                    tail = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            c->data_ = std::move(t);
+            c->sequence_.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_lockfree_channel::close",
+                    "attempting to close an already closed channel");
+            }
+            return 0;
+        }
+
+        std::size_t capacity() const
+        {
+            return size_;
+        }
+
+    private:
+        // keep the head and the tail counters in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        // a channel of size n can buffer n items
+        std::size_t size_;
+
+        // channel buffer
+        std::unique_ptr<cell[]> buffer_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // For use with HPX threads, the channel_mpmc defined here is the fastest
     // (even faster than the channel_spsc). Using hpx::util::spinlock as the
@@ -213,4 +402,10 @@ namespace hpx { namespace lcos { namespace local {
     template <typename T>
     using channel_mpmc = bounded_channel<T, hpx::lcos::local::spinlock>;
 
+    // The lock-free channel does not depend on the type of threads used and
+    // scales better than channel_mpmc if many producers and consumers access
+    // the channel concurrently.
+    template <typename T>
+    using channel_mpmc_lockfree = bounded_lockfree_channel<T>;
+
 }}}    // namespace hpx::lcos::local
@@ -38,7 +38,8 @@ constexpr int NUM_TESTS = 100000000;
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
-inline data channel_get(hpx::lcos::local::channel_mpmc<data> const& c)
+template <typename Channel>
+inline data channel_get(Channel const& c)
 {
     data result;
     while (!c.get(&result))
@@ -48,7 +49,8 @@ inline data channel_get(hpx::lcos::local::channel_mpmc<data> const& c)
     return result;
 }
 
-inline void channel_set(hpx::lcos::local::channel_mpmc<data>& c, data&& val)
+template <typename Channel>
+inline void channel_set(Channel& c, data&& val)
 {
     while (!c.set(std::move(val)))    // NOLINT
     {
@@ -58,7 +60,8 @@ inline void channel_set(hpx::lcos::local::channel_mpmc<data>& c, data&& val)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Produce
-double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_0(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -73,7 +76,8 @@ double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
 }
 
 // Consume
-double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_1(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -91,20 +95,32 @@ double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
     return static_cast<double>(end - start) / 1e9;
 }
 
-int hpx_main()
+template <typename Channel>
+void measure_throughput(char const* name)
 {
-    hpx::lcos::local::channel_mpmc<data> c(10000);
+    Channel c(10000);
 
-    hpx::future<double> producer = hpx::async(thread_func_0, std::ref(c));
-    hpx::future<double> consumer = hpx::async(thread_func_1, std::ref(c));
+    hpx::future<double> producer =
+        hpx::async(&thread_func_0<Channel>, std::ref(c));
+    hpx::future<double> consumer =
+        hpx::async(&thread_func_1<Channel>, std::ref(c));
 
     auto producer_time = producer.get();
-    std::cout << "Producer throughput: " << (NUM_TESTS / producer_time)
-              << " [op/s] (" << (producer_time / NUM_TESTS) << " [s/op])\n";
+    std::cout << name << ": Producer throughput: "
+              << (NUM_TESTS / producer_time) << " [op/s] ("
+              << (producer_time / NUM_TESTS) << " [s/op])\n";
 
     auto consumer_time = consumer.get();
-    std::cout << "Consumer throughput: " << (NUM_TESTS / consumer_time)
-              << " [op/s] (" << (consumer_time / NUM_TESTS) << " [s/op])\n";
+    std::cout << name << ": Consumer throughput: "
+              << (NUM_TESTS / consumer_time) << " [op/s] ("
+              << (consumer_time / NUM_TESTS) << " [s/op])\n";
+}
+
+int hpx_main()
+{
+    measure_throughput<hpx::lcos::local::channel_mpmc<data>>("channel_mpmc");
+    measure_throughput<hpx::lcos::local::channel_mpmc_lockfree<data>>(
+        "channel_mpmc_lockfree");
 
     return hpx::local::finalize();
 }
@@ -9,6 +9,7 @@
 #include <hpx/local/future.hpp>
 #include <hpx/local/init.hpp>
 #include <hpx/local/thread.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/synchronization/channel_mpmc.hpp>
 
@@ -20,19 +21,17 @@
 constexpr int NUM_WORKERS = 1000;
 
 ///////////////////////////////////////////////////////////////////////////////
-template <typename T>
-inline T channel_get(hpx::lcos::local::channel_mpmc<T> const& c)
+template <typename Channel, typename T>
+inline void channel_get(Channel const& c, T& result)
 {
-    T result;
     while (!c.get(&result))
     {
         hpx::this_thread::yield();
     }
-    return result;
 }
 
-template <typename T>
-inline void channel_set(hpx::lcos::local::channel_mpmc<T>& c, T val)
+template <typename Channel, typename T>
+inline void channel_set(Channel& c, T val)
 {
     while (!c.set(std::move(val)))    // NOLINT
     {
@@ -41,17 +40,21 @@ inline void channel_set(hpx::lcos::local::channel_mpmc<T>& c, T val)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int thread_func(int i, hpx::lcos::local::channel_mpmc<int>& channel,
-    hpx::lcos::local::channel_mpmc<int>& next)
+template <typename Channel>
+int thread_func(int i, Channel& channel, Channel& next)
 {
     channel_set(channel, i);
-    return channel_get(next);
+
+    int result = 0;
+    channel_get(next, result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main()
+template <typename Channel>
+void test_shift()
 {
-    std::vector<hpx::lcos::local::channel_mpmc<int>> channels;
+    std::vector<Channel> channels;
     channels.reserve(NUM_WORKERS);
 
     std::vector<hpx::future<int>> workers;
@@ -64,8 +67,8 @@ int hpx_main()
 
     for (int i = 0; i != NUM_WORKERS; ++i)
     {
-        workers.push_back(hpx::async(&thread_func, i, std::ref(channels[i]),
-            std::ref(channels[(i + 1) % NUM_WORKERS])));
+        workers.push_back(hpx::async(&thread_func<Channel>, i,
+            std::ref(channels[i]), std::ref(channels[(i + 1) % NUM_WORKERS])));
     }
 
     hpx::wait_all(workers);
@@ -74,6 +77,45 @@ int hpx_main()
     {
         HPX_TEST_EQ((i + 1) % NUM_WORKERS, workers[i].get());
     }
+}
+
+template <typename Channel>
+void test_close()
+{
+    Channel c(2);
+
+    HPX_TEST(c.set(1));
+    HPX_TEST(c.set(2));
+    HPX_TEST(!c.set(3));
+
+    int result = 0;
+    HPX_TEST(c.get());
+    HPX_TEST(c.get(&result));
+    HPX_TEST_EQ(result, 1);
+
+    c.close();
+    HPX_TEST(!c.set(4));
+    HPX_TEST(!c.get(&result));
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    test_shift<hpx::lcos::local::channel_mpmc<int>>();
+    test_shift<hpx::lcos::local::channel_mpmc_lockfree<int>>();
+
+    test_close<hpx::lcos::local::channel_mpmc<int>>();
+    test_close<hpx::lcos::local::channel_mpmc_lockfree<int>>();
 
     hpx::local::finalize();
     return hpx::util::report_errors();
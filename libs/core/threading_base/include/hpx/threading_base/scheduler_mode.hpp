@@ -58,6 +58,17 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers that support it to run work created
+        /// with launch::async child-first (work-first): the spawning thread
+        /// immediately switches to the new task while its own continuation is
+        /// made available for stealing by other cores, as with launch::fork.
+        spawn_child_first = 0x1000,
+        /// This option tells schedulers that support it to steal from the
+        /// cores closest in the hardware topology first (same core, same last
+        /// level cache, same NUMA domain, other NUMA domains), picking a
+        /// random victim within each of those tiers and taking half of the
+        /// victim's work at once. It is evaluated when the scheduler starts.
+        enable_stealing_hierarchical = 0x2000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +94,9 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            spawn_child_first |
+            enable_stealing_hierarchical
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
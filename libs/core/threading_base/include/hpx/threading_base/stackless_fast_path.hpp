@@ -0,0 +1,62 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parameters controlling the stackless fast path for HPX threads.
+    ///
+    /// If enabled, work items created with the default stack size (for
+    /// instance by hpx::async or hpx::post) are not given a stack of their
+    /// own. In the default mode those threads run on a stackful context kept
+    /// by each worker thread, which is handed over to the thread only if it
+    /// suspends (the thread is 'promoted'). Descriptions of threads which
+    /// were promoted are remembered, later threads of the same description
+    /// are created with a stack right away.
+    struct stackless_fast_path_parameters
+    {
+        /// Create work items with the default stack size without a stack
+        bool enabled = false;
+
+        /// Run those threads directly on the stack of the worker thread and
+        /// report an error if they attempt to suspend instead of promoting
+        /// them.
+        bool strict = false;
+    };
+
+    /// Set the parameters of the stackless fast path
+    HPX_CORE_EXPORT void set_stackless_fast_path_parameters(
+        stackless_fast_path_parameters const& params);
+
+    /// Return the parameters of the stackless fast path
+    HPX_CORE_EXPORT stackless_fast_path_parameters const&
+    get_stackless_fast_path_parameters();
+
+    /// Adjust the given data such that the new thread is created without a
+    /// stack if it is eligible for the stackless fast path
+    HPX_CORE_EXPORT void apply_stackless_fast_path(thread_init_data& data);
+
+    /// Return the number of threads created by the stackless fast path
+    HPX_CORE_EXPORT std::int64_t get_stackless_thread_count(bool reset);
+
+    /// Return the number of threads created by the stackless fast path
+    /// which had to be promoted to a stackful context
+    HPX_CORE_EXPORT std::int64_t get_stackless_promotion_count(bool reset);
+
+    namespace detail {
+        // count a thread which was promoted to a stackful context
+        HPX_CORE_EXPORT void count_stackless_promotion(
+            thread_data const* thrd);
+    }    // namespace detail
+}}    // namespace hpx::threads
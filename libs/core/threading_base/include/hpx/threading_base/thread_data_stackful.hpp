@@ -17,6 +17,7 @@
 #include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -65,7 +66,16 @@ namespace hpx { namespace threads {
 
             hpx::execution_base::this_thread::reset_agent ctx(
                 agent_storage, agent_);
-            return coroutine_(set_state_ex(thread_restart_state::signaled));
+            coroutine_type::result_type result =
+                coroutine_(set_state_ex(thread_restart_state::signaled));
+
+            if (HPX_UNLIKELY(detail::profile_stack_usage) &&
+                result.first == thread_schedule_state::terminated)
+            {
+                record_stack_usage(
+                    this->get_description(), coroutine_.get_stack_usage());
+            }
+            return result;
         }
 
 #if defined(HPX_DEBUG)
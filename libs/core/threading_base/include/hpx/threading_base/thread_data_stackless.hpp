@@ -15,6 +15,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -26,6 +27,27 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads {
 
+    namespace detail {
+
+        // The stackful context used to run threads created by the stackless
+        // fast path. Each worker thread keeps one of those for running such
+        // threads, it is handed over to a thread if that thread suspends.
+        struct stackless_carrier
+        {
+            stackless_carrier(coroutine_type::functor_type&& f,
+                thread_id_type id, std::ptrdiff_t stacksize)
+              : coroutine_(std::move(f), id, stacksize)
+              , agent_(coroutine_.impl())
+              , stacksize_(stacksize)
+            {
+            }
+
+            coroutine_type coroutine_;
+            execution_agent agent_;
+            std::ptrdiff_t stacksize_;
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// A \a thread is the representation of a ParalleX thread. It's a first
     /// class object in ParalleX. In our implementation this is a user level
@@ -54,16 +76,35 @@ namespace hpx { namespace threads {
 
         static util::internal_allocator<thread_data_stackless> thread_alloc_;
 
+        // run the thread on a stackful carrier context
+        coroutine_type::result_type call_promotable(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage);
+
     public:
-        stackless_coroutine_type::result_type call()
+        stackless_coroutine_type::result_type call(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage)
         {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            if (promotable_)
+            {
+                return call_promotable(agent_storage);
+            }
+
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
 
+        // Return whether this thread was created by the stackless fast path,
+        // i.e. whether it may suspend
+        bool is_promotable() const noexcept
+        {
+            return promotable_;
+        }
+
 #if defined(HPX_DEBUG)
         thread_id_type get_thread_id() const override
         {
@@ -74,49 +115,70 @@ namespace hpx { namespace threads {
 #if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t get_thread_phase() const noexcept override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.get_thread_phase();
             return coroutine_.get_thread_phase();
         }
 #endif
 
         std::size_t get_thread_data() const override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.get_thread_data();
             return coroutine_.get_thread_data();
         }
 
         std::size_t set_thread_data(std::size_t data) override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.set_thread_data(data);
             return coroutine_.set_thread_data(data);
         }
 
 #if defined(HPX_HAVE_LIBCDS)
         std::size_t get_libcds_data() const override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.get_libcds_data();
             return coroutine_.get_libcds_data();
         }
 
         std::size_t set_libcds_data(std::size_t data) override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.set_libcds_data(data);
             return coroutine_.set_libcds_data(data);
         }
 
         std::size_t get_libcds_hazard_pointer_data() const override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_.get_libcds_hazard_pointer_data();
             return coroutine_.get_libcds_hazard_pointer_data();
         }
 
         std::size_t set_libcds_hazard_pointer_data(std::size_t data) override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_
+                    .set_libcds_hazard_pointer_data(data);
             return coroutine_.set_libcds_hazard_pointer_data(data);
         }
 
         std::size_t get_libcds_dynamic_hazard_pointer_data() const override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_
+                    .get_libcds_dynamic_hazard_pointer_data();
             return coroutine_.get_libcds_dynamic_hazard_pointer_data();
         }
 
         std::size_t set_libcds_dynamic_hazard_pointer_data(
             std::size_t data) override
         {
+            if (carrier_ != nullptr)
+                return carrier_->coroutine_
+                    .set_libcds_dynamic_hazard_pointer_data(data);
             return coroutine_.set_libcds_dynamic_hazard_pointer_data(data);
         }
 #endif
@@ -127,6 +189,9 @@ namespace hpx { namespace threads {
 
             coroutine_.rebind(std::move(init_data.func), thread_id_type(this));
 
+            HPX_ASSERT(carrier_ == nullptr);
+            promotable_ = init_data.stackless_fast_path;
+
             HPX_ASSERT(coroutine_.is_ready());
         }
 
@@ -134,6 +199,8 @@ namespace hpx { namespace threads {
             thread_init_data& init_data, void* queue, std::ptrdiff_t stacksize)
           : thread_data(init_data, queue, stacksize, true)
           , coroutine_(std::move(init_data.func), thread_id_type(this_()))
+          , carrier_(nullptr)
+          , promotable_(init_data.stackless_fast_path)
         {
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -151,6 +218,10 @@ namespace hpx { namespace threads {
 
     private:
         stackless_coroutine_type coroutine_;
+
+        // the carrier context this thread runs on, if any
+        detail::stackless_carrier* carrier_;
+        bool promotable_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,12 @@ namespace hpx { namespace util {
         };
 
         data_type type_;
+
+        // The description was derived from the thread function itself (its
+        // annotation, action name, or address), as opposed to a generic
+        // alternative name or the description of the creating thread.
+        bool identifies_task_ = false;
+
         data data_;
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
         util::itt::string_handle desc_itt_;
@@ -59,6 +65,7 @@ namespace hpx { namespace util {
 
         thread_description(char const* desc) noexcept
           : type_(data_type_description)
+          , identifies_task_(desc != nullptr)
         {
             data_.desc_ = desc ? desc : "<unknown>";
         }
@@ -67,6 +74,7 @@ namespace hpx { namespace util {
         thread_description(
             char const* desc, util::itt::string_handle const& sh) noexcept
           : type_(data_type_description)
+          , identifies_task_(desc != nullptr)
         {
             data_.desc_ = desc ? desc : "<unknown>";
             desc_itt_ = sh;
@@ -88,6 +96,7 @@ namespace hpx { namespace util {
             if (name != nullptr)    // -V547
             {
                 altname = name;
+                identifies_task_ = true;
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
                 desc_itt_ = traits::get_function_annotation_itt<F>::call(f);
 #endif
@@ -102,6 +111,7 @@ namespace hpx { namespace util {
             {
                 type_ = data_type_address;
                 data_.addr_ = traits::get_function_address<F>::call(f);
+                identifies_task_ = true;
             }
 #else
             init_from_alternative_name(altname);
@@ -121,6 +131,7 @@ namespace hpx { namespace util {
         explicit thread_description(
             Action, char const* /* altname */ = nullptr) noexcept
           : type_(data_type_description)
+          , identifies_task_(true)
         {
             data_.desc_ = hpx::actions::detail::get_action_name<Action>();
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
@@ -133,6 +144,13 @@ namespace hpx { namespace util {
             return type_;
         }
 
+        // Return whether this description identifies the thread function,
+        // i.e. whether it is shared only by threads running the same code.
+        constexpr bool identifies_task() const noexcept
+        {
+            return identifies_task_;
+        }
+
         char const* get_description() const noexcept
         {
             HPX_ASSERT(type_ == data_type_description);
@@ -229,6 +247,11 @@ namespace hpx { namespace util {
             return data_type_description;
         }
 
+        constexpr bool identifies_task() const noexcept
+        {
+            return false;
+        }
+
         constexpr char const* get_description() const noexcept
         {
             return "<unknown>";
@@ -0,0 +1,98 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parameters controlling the automatic selection of the stack size of
+    /// HPX threads based on the stack usage observed for earlier threads of
+    /// the same description.
+    struct stack_usage_parameters
+    {
+        /// Measure the stack usage of terminating threads (with page
+        /// granularity) and record the maximum for each thread description.
+        bool profile = false;
+
+        /// Run new threads on the smallest stack which is large enough for
+        /// the usage recorded for their description. Requires \a profile.
+        bool auto_select = false;
+
+        /// Number of threads of a description which have to be observed
+        /// before a smaller stack is selected.
+        std::size_t min_samples = HPX_STACK_AUTO_SELECT_MIN_SAMPLES;
+
+        /// Factor by which a selected stack has to be larger than the
+        /// maximal recorded usage.
+        std::size_t margin = HPX_STACK_AUTO_SELECT_MARGIN;
+    };
+
+    /// Set the parameters used for measuring the stack usage and selecting
+    /// stack sizes. This is a no-op if HPX_HAVE_THREAD_DESCRIPTION is not
+    /// defined or if the stack usage can't be measured on this platform.
+    HPX_CORE_EXPORT void set_stack_usage_parameters(
+        stack_usage_parameters const& params);
+
+    /// Return the parameters used for measuring the stack usage
+    HPX_CORE_EXPORT stack_usage_parameters const& get_stack_usage_parameters();
+
+    /// Record the stack usage of a terminated thread of the given
+    /// description
+    HPX_CORE_EXPORT void record_stack_usage(
+        util::thread_description const& desc, std::ptrdiff_t usage);
+
+    /// Return the maximal stack usage recorded for the given description,
+    /// or zero if nothing was recorded
+    HPX_CORE_EXPORT std::ptrdiff_t get_recorded_stack_usage(
+        util::thread_description const& desc);
+
+    /// Return the stack size to use for a new thread of the given
+    /// description. This returns \a stacksize unless automatic stack size
+    /// selection is enabled and a smaller stack has been found to be
+    /// sufficient.
+    HPX_CORE_EXPORT thread_stacksize select_stack_size(
+        policies::scheduler_base const* scheduler,
+        util::thread_description const& desc, thread_stacksize stacksize);
+
+    /// Record that a thread of the given description created without a
+    /// stack of its own has suspended (and had to be given a stack). Only
+    /// descriptions identifying the thread function are recorded, see
+    /// \a util::thread_description::identifies_task().
+    HPX_CORE_EXPORT void record_stackless_promotion(
+        util::thread_description const& desc);
+
+    /// Return whether a thread of the given description has been recorded
+    /// to suspend while running without a stack of its own. This does not
+    /// take a lock, but may return true for descriptions which have not been
+    /// recorded.
+    HPX_CORE_EXPORT bool get_recorded_stackless_promotion(
+        util::thread_description const& desc);
+
+    /// Reset all recorded stack usages and promotions
+    HPX_CORE_EXPORT void reset_recorded_stack_usage();
+
+    /// Return the number of recorded stack usage samples
+    HPX_CORE_EXPORT std::int64_t get_stack_usage_sample_count(bool reset);
+
+    /// Return the number of threads which were assigned a smaller stack
+    /// than requested
+    HPX_CORE_EXPORT std::int64_t get_stack_size_reassignment_count(bool reset);
+
+    namespace detail {
+        // this global variable is used to avoid the overhead of querying
+        // the stack usage if profiling is disabled
+        HPX_CORE_EXPORT extern bool profile_stack_usage;
+    }    // namespace detail
+}}    // namespace hpx::threads
@@ -12,6 +12,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 
 #include <cstddef>
 
@@ -84,6 +85,16 @@ namespace hpx { namespace threads { namespace detail {
         if (data.priority == thread_priority::default_)
             data.priority = thread_priority::normal;
 
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        // run the thread on a smaller stack if threads of the same kind have
+        // been found not to need the requested one
+        if (HPX_UNLIKELY(get_stack_usage_parameters().auto_select))
+        {
+            data.stacksize =
+                select_stack_size(scheduler, data.description, data.stacksize);
+        }
+#endif
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
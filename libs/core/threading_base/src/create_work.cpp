@@ -10,8 +10,10 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_work.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 
 namespace hpx { namespace threads { namespace detail {
 
@@ -92,6 +94,22 @@ namespace hpx { namespace threads { namespace detail {
             thread_priority::high_recursive == data.priority ||
             thread_priority::boost == data.priority);
 
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+        // run the thread on a smaller stack if threads of the same kind have
+        // been found not to need the requested one
+        if (HPX_UNLIKELY(get_stack_usage_parameters().auto_select))
+        {
+            data.stacksize =
+                select_stack_size(scheduler, data.description, data.stacksize);
+        }
+#endif
+
+        // run the thread without a stack of its own, if possible
+        if (HPX_UNLIKELY(get_stackless_fast_path_parameters().enabled))
+        {
+            apply_stackless_fast_path(data);
+        }
+
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
@@ -0,0 +1,89 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    namespace {
+        stackless_fast_path_parameters stackless_fast_path_params;
+
+        std::atomic<std::int64_t> stackless_thread_count(0);
+        std::atomic<std::int64_t> stackless_promotion_count(0);
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_stackless_fast_path_parameters(
+        stackless_fast_path_parameters const& params)
+    {
+        stackless_fast_path_params = params;
+    }
+
+    stackless_fast_path_parameters const& get_stackless_fast_path_parameters()
+    {
+        return stackless_fast_path_params;
+    }
+
+    void apply_stackless_fast_path(thread_init_data& data)
+    {
+        if (!stackless_fast_path_params.enabled)
+            return;
+
+        thread_stacksize stacksize = data.stacksize;
+        if (stacksize == thread_stacksize::current)
+            stacksize = get_self_stacksize_enum();
+
+        // threads which explicitly asked for a larger stack keep it
+        if (stacksize != thread_stacksize::default_)
+            return;
+
+        if (stackless_fast_path_params.strict)
+        {
+            data.stacksize = thread_stacksize::nostack;
+        }
+        else
+        {
+            // threads of a description which was seen to suspend are given a
+            // stack right away
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            if (get_recorded_stackless_promotion(data.description))
+                return;
+#endif
+            data.stacksize = stacksize;
+            data.stackless_fast_path = true;
+        }
+
+        ++stackless_thread_count;
+    }
+
+    std::int64_t get_stackless_thread_count(bool reset)
+    {
+        return reset ? stackless_thread_count.exchange(0) :
+                       stackless_thread_count.load();
+    }
+
+    std::int64_t get_stackless_promotion_count(bool reset)
+    {
+        return reset ? stackless_promotion_count.exchange(0) :
+                       stackless_promotion_count.load();
+    }
+
+    namespace detail {
+        void count_stackless_promotion(thread_data const* thrd)
+        {
+            ++stackless_promotion_count;
+            record_stackless_promotion(thrd->get_description());
+        }
+    }    // namespace detail
+}}    // namespace hpx::threads
@@ -6,20 +6,106 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
-////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <memory>
+#include <utility>
+
 namespace hpx { namespace threads {
 
     util::internal_allocator<thread_data_stackless>
         thread_data_stackless::thread_alloc_;
 
+    namespace {
+        // the carrier context of the current worker thread, this is empty
+        // while a thread runs on it
+        thread_local std::unique_ptr<detail::stackless_carrier> worker_carrier;
+
+        detail::stackless_carrier* acquire_carrier(
+            coroutine_type::functor_type&& f, thread_id_type id,
+            std::ptrdiff_t stacksize)
+        {
+            std::unique_ptr<detail::stackless_carrier> carrier =
+                std::move(worker_carrier);
+
+            if (carrier && carrier->stacksize_ == stacksize)
+            {
+                carrier->coroutine_.rebind(std::move(f), id);
+                return carrier.release();
+            }
+
+            return new detail::stackless_carrier(std::move(f), id, stacksize);
+        }
+
+        void release_carrier(detail::stackless_carrier* carrier)
+        {
+            // keep the carrier for the next thread, a carrier of a promoted
+            // thread may end up on a different worker thread
+            if (!worker_carrier)
+            {
+                worker_carrier.reset(carrier);
+            }
+            else
+            {
+                delete carrier;
+            }
+        }
+    }    // namespace
+
     thread_data_stackless::~thread_data_stackless()
     {
         LTM_(debug).format(
             "~thread_data_stackless({}), description({}), phase({})", this,
             this->get_description(), this->get_thread_phase());
+
+        delete carrier_;
     }
 
+    coroutine_type::result_type thread_data_stackless::call_promotable(
+        hpx::execution_base::this_thread::detail::agent_storage* agent_storage)
+    {
+        bool const first_run = carrier_ == nullptr;
+        if (first_run)
+        {
+            std::ptrdiff_t const stacksize =
+                get_scheduler_base()->get_stack_size(get_stack_size_enum());
+
+            carrier_ = acquire_carrier(
+                coroutine_.release_function(), thread_id_type(this), stacksize);
+        }
+
+        coroutine_type::result_type result;
+        try
+        {
+            hpx::execution_base::this_thread::reset_agent ctx(
+                agent_storage, carrier_->agent_);
+            result = carrier_->coroutine_(
+                set_state_ex(thread_restart_state::signaled));
+        }
+        catch (...)
+        {
+            // the thread function has exited by throwing an exception
+            release_carrier(carrier_);
+            carrier_ = nullptr;
+            throw;
+        }
+
+        if (result.first == thread_schedule_state::terminated)
+        {
+            release_carrier(carrier_);
+            carrier_ = nullptr;
+        }
+        else if (first_run)
+        {
+            // the thread has suspended, it keeps the carrier from now on
+            detail::count_stackless_promotion(this);
+        }
+
+        return result;
+    }
 }}    // namespace hpx::threads
@@ -0,0 +1,290 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace hpx { namespace threads {
+
+    namespace detail {
+        bool profile_stack_usage = false;
+    }    // namespace detail
+
+    namespace {
+        stack_usage_parameters stack_usage_params;
+
+        std::atomic<std::int64_t> stack_usage_sample_count(0);
+        std::atomic<std::int64_t> stack_size_reassignment_count(0);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        struct stack_usage_entry
+        {
+            std::ptrdiff_t max_usage_ = 0;
+            std::size_t samples_ = 0;
+        };
+
+        // The recorded usages are distributed over several maps to reduce
+        // contention between the worker threads.
+        struct stack_usage_shard
+        {
+            hpx::util::spinlock mtx_;
+            std::unordered_map<std::size_t, stack_usage_entry> entries_;
+        };
+
+        constexpr std::size_t num_stack_usage_shards = 64;
+
+        stack_usage_shard* get_stack_usage_shards()
+        {
+            static stack_usage_shard shards[num_stack_usage_shards];
+            return shards;
+        }
+
+        // Thread descriptions are identified by the address of their name
+        // (which is expected to be a string literal) or the address of the
+        // thread function.
+        std::size_t get_key(util::thread_description const& desc)
+        {
+            if (desc.kind() == util::thread_description::data_type_description)
+            {
+                return reinterpret_cast<std::size_t>(desc.get_description());
+            }
+            return desc.get_address();
+        }
+
+        stack_usage_shard& get_shard(std::size_t key)
+        {
+            return get_stack_usage_shards()[(key >> 4) %
+                num_stack_usage_shards];
+        }
+
+        stack_usage_entry get_entry(util::thread_description const& desc)
+        {
+            std::size_t key = get_key(desc);
+            stack_usage_shard& shard = get_shard(key);
+
+            std::lock_guard<hpx::util::spinlock> l(shard.mtx_);
+            auto it = shard.entries_.find(key);
+            if (it == shard.entries_.end())
+                return stack_usage_entry();
+            return it->second;
+        }
+
+        // The descriptions of threads which were promoted by the stackless
+        // fast path are recorded in a bitmap, as those are looked up for each
+        // newly created thread. This avoids taking a lock for the lookup.
+        // Collisions cause threads of other descriptions to be created with
+        // a stack right away, which is always safe.
+        constexpr std::size_t num_promotion_bits_log2 = 16;
+        constexpr std::size_t num_promotion_words =
+            (std::size_t(1) << num_promotion_bits_log2) / 64;
+
+        std::atomic<std::uint64_t> promoted_descriptions[num_promotion_words];
+
+        std::size_t get_promotion_bit(std::size_t key)
+        {
+            // Fibonacci hashing, the lower bits of the addresses of string
+            // literals and functions carry little information
+            return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >>
+                (64 - num_promotion_bits_log2));
+        }
+#endif
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0) : value.load();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_stack_usage_parameters(stack_usage_parameters const& params)
+    {
+        stack_usage_params = params;
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION) &&                                    \
+    (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+        defined(__FreeBSD__) || defined(__APPLE__))
+        // selecting stack sizes requires the usage to be measured
+        bool profile = params.profile || params.auto_select;
+
+        detail::profile_stack_usage = profile;
+        coroutines::detail::posix::measure_stack_usage = profile;
+#else
+        stack_usage_params.profile = false;
+        stack_usage_params.auto_select = false;
+#endif
+    }
+
+    stack_usage_parameters const& get_stack_usage_parameters()
+    {
+        return stack_usage_params;
+    }
+
+    void record_stack_usage(
+        util::thread_description const& desc, std::ptrdiff_t usage)
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        // a usage of zero means that it could not be measured
+        if (usage <= 0 || !desc.valid())
+            return;
+
+        std::size_t key = get_key(desc);
+        stack_usage_shard& shard = get_shard(key);
+
+        {
+            std::lock_guard<hpx::util::spinlock> l(shard.mtx_);
+
+            stack_usage_entry& entry = shard.entries_[key];
+            if (entry.max_usage_ < usage)
+                entry.max_usage_ = usage;
+            ++entry.samples_;
+        }
+
+        ++stack_usage_sample_count;
+#else
+        HPX_UNUSED(desc);
+        HPX_UNUSED(usage);
+#endif
+    }
+
+    std::ptrdiff_t get_recorded_stack_usage(
+        util::thread_description const& desc)
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return get_entry(desc).max_usage_;
+#else
+        HPX_UNUSED(desc);
+        return 0;
+#endif
+    }
+
+    thread_stacksize select_stack_size(
+        policies::scheduler_base const* scheduler,
+        util::thread_description const& desc, thread_stacksize stacksize)
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        if (!stack_usage_params.auto_select || !desc.valid())
+            return stacksize;
+
+        if (stacksize == thread_stacksize::current)
+            stacksize = get_self_stacksize_enum();
+
+        // threads without a stack can't be moved to a smaller one
+        if (stacksize < thread_stacksize::small_ ||
+            stacksize > thread_stacksize::huge)
+        {
+            return stacksize;
+        }
+
+        stack_usage_entry entry = get_entry(desc);
+        if (entry.samples_ < stack_usage_params.min_samples ||
+            entry.max_usage_ == 0)
+        {
+            return stacksize;
+        }
+
+        std::ptrdiff_t const required = entry.max_usage_ *
+            static_cast<std::ptrdiff_t>(stack_usage_params.margin);
+        std::ptrdiff_t const requested = scheduler->get_stack_size(stacksize);
+
+        for (thread_stacksize candidate :
+            {thread_stacksize::small_, thread_stacksize::medium,
+                thread_stacksize::large})
+        {
+            std::ptrdiff_t size = scheduler->get_stack_size(candidate);
+            if (size >= requested)
+                break;
+
+            if (size >= required)
+            {
+                ++stack_size_reassignment_count;
+                return candidate;
+            }
+        }
+#else
+        HPX_UNUSED(scheduler);
+        HPX_UNUSED(desc);
+#endif
+        return stacksize;
+    }
+
+    void record_stackless_promotion(util::thread_description const& desc)
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        // descriptions shared by unrelated threads (such as the one inherited
+        // from the creating thread) would disable the fast path for all of
+        // those
+        if (!desc.valid() || !desc.identifies_task())
+            return;
+
+        std::size_t bit = get_promotion_bit(get_key(desc));
+        promoted_descriptions[bit / 64].fetch_or(
+            std::uint64_t(1) << (bit % 64), std::memory_order_relaxed);
+#else
+        HPX_UNUSED(desc);
+#endif
+    }
+
+    bool get_recorded_stackless_promotion(util::thread_description const& desc)
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        if (!desc.valid() || !desc.identifies_task())
+            return false;
+
+        std::size_t bit = get_promotion_bit(get_key(desc));
+        return (promoted_descriptions[bit / 64].load(
+                    std::memory_order_relaxed) &
+                   (std::uint64_t(1) << (bit % 64))) != 0;
+#else
+        HPX_UNUSED(desc);
+        return false;
+#endif
+    }
+
+    void reset_recorded_stack_usage()
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        stack_usage_shard* shards = get_stack_usage_shards();
+        for (std::size_t i = 0; i != num_stack_usage_shards; ++i)
+        {
+            std::lock_guard<hpx::util::spinlock> l(shards[i].mtx_);
+            shards[i].entries_.clear();
+        }
+
+        for (std::size_t i = 0; i != num_promotion_words; ++i)
+        {
+            promoted_descriptions[i].store(0, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    std::int64_t get_stack_usage_sample_count(bool reset)
+    {
+        return get_and_reset(stack_usage_sample_count, reset);
+    }
+
+    std::int64_t get_stack_size_reassignment_count(bool reset)
+    {
+        return get_and_reset(stack_size_reassignment_count, reset);
+    }
+}}    // namespace hpx::threads
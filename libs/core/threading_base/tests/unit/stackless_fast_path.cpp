@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads created by the stackless fast path are
+// promoted to a stackful context if they suspend, and that threads without
+// a stack (including those created by the stackless fast path in strict mode)
+// report an error if they attempt to suspend.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+void test_no_suspension()
+{
+    std::int64_t threads = hpx::threads::get_stackless_thread_count(false);
+
+    std::vector<hpx::future<std::size_t>> futures;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async([i]() { return 2 * i; }));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), 2 * i);
+    }
+
+    HPX_TEST(hpx::threads::get_stackless_thread_count(false) >= threads + 1000);
+}
+
+void test_promotion()
+{
+    // forget about threads which were promoted before
+    hpx::threads::reset_recorded_stack_usage();
+
+    std::int64_t promotions =
+        hpx::threads::get_stackless_promotion_count(false);
+
+    // threads which suspend are given a stack and continue to work
+    std::vector<hpx::future<std::size_t>> futures;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        futures.push_back(hpx::async([i]() {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+            hpx::this_thread::yield();
+            return hpx::async([i]() { return 2 * i; }).get();
+        }));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), 2 * i);
+    }
+
+    HPX_TEST(hpx::threads::get_stackless_promotion_count(false) > promotions);
+
+    // The threads above have no description of their own, other threads
+    // without one still use the fast path.
+    std::int64_t threads = hpx::threads::get_stackless_thread_count(false);
+
+    std::vector<hpx::future<std::size_t>> siblings;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        siblings.push_back(hpx::async([i]() { return 2 * i; }));
+    }
+
+    for (std::size_t i = 0; i != siblings.size(); ++i)
+    {
+        HPX_TEST_EQ(siblings[i].get(), 2 * i);
+    }
+
+    HPX_TEST(hpx::threads::get_stackless_thread_count(false) >= threads + 100);
+}
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+char const* const promoted_name = "stackless_fast_path_promoted";
+
+void test_recorded_promotion()
+{
+    hpx::threads::reset_recorded_stack_usage();
+
+    std::int64_t promotions =
+        hpx::threads::get_stackless_promotion_count(false);
+
+    hpx::async(hpx::annotated_function(
+                   []() { hpx::this_thread::yield(); }, promoted_name))
+        .get();
+
+    HPX_TEST(hpx::threads::get_stackless_promotion_count(false) > promotions);
+    HPX_TEST(hpx::threads::get_recorded_stackless_promotion(
+        hpx::util::thread_description(promoted_name)));
+
+    // threads annotated like the one which suspended are given a stack right
+    // away
+    std::int64_t threads = hpx::threads::get_stackless_thread_count(false);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async(hpx::annotated_function(
+            []() { hpx::this_thread::yield(); }, promoted_name)));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST(hpx::threads::get_stackless_thread_count(false) < threads + 100);
+
+    hpx::threads::reset_recorded_stack_usage();
+}
+#endif
+
+void test_nostack_suspension()
+{
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_stacksize::nostack);
+
+    hpx::future<void> f = hpx::async(exec, []() { hpx::this_thread::yield(); });
+
+    bool caught_exception = false;
+    try
+    {
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_strict()
+{
+    using hpx::threads::stackless_fast_path_parameters;
+
+    stackless_fast_path_parameters const params =
+        hpx::threads::get_stackless_fast_path_parameters();
+
+    stackless_fast_path_parameters strict = params;
+    strict.strict = true;
+    hpx::threads::set_stackless_fast_path_parameters(strict);
+
+    std::int64_t threads = hpx::threads::get_stackless_thread_count(false);
+    std::int64_t promotions =
+        hpx::threads::get_stackless_promotion_count(false);
+
+    // threads which do not suspend run without a stack
+    std::vector<hpx::future<std::size_t>> futures;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([i]() { return 2 * i; }));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), 2 * i);
+    }
+
+    HPX_TEST(hpx::threads::get_stackless_thread_count(false) >= threads + 100);
+
+    // threads which attempt to suspend report an error instead of being
+    // promoted
+    hpx::future<void> f = hpx::async([]() { hpx::this_thread::yield(); });
+
+    bool caught_exception = false;
+    try
+    {
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(hpx::threads::get_stackless_promotion_count(false), promotions);
+
+    // threads which explicitly ask for a larger stack are not affected
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_stacksize::medium);
+    hpx::async(exec, []() { hpx::this_thread::yield(); }).get();
+
+    hpx::threads::set_stackless_fast_path_parameters(params);
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::get_stackless_fast_path_parameters().enabled);
+
+    test_no_suspension();
+    test_promotion();
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    test_recorded_promotion();
+#endif
+    test_nostack_suspension();
+    test_strict();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init_params iparams;
+    iparams.cfg = {"hpx.stacks.stackless_fast_path=1"};
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, iparams), 0);
+
+    return hpx::util::report_errors();
+}
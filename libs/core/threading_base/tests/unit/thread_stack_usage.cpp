@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the stack usage of threads is recorded and that new
+// threads are assigned the smallest sufficient stack size.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+char const* const selection_name = "thread_stack_usage_selection";
+char const* const profiling_name = "thread_stack_usage_profiling";
+
+constexpr std::size_t buffer_size = 3 * 4096;
+
+using hpx::threads::thread_stacksize;
+
+void test_selection()
+{
+    hpx::threads::reset_recorded_stack_usage();
+    hpx::threads::get_stack_size_reassignment_count(true);
+
+    hpx::util::thread_description desc(selection_name);
+    hpx::threads::policies::scheduler_base const* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+
+    std::ptrdiff_t small_size =
+        scheduler->get_stack_size(thread_stacksize::small_);
+
+    // nothing recorded yet
+    HPX_TEST_EQ(hpx::threads::select_stack_size(
+                    scheduler, desc, thread_stacksize::large),
+        thread_stacksize::large);
+
+    // not enough samples yet
+    for (int i = 0; i != 3; ++i)
+    {
+        hpx::threads::record_stack_usage(desc, small_size / 4);
+    }
+    HPX_TEST_EQ(hpx::threads::select_stack_size(
+                    scheduler, desc, thread_stacksize::large),
+        thread_stacksize::large);
+
+    hpx::threads::record_stack_usage(desc, small_size / 4);
+    HPX_TEST_EQ(hpx::threads::get_recorded_stack_usage(desc), small_size / 4);
+    HPX_TEST_EQ(hpx::threads::select_stack_size(
+                    scheduler, desc, thread_stacksize::large),
+        thread_stacksize::small_);
+    HPX_TEST_EQ(hpx::threads::get_stack_size_reassignment_count(false),
+        std::int64_t(1));
+
+    // the small stack does not provide enough headroom anymore
+    hpx::threads::record_stack_usage(desc, small_size);
+    HPX_TEST_EQ(hpx::threads::get_recorded_stack_usage(desc), small_size);
+
+    thread_stacksize selected = hpx::threads::select_stack_size(
+        scheduler, desc, thread_stacksize::huge);
+    HPX_TEST_NEQ(selected, thread_stacksize::small_);
+    HPX_TEST(scheduler->get_stack_size(selected) >= 2 * small_size);
+
+    // stacks are never enlarged, threads without stack are not touched
+    HPX_TEST_EQ(hpx::threads::select_stack_size(
+                    scheduler, desc, thread_stacksize::small_),
+        thread_stacksize::small_);
+    HPX_TEST_EQ(hpx::threads::select_stack_size(
+                    scheduler, desc, thread_stacksize::nostack),
+        thread_stacksize::nostack);
+}
+
+void test_profiling()
+{
+    hpx::threads::reset_recorded_stack_usage();
+
+    std::int64_t samples =
+        hpx::threads::get_stack_usage_sample_count(false);
+
+    hpx::async(hpx::annotated_function(
+                   []() {
+                       // write through a volatile pointer to keep the
+                       // compiler from eliding the buffer
+                       char buffer[buffer_size];
+                       char volatile* p = buffer;
+                       for (std::size_t i = 0; i != buffer_size; ++i)
+                           p[i] = 1;
+                   },
+                   profiling_name))
+        .get();
+
+    // the stack usage is recorded only after the future has become ready,
+    // while the thread terminates
+    for (int i = 0; i != 1000; ++i)
+    {
+        if (hpx::threads::get_stack_usage_sample_count(false) > samples)
+            break;
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST(hpx::threads::get_stack_usage_sample_count(false) > samples);
+
+    std::ptrdiff_t usage = hpx::threads::get_recorded_stack_usage(
+        hpx::util::thread_description(profiling_name));
+    HPX_TEST(usage >= std::ptrdiff_t(buffer_size));
+}
+#endif
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // selecting stack sizes is not supported on all platforms
+    if (hpx::threads::get_stack_usage_parameters().auto_select)
+    {
+        test_selection();
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(__linux__) &&               \
+    !defined(HPX_HAVE_ADDRESS_SANITIZER)
+        test_profiling();
+#endif
+    }
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init_params iparams;
+    iparams.cfg = {"hpx.stacks.auto_select=1",
+        "hpx.stacks.auto_select_min_samples=4",
+        "hpx.stacks.auto_select_margin=2"};
+    hpx::local::init(hpx_main, argc, argv, iparams);
+
+    return hpx::util::report_errors();
+}
@@ -177,6 +177,16 @@ namespace hpx { namespace threads {
         mask_type get_numa_node_affinity_mask_from_numa_node(
             std::size_t num_node) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit available to the given thread sharing
+        ///        the last level cache with it (usually the L3 cache).
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(
+            std::size_t num_thread, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread inside
         ///        the core it is running on.
@@ -355,6 +365,8 @@ namespace hpx { namespace threads {
                 get_numa_node_number(num_thread));
         }
 
+        mask_type init_cache_affinity_mask(std::size_t num_thread) const;
+
         mask_type init_core_affinity_mask(std::size_t num_thread) const
         {
             mask_type default_mask = numa_node_affinity_masks_[num_thread];
@@ -403,6 +415,7 @@ namespace hpx { namespace threads {
         mask_type machine_affinity_mask_;
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
+        std::vector<mask_type> cache_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
     };
@@ -104,6 +104,16 @@ namespace hpx { namespace threads { namespace detail {
         return static_cast<std::size_t>(obj->logical_index);
     }
 
+    bool is_data_cache_obj(hwloc_obj_t obj) noexcept
+    {
+#if HWLOC_API_VERSION >= 0x00020000
+        return hwloc_obj_type_is_dcache(obj->type);
+#else
+        return obj->type == HWLOC_OBJ_CACHE &&
+            obj->attr->cache.type != HWLOC_OBJ_CACHE_INSTRUCTION;
+#endif
+    }
+
     hwloc_obj_t adjust_node_obj(hwloc_obj_t node) noexcept
     {
 #if HWLOC_API_VERSION >= 0x00020000
@@ -282,6 +292,7 @@ namespace hpx { namespace threads {
         machine_affinity_mask_ = init_machine_affinity_mask();
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
+        cache_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
@@ -296,6 +307,11 @@ namespace hpx { namespace threads {
                 init_numa_node_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.push_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
@@ -337,6 +353,8 @@ namespace hpx { namespace threads {
             "socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask(
             "numa_node_affinity_mask", numa_node_affinity_masks_);
+        detail::write_to_log_mask(
+            "cache_affinity_mask", cache_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
@@ -438,6 +456,25 @@ namespace hpx { namespace threads {
         return empty_mask;
     }    // }}}
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, error_code& ec) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "hpx::threads::topology::get_cache_affinity_mask",
+            "thread number {1} is out of range", num_thread);
+        return empty_mask;
+    }
+
     mask_cref_type topology::get_core_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -1087,6 +1124,38 @@ namespace hpx { namespace threads {
         return machine_affinity_mask_;
     }    // }}}
 
+    mask_type topology::init_cache_affinity_mask(std::size_t num_thread) const
+    {    // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t cache_obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            hwloc_obj_t obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+
+            // the outermost data cache above the processing unit is the last
+            // level cache
+            for (/**/; obj != nullptr; obj = obj->parent)
+            {
+                if (detail::is_data_cache_obj(obj))
+                    cache_obj = obj;
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        // without any cache information assume the NUMA domain shares a cache
+        return numa_node_affinity_masks_[num_thread];
+    }    // }}}
+
     mask_type topology::init_core_affinity_mask_from_core(
         std::size_t core, mask_cref_type default_mask) const
     {    // {{{
@@ -1553,6 +1622,8 @@ namespace hpx { namespace threads {
         print_mask_vector(os, socket_affinity_masks_);
         os << "numa node             : \n";
         print_mask_vector(os, numa_node_affinity_masks_);
+        os << "last level cache      : \n";
+        print_mask_vector(os, cache_affinity_masks_);
         os << "core                  : \n";
         print_mask_vector(os, core_affinity_masks_);
         os << "PUs (/threads)        : \n";
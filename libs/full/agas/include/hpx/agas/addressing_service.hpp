@@ -67,11 +67,16 @@ namespace hpx { namespace agas {
         using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
             hpx::util::cache::statistics::local_full_statistics>;
 
+        // The gva cache is partitioned into independently locked shards, each
+        // holding an LRU cache. Keys are assigned to shards based on blocks
+        // of consecutive GIDs.
+        struct gva_cache_shard;
+
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
-        std::shared_ptr<gva_cache_type> gva_cache_;
+        std::size_t const gva_cache_num_shards_;
+        std::shared_ptr<gva_cache_shard[]> gva_cache_shards_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -224,6 +229,17 @@ namespace hpx { namespace agas {
         bool was_object_migrated_locked(naming::gid_type const& id);
 
     private:
+        /// Return the gva cache shard responsible for the given GID
+        gva_cache_shard& get_gva_cache_shard(naming::gid_type const& gid);
+
+        /// Invoke f for all gva cache shards overlapping the given key
+        template <typename F>
+        void for_each_gva_cache_shard(gva_cache_key const& key, F&& f);
+
+        /// Accumulate a value over all gva cache shards
+        template <typename F>
+        std::uint64_t accumulate_gva_cache_shards(F&& f);
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests(
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
@@ -1193,6 +1209,24 @@ namespace hpx { namespace agas {
         void pre_cache_endpoints(std::vector<parcelset::endpoints_type> const&);
     };
 
+    namespace detail {
+
+        // Cache entries are assigned to shards based on blocks of consecutive
+        // GIDs. This keeps ranges of GIDs (as created by bulk operations)
+        // confined to few shards while still distributing objects created on
+        // the same locality over all shards.
+        constexpr std::uint64_t gva_cache_block_bits = 6;
+
+        /// Return the first gva cache shard holding entries for the given GID
+        HPX_EXPORT std::size_t get_gva_cache_first_shard(
+            naming::gid_type const& gid, std::size_t num_shards);
+
+        /// Return the number of consecutive gva cache shards (starting at the
+        /// first shard of \a first) overlapping the GIDs [first, last]
+        HPX_EXPORT std::size_t get_gva_cache_shard_count(
+            naming::gid_type const& first, naming::gid_type const& last,
+            std::size_t num_shards);
+    }    // namespace detail
 }}    // namespace hpx::agas
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -18,6 +18,7 @@
 #include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components_base/traits/component_supports_migration.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/execution_base/register_locks.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -77,6 +78,12 @@ namespace hpx { namespace agas {
             return key_.first;
         }
 
+        // the last GID covered by this key
+        naming::gid_type get_last_gid() const
+        {
+            return key_.second;
+        }
+
         std::uint64_t get_count() const
         {
             naming::gid_type const size = key_.second - key_.first;
@@ -117,9 +124,72 @@ namespace hpx { namespace agas {
         }
     };    // }}}
 
+    namespace detail {
+        struct gva_cache_shard_data
+        {
+            mutable addressing_service::mutex_type mtx_;
+            addressing_service::gva_cache_type cache_;
+        };
+    }    // namespace detail
+
+    // avoid false sharing between neighboring shards
+    struct addressing_service::gva_cache_shard
+      : util::cache_aligned_data_derived<detail::gva_cache_shard_data>
+    {
+    };
+
+    namespace detail {
+
+        std::size_t get_gva_cache_num_shards(
+            util::runtime_configuration const& ini)
+        {
+            std::size_t num_shards = hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.agas.local_cache_shards", HPX_AGAS_LOCAL_CACHE_SHARDS);
+            return num_shards != 0 ? num_shards : 1;
+        }
+
+        std::size_t get_gva_cache_shard_size(
+            std::size_t cache_size, std::size_t num_shards)
+        {
+            if (cache_size == std::size_t(~0x0ul))
+            {
+                return cache_size;
+            }
+            return (cache_size + num_shards - 1) / num_shards;
+        }
+
+        std::size_t get_gva_cache_first_shard(
+            naming::gid_type const& gid, std::size_t num_shards)
+        {
+            // mix the MSB (which holds the locality id) into the block number
+            std::uint64_t const msb_hash =
+                (gid.get_msb() * 0x9e3779b97f4a7c15ull) >> 32;
+            return static_cast<std::size_t>(
+                (msb_hash + (gid.get_lsb() >> gva_cache_block_bits)) %
+                num_shards);
+        }
+
+        std::size_t get_gva_cache_shard_count(naming::gid_type const& first,
+            naming::gid_type const& last, std::size_t num_shards)
+        {
+            if (first.get_msb() == last.get_msb())
+            {
+                std::uint64_t const num_blocks =
+                    (last.get_lsb() >> gva_cache_block_bits) -
+                    (first.get_lsb() >> gva_cache_block_bits) + 1;
+                if (num_blocks < num_shards)
+                {
+                    return static_cast<std::size_t>(num_blocks);
+                }
+            }
+            return num_shards;
+        }
+    }    // namespace detail
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_cache_num_shards_(detail::get_gva_cache_num_shards(ini_))
+      , gva_cache_shards_(new gva_cache_shard[gva_cache_num_shards_])
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -135,7 +205,14 @@ namespace hpx { namespace agas {
       , locality_()
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        {
+            std::size_t const shard_size = detail::get_gva_cache_shard_size(
+                ini_.get_agas_local_cache_size(), gva_cache_num_shards_);
+            for (std::size_t i = 0; i != gva_cache_num_shards_; ++i)
+            {
+                gva_cache_shards_[i].cache_.reserve(shard_size);
+            }
+        }
     }
 
     void addressing_service::bootstrap(
@@ -192,8 +269,18 @@ namespace hpx { namespace agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+            std::size_t const shard_size = detail::get_gva_cache_shard_size(
+                cache_size, gva_cache_num_shards_);
+
+            std::size_t previous = 0;
+            for (std::size_t i = 0; i != gva_cache_num_shards_; ++i)
+            {
+                gva_cache_shard& shard = gva_cache_shards_[i];
+
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                previous += shard.cache_.size();
+                shard.cache_.reserve(shard_size);
+            }
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1653,9 +1740,11 @@ namespace hpx { namespace agas {
 
             const gva_cache_key key(gid, count);
 
-            {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
+            // ranges of GIDs are stored in all shards they overlap with
+            bool corrupted = false;
+            for_each_gva_cache_shard(key, [&](gva_cache_shard& shard) {
+                std::unique_lock<mutex_type> lock(shard.mtx_);
+                if (!shard.cache_.update_if(key, g, check_for_collisions))
                 {
                     if (LAGAS_ENABLED(warning))
                     {
@@ -1663,14 +1752,10 @@ namespace hpx { namespace agas {
                         addressing_service::gva_cache_key idbase;
                         addressing_service::gva_cache_type::entry_type e;
 
-                        if (!gva_cache_->get_entry(key, idbase, e))
+                        if (!shard.cache_.get_entry(key, idbase, e))
                         {
                             // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
+                            corrupted = true;
                             return;
                         }
 
@@ -1682,6 +1767,14 @@ namespace hpx { namespace agas {
                             gid, count, idbase.get_gid(), idbase.get_count());
                     }
                 }
+            });
+
+            if (corrupted)
+            {
+                HPX_THROWS_IF(ec, invalid_data,
+                    "addressing_service::update_cache_entry",
+                    "data corruption or lock error occurred in cache");
+                return;
             }
 
             if (&ec != &throws)
@@ -1704,8 +1797,10 @@ namespace hpx { namespace agas {
         gva_cache_key k(gid);
         gva_cache_key idbase_key;
 
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-        if (gva_cache_->get_entry(k, idbase_key, gva))
+        gva_cache_shard& shard = get_gva_cache_shard(k.get_gid());
+
+        std::unique_lock<mutex_type> lock(shard.mtx_);
+        if (shard.cache_.get_entry(k, idbase_key, gva))
         {
             const std::uint64_t id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
@@ -1741,9 +1836,13 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+            for (std::size_t i = 0; i != gva_cache_num_shards_; ++i)
+            {
+                gva_cache_shard& shard = gva_cache_shards_[i];
 
-            gva_cache_->clear();
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                shard.cache_.clear();
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1788,11 +1887,17 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
+            // the entry may have been stored in more than one shard
+            auto ep = [&gid](std::pair<gva_cache_key, gva> const& p) {
                 return gid == p.first.get_gid();
-            });
+            };
+            for (std::size_t i = 0; i != gva_cache_num_shards_; ++i)
+            {
+                gva_cache_shard& shard = gva_cache_shards_[i];
+
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                shard.cache_.erase(ep);
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1815,86 +1920,138 @@ namespace hpx { namespace agas {
         send_refcnt_requests_sync(l, ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    addressing_service::gva_cache_shard&
+    addressing_service::get_gva_cache_shard(naming::gid_type const& gid)
+    {
+        return gva_cache_shards_[detail::get_gva_cache_first_shard(
+            gid, gva_cache_num_shards_)];
+    }
+
+    template <typename F>
+    void addressing_service::for_each_gva_cache_shard(
+        gva_cache_key const& key, F&& f)
+    {
+        naming::gid_type const first = key.get_gid();
+
+        // number of consecutive shards overlapping with the given range
+        std::size_t const num_shards = detail::get_gva_cache_shard_count(
+            first, key.get_last_gid(), gva_cache_num_shards_);
+
+        std::size_t const first_shard =
+            detail::get_gva_cache_first_shard(first, gva_cache_num_shards_);
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            f(gva_cache_shards_[(first_shard + i) % gva_cache_num_shards_]);
+        }
+    }
+
+    template <typename F>
+    std::uint64_t addressing_service::accumulate_gva_cache_shards(F&& f)
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != gva_cache_num_shards_; ++i)
+        {
+            gva_cache_shard& shard = gva_cache_shards_[i];
+
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            result += f(shard.cache_);
+        }
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        return accumulate_gva_cache_shards(
+            [](gva_cache_type const& cache) { return cache.size(); });
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().hits(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().misses(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().evictions(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().insertions(reset);
+        });
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_get_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_insert_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_update_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return accumulate_gva_cache_shards([reset](gva_cache_type& cache) {
+            return cache.get_statistics().get_erase_entry_time(reset);
+        });
     }
 
     void addressing_service::register_server_instances()
@@ -54,17 +54,18 @@ namespace hpx { namespace agas { namespace server {
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            table_shard& s = get_shard(gid);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
             error_code& ec = throws;
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(gid))
             {
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(s, l, gid, ec);
             }
 
-            cache_address = resolve_gid_locked(l, gid, ec);
+            cache_address = resolve_gid_locked(s, l, gid, ec);
 
             if (ec || hpx::get<0>(cache_address) == naming::invalid_gid)
             {
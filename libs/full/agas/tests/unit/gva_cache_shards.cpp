@@ -0,0 +1,114 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The AGAS gva cache assigns its entries to shards based on blocks of
+// consecutive GIDs, ranges of GIDs are stored in all shards they overlap with.
+
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace detail = hpx::agas::detail;
+
+std::size_t const num_shards = 16;
+std::uint64_t const block_size = std::uint64_t(1)
+    << detail::gva_cache_block_bits;
+
+// the shards overlapping the range of count GIDs starting at first
+std::size_t shard_count(
+    hpx::naming::gid_type const& first, std::uint64_t count)
+{
+    return detail::get_gva_cache_shard_count(
+        first, first + (count - 1), num_shards);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_gid()
+{
+    for (std::uint64_t lsb : {std::uint64_t(0), std::uint64_t(1),
+             block_size - 1, block_size, 5 * block_size + 7})
+    {
+        hpx::naming::gid_type const gid(1, lsb);
+
+        // a single GID is stored in exactly one shard
+        HPX_TEST_EQ(shard_count(gid, 1), std::size_t(1));
+        HPX_TEST_EQ(
+            detail::get_gva_cache_shard_count(gid, gid, num_shards),
+            std::size_t(1));
+        HPX_TEST_LT(detail::get_gva_cache_first_shard(gid, num_shards),
+            num_shards);
+    }
+
+    // all GIDs of one block land in the same shard, consecutive blocks land in
+    // consecutive shards
+    hpx::naming::gid_type const base(1, 4 * block_size);
+    std::size_t const first_shard =
+        detail::get_gva_cache_first_shard(base, num_shards);
+
+    HPX_TEST_EQ(detail::get_gva_cache_first_shard(
+                    base + (block_size - 1), num_shards),
+        first_shard);
+    HPX_TEST_EQ(
+        detail::get_gva_cache_first_shard(base + block_size, num_shards),
+        (first_shard + 1) % num_shards);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ranges()
+{
+    hpx::naming::gid_type const base(1, 4 * block_size);
+
+    // ranges confined to one block
+    HPX_TEST_EQ(shard_count(base, block_size), std::size_t(1));
+    HPX_TEST_EQ(shard_count(base + 1, block_size - 1), std::size_t(1));
+
+    // ranges ending right after a block boundary
+    HPX_TEST_EQ(shard_count(base, block_size + 1), std::size_t(2));
+    HPX_TEST_EQ(shard_count(base + (block_size - 1), 2), std::size_t(2));
+
+    // ranges covering several blocks, including partially covered ones at
+    // either end
+    HPX_TEST_EQ(shard_count(base, 3 * block_size), std::size_t(3));
+    HPX_TEST_EQ(shard_count(base + block_size / 2, 3 * block_size),
+        std::size_t(4));
+
+    // each GID of a multi-block range lands in one of the shards starting at
+    // the first shard of the range
+    hpx::naming::gid_type const first = base + block_size / 2;
+    std::uint64_t const count = 3 * block_size;
+    std::size_t const first_shard =
+        detail::get_gva_cache_first_shard(first, num_shards);
+    std::size_t const num_range_shards = shard_count(first, count);
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        std::size_t const shard =
+            detail::get_gva_cache_first_shard(first + i, num_shards);
+        HPX_TEST_LT(
+            (shard + num_shards - first_shard) % num_shards, num_range_shards);
+    }
+
+    // ranges covering more blocks than there are shards use all shards
+    HPX_TEST_EQ(shard_count(base, 2 * num_shards * block_size), num_shards);
+
+    // ranges crossing into the next MSB use all shards
+    hpx::naming::gid_type const last_in_msb(1, ~std::uint64_t(0));
+    HPX_TEST_EQ(detail::get_gva_cache_shard_count(last_in_msb,
+                    last_in_msb + 1, num_shards),
+        num_shards);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_single_gid();
+    test_ranges();
+
+    return hpx::util::report_errors();
+}
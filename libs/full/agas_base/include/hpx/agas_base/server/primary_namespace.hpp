@@ -19,6 +19,7 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
@@ -127,22 +128,38 @@ namespace hpx { namespace agas { namespace server {
         using resolved_type =
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
-    private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
-
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+    private:
+        // The GVA, reference count, and migration tables are partitioned into
+        // independently locked shards, each covering interleaved blocks of
+        // consecutive GIDs (see get_shard_index()). All entries related to a
+        // particular GID are held by the same shard. GVA ranges spanning more
+        // than one block are entered into every shard they overlap.
+        struct table_shard_data
+        {
+            mutex_type mutex_;
+
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+
+        // avoid false sharing between neighboring shards
+        struct table_shard : util::cache_aligned_data_derived<table_shard_data>
+        {
+        };
+
+        static constexpr std::size_t num_table_shards =
+            HPX_AGAS_PRIMARY_NAMESPACE_SHARDS;
+
+        std::unique_ptr<table_shard[]> shards_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -227,27 +244,32 @@ namespace hpx { namespace agas { namespace server {
 
     private:
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            const char* func_name);
+        /// Dump the credit counts of all entries in the given range. Expects
+        /// that no shard is locked.
+        void dump_refcnt_matches(naming::gid_type const& lower,
+            naming::gid_type const& upper, const char* func_name);
 #endif
 
+        // return the shard holding the table entries for the given GID
+        static std::size_t get_shard_index(naming::gid_type const& id);
+        table_shard& get_shard(naming::gid_type const& id);
+
+        // return the number of shards overlapped by the given range of GIDs,
+        // these are consecutive (modulo the number of shards) starting at
+        // first
+        static std::size_t get_shard_range(naming::gid_type const& lower,
+            std::uint64_t count, std::size_t& first);
+
+        class shard_range_lock;
+
         // helper function
-        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& id, error_code& ec);
+        void wait_for_migration_locked(table_shard& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& id,
+            error_code& ec);
 
     public:
-        primary_namespace()
-          : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
-          , mutex_()
-          , instance_name_()
-          , next_id_(naming::invalid_gid)
-          , locality_(naming::invalid_gid)
-        {
-        }
+        primary_namespace();
+        ~primary_namespace();
 
         void finalize();
 
@@ -292,8 +314,9 @@ namespace hpx { namespace agas { namespace server {
             std::uint64_t count);
 
     private:
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& gid, error_code& ec);
+        resolved_type resolve_gid_locked(table_shard& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
+            error_code& ec);
 
         void increment(naming::gid_type const& lower,
             naming::gid_type const& upper, std::int64_t& credits,
@@ -319,11 +342,9 @@ namespace hpx { namespace agas { namespace server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
-            free_entry_list_type& free_entry_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
+        void resolve_free_entry(table_shard& s,
+            std::unique_lock<mutex_type>& l, refcnt_table_type::iterator it,
+            free_entry_list_type& free_entry_list, error_code& ec);
 
         void decrement_sweep(free_entry_list_type& free_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
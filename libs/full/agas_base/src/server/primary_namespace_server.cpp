@@ -50,6 +50,150 @@ namespace hpx { namespace agas {
 
 namespace hpx { namespace agas { namespace server {
 
+    // Acquires the locks of a range of shards (as returned by
+    // get_shard_range()) in ascending index order to avoid deadlocks between
+    // concurrent multi-shard operations.
+    class primary_namespace::shard_range_lock
+    {
+    public:
+        shard_range_lock(
+            table_shard* shards, std::size_t first, std::size_t count)
+          : shards_(shards)
+          , first_(first)
+          , count_(count)
+          , owns_lock_(false)
+        {
+            HPX_ASSERT(first_ < num_table_shards);
+            HPX_ASSERT(count_ != 0 && count_ <= num_table_shards);
+            lock();
+        }
+
+        ~shard_range_lock()
+        {
+            if (owns_lock_)
+            {
+                unlock();
+            }
+        }
+
+        shard_range_lock(shard_range_lock const&) = delete;
+        shard_range_lock& operator=(shard_range_lock const&) = delete;
+
+        void lock()
+        {
+            HPX_ASSERT(!owns_lock_);
+            for (std::size_t i = 0; i != num_table_shards; ++i)
+            {
+                if (contains(i))
+                {
+                    shards_[i].mutex_.lock();
+                }
+            }
+            owns_lock_ = true;
+        }
+
+        void unlock()
+        {
+            HPX_ASSERT(owns_lock_);
+            for (std::size_t i = num_table_shards; i != 0; --i)
+            {
+                if (contains(i - 1))
+                {
+                    shards_[i - 1].mutex_.unlock();
+                }
+            }
+            owns_lock_ = false;
+        }
+
+        template <typename F>
+        void for_each_shard(F&& f)
+        {
+            HPX_ASSERT(owns_lock_);
+            for (std::size_t i = 0; i != count_; ++i)
+            {
+                f(shards_[(first_ + i) % num_table_shards]);
+            }
+        }
+
+    private:
+        bool contains(std::size_t i) const
+        {
+            return (i + num_table_shards - first_) % num_table_shards < count_;
+        }
+
+        table_shard* shards_;
+        std::size_t first_;
+        std::size_t count_;
+        bool owns_lock_;
+    };
+
+    namespace detail {
+
+        // The tables are sharded based on blocks of consecutive GIDs. This
+        // keeps small ranges of GIDs (as created by bulk operations) in a
+        // single shard while distributing the GIDs allocated in sequence by
+        // a locality evenly over all shards.
+        constexpr std::uint64_t primary_namespace_block_bits = 6;
+    }    // namespace detail
+
+    primary_namespace::primary_namespace()
+      : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
+      , shards_(new table_shard[num_table_shards])
+      , instance_name_()
+      , next_id_(naming::invalid_gid)
+      , locality_(naming::invalid_gid)
+    {
+    }
+
+    primary_namespace::~primary_namespace() = default;
+
+    std::size_t primary_namespace::get_shard_index(naming::gid_type const& id)
+    {
+        // mix the MSB (which holds the locality id) into the block number,
+        // ignoring the internal bits as those don't identify an object
+        std::uint64_t const msb_hash =
+            (naming::detail::strip_internal_bits_from_gid(id.get_msb()) *
+                0x9e3779b97f4a7c15ull) >>
+            32;
+        return static_cast<std::size_t>(
+            (msb_hash +
+                (id.get_lsb() >> detail::primary_namespace_block_bits)) %
+            num_table_shards);
+    }
+
+    primary_namespace::table_shard& primary_namespace::get_shard(
+        naming::gid_type const& id)
+    {
+        return shards_[get_shard_index(id)];
+    }
+
+    std::size_t primary_namespace::get_shard_range(
+        naming::gid_type const& lower, std::uint64_t count, std::size_t& first)
+    {
+        first = get_shard_index(lower);
+        if (count <= 1)
+        {
+            return 1;
+        }
+
+        constexpr std::uint64_t block_size = std::uint64_t(1)
+            << detail::primary_namespace_block_bits;
+
+        // any range covering this many GIDs overlaps with all shards
+        if (count >= num_table_shards * block_size)
+        {
+            return num_table_shards;
+        }
+
+        std::uint64_t const offset = lower.get_lsb() & (block_size - 1);
+        std::uint64_t const num_blocks =
+            ((offset + count - 1) >> detail::primary_namespace_block_bits) + 1;
+
+        return num_blocks < num_table_shards ?
+            static_cast<std::size_t>(num_blocks) :
+            num_table_shards;
+    }
+
     void primary_namespace::register_server_instance(
         char const* servicename, std::uint32_t locality_id, error_code& ec)
     {
@@ -125,10 +269,11 @@ namespace hpx { namespace agas { namespace server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table_shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
-        wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+        wait_for_migration_locked(s, l, id, hpx::throws);
+        resolved_type r = resolve_gid_locked(s, l, id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -140,11 +285,11 @@ namespace hpx { namespace agas { namespace server {
             return std::make_pair(naming::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -171,12 +316,13 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table_shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -186,7 +332,7 @@ namespace hpx { namespace agas { namespace server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -194,7 +340,7 @@ namespace hpx { namespace agas { namespace server {
     }
 
     // wait if given object is currently being migrated
-    void primary_namespace::wait_for_migration_locked(
+    void primary_namespace::wait_for_migration_locked(table_shard& s,
         std::unique_lock<mutex_type>& l, naming::gid_type const& id,
         error_code& ec)
     {
@@ -202,8 +348,8 @@ namespace hpx { namespace agas { namespace server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             if (get<0>(it->second))
             {
@@ -212,13 +358,13 @@ namespace hpx { namespace agas { namespace server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
         }
@@ -235,10 +381,16 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // the binding is entered into all shards overlapped by the range
+        std::size_t first_shard = 0;
+        std::size_t const count_shards =
+            get_shard_range(id, g.count, first_shard);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        shard_range_lock l(shards_.get(), first_shard, count_shards);
+
+        gva_table_type& gvas = shards_[first_shard].gvas_;
+        gva_table_type::iterator it = gvas.lower_bound(id),
+                                 begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -260,7 +412,6 @@ namespace hpx { namespace agas { namespace server {
                 }
 
                 gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
 
                 // Check for count mismatch (we can't change block sizes of
                 // existing bindings).
@@ -297,12 +448,19 @@ namespace hpx { namespace agas { namespace server {
                         id, g, locality);
                 }
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+                // Store the new endpoint and offset in all copies of the
+                // binding
+                l.for_each_shard([&](table_shard& s) {
+                    gva_table_type::iterator entry = s.gvas_.find(id);
+                    HPX_ASSERT(entry != s.gvas_.end());
+
+                    gva& entry_addr = entry->second.first;
+                    entry_addr.prefix = g.prefix;
+                    entry_addr.type = g.type;
+                    entry_addr.lva(g.lva());
+                    entry_addr.offset = g.offset;
+                    entry->second.second = locality;
+                });
 
                 l.unlock();
 
@@ -333,7 +491,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -353,6 +511,8 @@ namespace hpx { namespace agas { namespace server {
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -382,9 +542,17 @@ namespace hpx { namespace agas { namespace server {
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        // Insert a GID -> GVA entry into the GVA table of each shard.
+        bool inserted = true;
+        l.for_each_shard([&](table_shard& s) {
+            if (HPX_UNLIKELY(!util::insert_checked(s.gvas_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                inserted = false;
+            }
+        });
+
+        if (HPX_UNLIKELY(!inserted))
         {
             l.unlock();
 
@@ -415,16 +583,17 @@ namespace hpx { namespace agas { namespace server {
         resolved_type r;
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            table_shard& s = get_shard(id);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
             {
-                wait_for_migration_locked(l, id, hpx::throws);
+                wait_for_migration_locked(s, l, id, hpx::throws);
             }
 
             // now, resolve the id
-            r = resolve_gid_locked(l, id, hpx::throws);
+            r = resolve_gid_locked(s, l, id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -461,9 +630,15 @@ namespace hpx { namespace agas { namespace server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // the binding has been entered into all shards overlapped by the range
+        std::size_t first_shard = 0;
+        std::size_t const count_shards =
+            get_shard_range(id, count, first_shard);
+
+        shard_range_lock l(shards_.get(), first_shard, count_shards);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        gva_table_type& gvas = shards_[first_shard].gvas_;
+        gva_table_type::iterator it = gvas.find(id), end = gvas.end();
 
         if (it != end)
         {
@@ -477,7 +652,7 @@ namespace hpx { namespace agas { namespace server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            l.for_each_shard([&](table_shard& s) { s.gvas_.erase(id); });
 
             l.unlock();
             LAGAS_(info).format(
@@ -654,30 +829,29 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-        const char* func_name)
+    void primary_namespace::dump_refcnt_matches(naming::gid_type const& lower,
+        naming::gid_type const& upper, const char* func_name)
     {    // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            // The [server] tag is in there to make it easier to filter
-            // through the logs.
-            hpx::util::format_to(ss, "\n  [server] lower({1}), credits({2})",
-                lower_it->first, lower_it->second);
+            table_shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
+
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it != s.refcnts_.end())
+            {
+                // The [server] tag is in there to make it easier to filter
+                // through the logs.
+                hpx::util::format_to(ss,
+                    "\n  [server] lower({1}), credits({2})", it->first,
+                    it->second);
+            }
         }
 
         LAGAS_(debug) << ss.str();
@@ -688,28 +862,11 @@ namespace hpx { namespace agas { namespace server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
         {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+            // Dump the mappings that we're about to touch.
+            dump_refcnt_matches(lower, upper, "primary_namespace::increment");
         }
 #endif
 
@@ -725,14 +882,20 @@ namespace hpx { namespace agas { namespace server {
 
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            // reference counts of different GIDs are independent of each
+            // other, only the shard holding the current one has to be locked
+            table_shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
+
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -762,91 +925,84 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
-        free_entry_list_type& free_entry_list,
-        naming::gid_type const& /* lower */,
-        naming::gid_type const& /* upper */, error_code& ec)
+    void primary_namespace::resolve_free_entry(table_shard& s,
+        std::unique_lock<mutex_type>& l, refcnt_table_type::iterator it,
+        free_entry_list_type& free_entry_list, error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
 
         using hpx::get;
 
-        typedef refcnt_table_type::iterator iterator;
-
-        for (iterator const& it : free_list)
-        {
-            typedef refcnt_table_type::key_type key_type;
-
-            // The mapping's key space.
-            key_type gid = it->first;
+        typedef refcnt_table_type::key_type key_type;
 
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
+        // The mapping's key space.
+        key_type gid = it->first;
 
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
-            if (ec)
-                return;
+        if (naming::detail::is_migratable(gid))
+        {
+            // wait for any migration to be completed
+            wait_for_migration_locked(s, l, gid, ec);
+        }
 
-            naming::gid_type& raw = get<0>(r);
-            if (raw == naming::invalid_gid)
-            {
-                l.unlock();
+        // Resolve the query GID.
+        resolved_type r = resolve_gid_locked(s, l, gid, ec);
+        if (ec)
+            return;
 
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "primary_namespace::resolve_free_list, failed to resolve "
-                    "gid, gid({1})",
-                    gid);
-                return;    // couldn't resolve this one
-            }
+        naming::gid_type& raw = get<0>(r);
+        if (raw == naming::invalid_gid)
+        {
+            l.unlock();
 
-            // Make sure the GVA is valid.
-            gva& g = get<1>(r);
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "primary_namespace::resolve_free_entry, failed to resolve "
+                "gid, gid({1})",
+                gid);
+            return;    // couldn't resolve this one
+        }
 
-            // REVIEW: Should we do more to make sure the GVA is valid?
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
+        // Make sure the GVA is valid.
+        gva& g = get<1>(r);
 
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with an invalid type while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
-            else if (HPX_UNLIKELY(0 == g.count))
-            {
-                l.unlock();
+        // REVIEW: Should we do more to make sure the GVA is valid?
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            l.unlock();
 
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with a count of zero while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with an invalid type while performing a "
+                "decrement, gid({1}), gva({2})",
+                gid, g);
+            return;
+        }
+        else if (HPX_UNLIKELY(0 == g.count))
+        {
+            l.unlock();
 
-            LAGAS_(info).format(
-                "primary_namespace::resolve_free_list, resolved match, "
-                "gid({1}), gva({2})",
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with a count of zero while performing a "
+                "decrement, gid({1}), gva({2})",
                 gid, g);
+            return;
+        }
 
-            // Fully resolve the range.
-            gva const resolved = g.resolve(gid, raw);
+        LAGAS_(info).format(
+            "primary_namespace::resolve_free_entry, resolved match, "
+            "gid({1}), gva({2})",
+            gid, g);
 
-            // Add the information needed to destroy these components to the
-            // free list.
-            free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
+        // Fully resolve the range.
+        gva const resolved = g.resolve(gid, raw);
 
-            // remove this entry from the refcnt table
-            refcnts_.erase(it);
-        }
+        // Add the information needed to destroy this component to the free
+        // list.
+        free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
+
+        // remove this entry from the refcnt table
+        s.refcnts_.erase(it);
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -861,107 +1017,92 @@ namespace hpx { namespace agas { namespace server {
 
         free_entry_list.clear();
 
-        {
-            std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
-
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
-
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
+        if (LAGAS_ENABLED(debug))
+        {
+            // Dump the mappings that we're about to modify.
+            dump_refcnt_matches(
+                lower, upper, "primary_namespace::decrement_sweep");
+        }
 #endif
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
+        ///////////////////////////////////////////////////////////////////////
+        // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+        // The third parameter we pass here is the default data to use in case
+        // the key is not mapped. We don't insert GIDs into the refcnt table
+        // when we allocate/bind them, so if a GID is not in the refcnt table,
+        // we know that it's global reference count is the initial global
+        // reference count.
 
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        {
+            // the reference count, the binding, and the migration state of
+            // the current GID are all held by the same shard
+            table_shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
-            std::list<refcnt_table_type::iterator> free_list;
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                 {
-                    if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "negative entry in reference count table, "
-                            "raw({1}), refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits);
-                        return;
-                    }
-
-                    std::int64_t count =
-                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
-
-                    std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
-                            refcnt_table_type::value_type(raw, count));
-                    if (!p.second)
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count);
-                        return;
-                    }
+                    l.unlock();
 
-                    it = p.first;
-                }
-                else
-                {
-                    it->second -= credits;
+                    HPX_THROWS_IF(ec, invalid_data,
+                        "primary_namespace::decrement_sweep",
+                        "negative entry in reference count table, "
+                        "raw({1}), refcount({2})",
+                        raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits);
+                    return;
                 }
 
-                // Sanity check.
-                if (it->second < 0)
+                std::int64_t count =
+                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+
+                std::pair<refcnt_table_type::iterator, bool> p =
+                    s.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
+                if (!p.second)
                 {
                     l.unlock();
 
                     HPX_THROWS_IF(ec, invalid_data,
                         "primary_namespace::decrement_sweep",
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second);
+                        "couldn't create entry in reference count table, "
+                        "raw({1}), ref-count({2})",
+                        raw, count);
                     return;
                 }
 
-                // this objects needs to be deleted
-                if (it->second == 0)
-                    free_list.push_back(it);
+                it = p.first;
+            }
+            else
+            {
+                it->second -= credits;
             }
 
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+            // Sanity check.
+            if (it->second < 0)
+            {
+                l.unlock();
+
+                HPX_THROWS_IF(ec, invalid_data,
+                    "primary_namespace::decrement_sweep",
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, it->second);
+                return;
+            }
 
-        }    // Unlock the mutex.
+            // this objects needs to be deleted, resolve it
+            if (it->second == 0)
+            {
+                resolve_free_entry(s, l, it, free_entry_list, ec);
+                if (ec)
+                    return;
+            }
+        }
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1023,8 +1164,8 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
+        table_shard& s, std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, error_code& ec)
     {    // {{{ resolve_gid_locked implementation
         HPX_ASSERT_OWNS_LOCK(l);
 
@@ -1043,8 +1184,10 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        // the shard holds all ranges overlapping with the block of this id
+        gva_table_type const& gvas = s.gvas_;
+        gva_table_type::const_iterator it = gvas.lower_bound(id),
+                                       begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -1088,7 +1231,7 @@ namespace hpx { namespace agas { namespace server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The GVA, reference count, and migration tables of the primary namespace are
+// partitioned into shards covering interleaved blocks of 64 consecutive GIDs.
+// This test exercises ranges of GIDs spanning several of those blocks.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::server::primary_namespace;
+using hpx::naming::gid_type;
+
+std::uint64_t const block_size = 64;
+std::uint64_t const range_size = 3 * block_size + 5;
+
+std::uint64_t const lva_base = 0x10000;
+std::uint64_t const lva_offset = 8;
+
+// allocate a range of GIDs, returns the first and one past the last GID
+std::pair<gid_type, gid_type> allocate_range(primary_namespace& pns)
+{
+    std::pair<gid_type, gid_type> const range = pns.allocate(range_size);
+
+    gid_type const lower = hpx::naming::detail::get_stripped_gid(range.first);
+    gid_type const upper = hpx::naming::detail::get_stripped_gid(range.second);
+    HPX_TEST_EQ(upper, lower + (range_size - 1));
+
+    return std::make_pair(lower, upper + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bind_resolve(primary_namespace& pns, gid_type const& locality)
+{
+    std::pair<gid_type, gid_type> const range = allocate_range(pns);
+    gid_type const lower = range.first;
+
+    gva const g(locality, hpx::components::component_plain_function,
+        range_size, lva_base, lva_offset);
+    HPX_TEST(pns.bind_gid(g, lower, locality));
+
+    // all GIDs of the range resolve to the binding, independently of the
+    // shard they belong to
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        primary_namespace::resolved_type const r = pns.resolve_gid(lower + i);
+
+        HPX_TEST_EQ(hpx::get<0>(r), lower);
+        HPX_TEST_EQ(hpx::get<1>(r).count, range_size);
+        HPX_TEST_EQ(
+            hpx::get<1>(r).lva(lower + i, lower), lva_base + i * lva_offset);
+        HPX_TEST_EQ(hpx::get<2>(r), locality);
+    }
+
+    // the GID right after the range is not bound
+    HPX_TEST_EQ(hpx::get<0>(pns.resolve_gid(range.second)),
+        hpx::naming::invalid_gid);
+
+    // unbinding removes the binding from all shards
+    hpx::naming::address const addr = pns.unbind_gid(range_size, lower);
+    HPX_TEST_EQ(addr.address_, lva_base);
+
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        HPX_TEST_EQ(hpx::get<0>(pns.resolve_gid(lower + i)),
+            hpx::naming::invalid_gid);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void decrement_credit(
+    primary_namespace& pns, gid_type const& id, std::int64_t credits)
+{
+    std::vector<hpx::tuple<std::int64_t, gid_type, gid_type>> requests;
+    requests.emplace_back(-credits, id, id);
+    pns.decrement_credit(requests);
+}
+
+void test_decref(primary_namespace& pns, gid_type const& locality)
+{
+    std::pair<gid_type, gid_type> const range = allocate_range(pns);
+    gid_type const lower = range.first;
+
+    gva const g(locality, hpx::components::component_plain_function,
+        range_size, lva_base, lva_offset);
+    HPX_TEST(pns.bind_gid(g, lower, locality));
+
+    std::int64_t const credits = 10;
+    pns.increment_credit(credits, lower, range.second);
+
+    // Removing more than the initial credit from a GID requires finding its
+    // reference count in the shard it belongs to, leave one credit to keep
+    // the (non-existent) objects alive.
+    std::int64_t const decrement =
+        std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits - 1;
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        decrement_credit(pns, lower + i, decrement);
+    }
+
+    // the reference counts of the GIDs have not been freed, so the binding
+    // is still intact
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        HPX_TEST_EQ(hpx::get<0>(pns.resolve_gid(lower + i)), lower);
+    }
+
+    // the reference count of the GID right after the range was not
+    // incremented
+    HPX_TEST_THROW(decrement_credit(pns, range.second, decrement),
+        hpx::exception);
+
+    // a reference count must not become negative
+    HPX_TEST_THROW(decrement_credit(pns, lower, 2), hpx::exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    gid_type const locality = hpx::naming::get_gid_from_locality_id(0);
+
+    primary_namespace pns;
+    pns.set_local_locality(locality);
+
+    test_bind_resolve(pns, locality);
+    test_decref(pns, locality);
+
+    return hpx::util::report_errors();
+}
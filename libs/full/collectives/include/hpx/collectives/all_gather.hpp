@@ -66,6 +66,28 @@ namespace hpx { namespace collectives {
     hpx::future<std::vector<std::decay_t<T>>>
     all_gather(communicator comm, T&& result,
         this_site_arg this_site = this_site_arg());
+
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites using
+    /// point-to-point messages between the sites only, no site acts as a
+    /// central root.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  alg         The algorithm to use (default: selected based on
+    ///                     the payload size and the number of sites).
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the all_gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>>
+    all_gather(channel_communicator comm, T&& local_result,
+        collective_algorithm alg = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -78,7 +100,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -200,6 +224,23 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             std::forward<T>(local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_gather based on point-to-point communication
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        channel_communicator comm, T&& local_result,
+        collective_algorithm alg = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        return hpx::async(
+            [comm = std::move(comm),
+                local_result = std::forward<T>(local_result),
+                alg]() mutable -> std::vector<arg_type> {
+                return detail::all_gather(comm, std::move(local_result), alg);
+            });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,37 @@ namespace hpx { namespace collectives {
     hpx::future<std::decay_t<T>>
     all_reduce(communicator comm,
         T&& result, F&& op, this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function reduces a set of values from all call sites using
+    /// point-to-point messages between the sites only, no site acts as a
+    /// central root.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. If \a local_result
+    ///                     is a std::vector and \a op accepts two of its
+    ///                     elements, the reduction is applied element-wise.
+    ///                     The values are combined in the order of the sites,
+    ///                     except for the ring algorithm.
+    /// \param  alg         The algorithm to use (default: selected based on
+    ///                     the payload size and the number of sites). The
+    ///                     ring algorithm requires an element-wise reduction
+    ///                     using a commutative operation, see
+    ///                     \a hpx::traits::is_commutative_operation.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>>
+    all_reduce(channel_communicator comm, T&& local_result, F&& op,
+        collective_algorithm alg = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -81,7 +112,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -217,6 +250,24 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             std::forward<T>(local_result), std::forward<F>(op), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce based on point-to-point communication
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op,
+        collective_algorithm alg = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        return hpx::async(
+            [comm = std::move(comm),
+                local_result = std::forward<T>(local_result),
+                op = std::forward<F>(op), alg]() mutable -> arg_type {
+                return detail::all_reduce(
+                    comm, std::move(local_result), op, alg);
+            });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
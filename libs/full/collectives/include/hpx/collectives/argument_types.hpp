@@ -124,4 +124,15 @@ namespace hpx { namespace collectives {
 
         std::size_t root_site_;
     };
+
+    /// The algorithm used by the point-to-point (channel_communicator based)
+    /// collective operations. \a automatic selects an algorithm based on the
+    /// payload size and the number of participating sites.
+    enum class collective_algorithm
+    {
+        automatic = 0,
+        recursive_doubling = 1,
+        binomial_tree = 2,
+        ring = 3
+    };
 }}    // namespace hpx::collectives
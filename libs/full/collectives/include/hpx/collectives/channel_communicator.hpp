@@ -142,6 +142,12 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        // Return the number of participating sites and the index of this site
+        std::pair<std::size_t, std::size_t> get_info() const noexcept
+        {
+            return comm_->get_info();
+        }
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
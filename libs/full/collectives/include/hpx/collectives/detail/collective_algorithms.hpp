@@ -0,0 +1,570 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/traits/is_commutative_operation.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The algorithms below implement all_reduce and all_gather on top of the
+// point-to-point operations exposed by the channel_communicator. Other than
+// the communicator_server based collectives (which funnel all values through
+// the root site), every site exchanges data with O(log P) (recursive doubling,
+// binomial tree) or two (ring) peers only.
+//
+// Each step waits for both, its send and its receive to complete. This
+// guarantees that at most one message per ordered pair of sites is in flight,
+// which is what the one-element channels of the channel_communicator support.
+//
+// The recursive doubling and binomial tree reductions combine the values in
+// the order of the sites, the reduction operation has to be associative only.
+// The ring reduction combines them out of order and requires a commutative
+// operation (see hpx::traits::is_commutative_operation).
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // payloads (in bytes) used to select an algorithm automatically
+    constexpr std::size_t recursive_doubling_payload_limit = 2048;
+    constexpr std::size_t ring_payload_threshold = 65536;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A reduction on a std::vector<U> whose operation accepts two U's is
+    // applied element-wise.
+    template <typename T, typename F>
+    struct is_elementwise_reduction : std::false_type
+    {
+    };
+
+    template <typename U, typename Alloc, typename F>
+    struct is_elementwise_reduction<std::vector<U, Alloc>, F>
+      : std::integral_constant<bool,
+            hpx::is_invocable_v<F&, U const&, U const&> &&
+                !hpx::is_invocable_v<F&, std::vector<U, Alloc> const&,
+                    std::vector<U, Alloc> const&>>
+    {
+    };
+
+    // Only element-wise reductions using a commutative operation can use the
+    // ring algorithm as it reduces the vector in chunks, each of which starts
+    // out at a different site.
+    template <typename T, typename F>
+    struct is_ring_reduction : std::false_type
+    {
+    };
+
+    template <typename U, typename Alloc, typename F>
+    struct is_ring_reduction<std::vector<U, Alloc>, F>
+      : std::integral_constant<bool,
+            is_elementwise_reduction<std::vector<U, Alloc>, F>::value &&
+                hpx::traits::is_commutative_operation_v<F, U>>
+    {
+    };
+
+    template <typename T>
+    std::size_t payload_size(T const&) noexcept
+    {
+        return sizeof(T);
+    }
+
+    template <typename U, typename Alloc>
+    std::size_t payload_size(std::vector<U, Alloc> const& v) noexcept
+    {
+        return v.size() * sizeof(U);
+    }
+
+    // combine two partial results, lhs always holds the values of the sites
+    // with the lower indices
+    template <typename T, typename F>
+    T combine(T&& lhs, T const& rhs, F& op)
+    {
+        if constexpr (is_elementwise_reduction<T, F>::value)
+        {
+            HPX_ASSERT(lhs.size() == rhs.size());
+            auto it = rhs.begin();
+            for (auto& val : lhs)
+            {
+                val = HPX_INVOKE(op, std::move(val), *it++);
+            }
+            return std::move(lhs);
+        }
+        else
+        {
+            return HPX_INVOKE(op, std::move(lhs), rhs);
+        }
+    }
+
+    inline std::size_t floor_pow2(std::size_t n) noexcept
+    {
+        std::size_t p2 = 1;
+        while (p2 <= n / 2)
+        {
+            p2 <<= 1;
+        }
+        return p2;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void send(hpx::collectives::channel_communicator const& comm,
+        std::size_t site, T&& value)
+    {
+        hpx::collectives::set(comm, that_site_arg(site), std::forward<T>(value))
+            .get();
+    }
+
+    template <typename T>
+    T receive(hpx::collectives::channel_communicator const& comm,
+        std::size_t site)
+    {
+        return hpx::collectives::get<T>(comm, that_site_arg(site)).get();
+    }
+
+    // send a value to one site while receiving a value from another
+    template <typename T>
+    std::decay_t<T> exchange(
+        hpx::collectives::channel_communicator const& comm,
+        std::size_t send_to, T&& value, std::size_t receive_from)
+    {
+        hpx::future<void> sent = hpx::collectives::set(
+            comm, that_site_arg(send_to), std::forward<T>(value));
+        hpx::future<std::decay_t<T>> received =
+            hpx::collectives::get<std::decay_t<T>>(
+                comm, that_site_arg(receive_from));
+
+        hpx::wait_all(sent, received);
+
+        sent.get();    // propagate exceptions
+        return received.get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    collective_algorithm select_all_reduce_algorithm(
+        T const& value, F const&, std::size_t num_sites) noexcept
+    {
+        std::size_t const bytes = payload_size(value);
+        if constexpr (is_ring_reduction<T, F>::value)
+        {
+            if (num_sites > 2 && bytes >= ring_payload_threshold &&
+                value.size() >= num_sites)
+            {
+                return collective_algorithm::ring;
+            }
+        }
+
+        // recursive doubling needs log2(P) rounds but sends the full payload
+        // in each of them, the binomial tree needs twice the rounds but sends
+        // only P-1 messages per phase
+        if (num_sites <= 2 || bytes <= recursive_doubling_payload_limit)
+        {
+            return collective_algorithm::recursive_doubling;
+        }
+        return collective_algorithm::binomial_tree;
+    }
+
+    template <typename T>
+    collective_algorithm select_all_gather_algorithm(
+        T const& value, std::size_t num_sites) noexcept
+    {
+        if (num_sites > 2 &&
+            num_sites * payload_size(value) >= ring_payload_threshold)
+        {
+            return collective_algorithm::ring;
+        }
+        return collective_algorithm::recursive_doubling;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling: sites exchange their partial results with partners
+    // at distance 1, 2, 4, ... Excess sites (if the number of sites is not a
+    // power of two) fold their value into their right neighbor first and
+    // receive the final result from it at the end.
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(
+        hpx::collectives::channel_communicator const& comm, T value, F& op)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        std::size_t const p2 = floor_pow2(num_sites);
+        std::size_t const rem = num_sites - p2;
+
+        std::size_t vsite = this_site - rem;
+        if (this_site < 2 * rem)
+        {
+            if (this_site % 2 == 0)
+            {
+                send(comm, this_site + 1, std::move(value));
+                return receive<T>(comm, this_site + 1);
+            }
+
+            value = combine(receive<T>(comm, this_site - 1), value, op);
+            vsite = this_site / 2;
+        }
+
+        for (std::size_t mask = 1; mask < p2; mask <<= 1)
+        {
+            std::size_t const vpartner = vsite ^ mask;
+            std::size_t const partner =
+                vpartner < rem ? 2 * vpartner + 1 : vpartner + rem;
+
+            T other = exchange(comm, partner, value, partner);
+            if (vpartner < vsite)
+            {
+                value = combine(std::move(other), value, op);
+            }
+            else
+            {
+                value = combine(std::move(value), other, op);
+            }
+        }
+
+        if (this_site < 2 * rem)
+        {
+            send(comm, this_site - 1, value);
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast the value held by site zero down a binomial tree
+    template <typename T>
+    T binomial_tree_broadcast(
+        hpx::collectives::channel_communicator const& comm, T value)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        std::size_t mask = 1;
+        if (this_site != 0)
+        {
+            mask = this_site & (~this_site + 1);
+            value = receive<T>(comm, this_site - mask);
+        }
+        else
+        {
+            while (mask < num_sites)
+            {
+                mask <<= 1;
+            }
+        }
+
+        std::vector<hpx::future<void>> sends;
+        for (mask >>= 1; mask != 0; mask >>= 1)
+        {
+            if (this_site + mask < num_sites)
+            {
+                sends.push_back(hpx::collectives::set(
+                    comm, that_site_arg(this_site + mask), value));
+            }
+        }
+        hpx::wait_all(sends);
+
+        for (auto& f : sends)
+        {
+            f.get();    // propagate exceptions
+        }
+        return value;
+    }
+
+    // Binomial tree: partial results are reduced towards site zero in
+    // log2(P) rounds and the result is broadcast back along the same tree.
+    template <typename T, typename F>
+    T all_reduce_binomial_tree(
+        hpx::collectives::channel_communicator const& comm, T value, F& op)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1)
+        {
+            if (this_site & mask)
+            {
+                send(comm, this_site - mask, std::move(value));
+                break;
+            }
+            if (this_site + mask < num_sites)
+            {
+                value = combine(
+                    std::move(value), receive<T>(comm, this_site + mask), op);
+            }
+        }
+
+        return binomial_tree_broadcast(comm, std::move(value));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Ring: the vector is split into P chunks, a reduce-scatter leaves every
+    // site with one fully reduced chunk, an all-gather then circulates those.
+    // Every site sends and receives 2 * (P-1) / P times the payload in total,
+    // independently of the number of sites.
+    //
+    // Chunk c is reduced by the sites c, c+1, ..., P-1, 0, ..., c-1 (in this
+    // order), which is why the operation has to be commutative.
+    template <typename T, typename F>
+    T all_reduce_ring(
+        hpx::collectives::channel_communicator const& comm, T value, F& op)
+    {
+        static_assert(is_ring_reduction<T, F>::value,
+            "the ring algorithm requires an element-wise reduction of a "
+            "std::vector using a commutative operation");
+
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        std::size_t const size = value.size();
+        auto chunk_begin = [&](std::size_t chunk) {
+            return std::next(value.begin(),
+                static_cast<std::ptrdiff_t>(chunk * size / num_sites));
+        };
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        // reduce-scatter
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_chunk =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_chunk =
+                (this_site + 2 * num_sites - step - 1) % num_sites;
+
+            T other = exchange(comm, right,
+                T(chunk_begin(send_chunk), chunk_begin(send_chunk + 1)), left);
+
+            auto it = chunk_begin(recv_chunk);
+            HPX_ASSERT(other.size() ==
+                static_cast<std::size_t>(
+                    std::distance(it, chunk_begin(recv_chunk + 1))));
+
+            for (auto& val : other)
+            {
+                *it = HPX_INVOKE(op, std::move(val), *it);
+                ++it;
+            }
+        }
+
+        // all-gather
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_chunk =
+                (this_site + num_sites + 1 - step) % num_sites;
+            std::size_t const recv_chunk =
+                (this_site + num_sites - step) % num_sites;
+
+            T other = exchange(comm, right,
+                T(chunk_begin(send_chunk), chunk_begin(send_chunk + 1)), left);
+
+            std::move(other.begin(), other.end(), chunk_begin(recv_chunk));
+        }
+
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    T all_reduce(hpx::collectives::channel_communicator const& comm, T value,
+        F& op, collective_algorithm alg)
+    {
+        std::size_t const num_sites = comm.get_info().first;
+        if (num_sites == 1)
+        {
+            return value;
+        }
+
+        if (alg == collective_algorithm::automatic)
+        {
+            alg = select_all_reduce_algorithm(value, op, num_sites);
+        }
+
+        switch (alg)
+        {
+        case collective_algorithm::recursive_doubling:
+            return all_reduce_recursive_doubling(comm, std::move(value), op);
+
+        case collective_algorithm::binomial_tree:
+            return all_reduce_binomial_tree(comm, std::move(value), op);
+
+        case collective_algorithm::ring:
+            if constexpr (is_ring_reduction<T, F>::value)
+            {
+                return all_reduce_ring(comm, std::move(value), op);
+            }
+            else
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::collectives::all_reduce",
+                    "the ring algorithm requires an element-wise reduction "
+                    "of a std::vector using a commutative operation (see "
+                    "hpx::traits::is_commutative_operation)");
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter, "hpx::collectives::all_reduce",
+            "unknown collective algorithm");
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling (using Bruck's scheme to support any number of
+    // sites): in round k every site forwards the (up to) 2^k values it
+    // has collected so far to the site at distance 2^k below it.
+    template <typename T>
+    std::vector<T> all_gather_recursive_doubling(
+        hpx::collectives::channel_communicator const& comm, T value)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        // blocks[i] holds the value of site (this_site + i) % num_sites
+        std::vector<T> blocks;
+        blocks.reserve(num_sites);
+        blocks.push_back(std::move(value));
+
+        for (std::size_t dist = 1; dist < num_sites; dist <<= 1)
+        {
+            std::size_t const count = (std::min)(dist, num_sites - dist);
+
+            std::vector<T> other = exchange(comm,
+                (this_site + num_sites - dist) % num_sites,
+                std::vector<T>(blocks.begin(),
+                    std::next(
+                        blocks.begin(), static_cast<std::ptrdiff_t>(count))),
+                (this_site + dist) % num_sites);
+
+            HPX_ASSERT(other.size() == count);
+            std::move(other.begin(), other.end(), std::back_inserter(blocks));
+        }
+
+        std::vector<T> result(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            result[(this_site + i) % num_sites] = std::move(blocks[i]);
+        }
+        return result;
+    }
+
+    // Binomial tree: every site collects the values of its (contiguous)
+    // subtree, site zero broadcasts the full set back along the same tree.
+    template <typename T>
+    std::vector<T> all_gather_binomial_tree(
+        hpx::collectives::channel_communicator const& comm, T value)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        std::vector<T> result;
+        result.push_back(std::move(value));
+
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1)
+        {
+            if (this_site & mask)
+            {
+                send(comm, this_site - mask, std::move(result));
+                result = std::vector<T>();
+                break;
+            }
+            if (this_site + mask < num_sites)
+            {
+                std::vector<T> other =
+                    receive<std::vector<T>>(comm, this_site + mask);
+                std::move(
+                    other.begin(), other.end(), std::back_inserter(result));
+            }
+        }
+
+        return binomial_tree_broadcast(comm, std::move(result));
+    }
+
+    // Ring: every value travels P-1 hops around the ring.
+    template <typename T>
+    std::vector<T> all_gather_ring(
+        hpx::collectives::channel_communicator const& comm, T value)
+    {
+        std::size_t num_sites, this_site;
+        std::tie(num_sites, this_site) = comm.get_info();
+
+        std::vector<T> result(num_sites);
+        result[this_site] = std::move(value);
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_block =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_block =
+                (this_site + 2 * num_sites - step - 1) % num_sites;
+
+            result[recv_block] =
+                exchange(comm, right, result[send_block], left);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    std::vector<T> all_gather(
+        hpx::collectives::channel_communicator const& comm, T value,
+        collective_algorithm alg)
+    {
+        std::size_t const num_sites = comm.get_info().first;
+        if (num_sites == 1)
+        {
+            return std::vector<T>{std::move(value)};
+        }
+
+        if (alg == collective_algorithm::automatic)
+        {
+            alg = select_all_gather_algorithm(value, num_sites);
+        }
+
+        switch (alg)
+        {
+        case collective_algorithm::recursive_doubling:
+            return all_gather_recursive_doubling(comm, std::move(value));
+
+        case collective_algorithm::binomial_tree:
+            return all_gather_binomial_tree(comm, std::move(value));
+
+        case collective_algorithm::ring:
+            return all_gather_ring(comm, std::move(value));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter, "hpx::collectives::all_gather",
+            "unknown collective algorithm");
+        return std::vector<T>();
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
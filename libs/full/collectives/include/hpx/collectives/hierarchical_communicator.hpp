@@ -0,0 +1,561 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hierarchical_communicator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Create a new two-level communicator object
+    ///
+    /// This functions creates a communicator that groups the participating
+    /// sites by the node they run on. Collective operations invoked through
+    /// it first combine the values of all sites on a node at the node leader,
+    /// then run the collective operation among the node leaders only, and
+    /// finally distribute the result to the sites on each node. This avoids
+    /// sending redundant copies of the same data between the nodes.
+    ///
+    /// \note  The values are exchanged within a node through a regular
+    ///        communicator, i.e. using whatever transport the parcelport
+    ///        uses between localities on the same node.
+    ///
+    /// \param  basename    The base name identifying the collective operation
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on the
+    ///                     given base name. This is optional and needs to be
+    ///                     supplied only if the collective operation on the
+    ///                     given base name has to be performed more than once.
+    /// \params root_site   The site that is the root of the rooted collective
+    ///                     operations (reduce, broadcast). This value is
+    ///                     optional and defaults to '0' (zero).
+    /// \param  node_name   The name identifying the node this site runs on.
+    ///                     This value is optional and defaults to the host
+    ///                     name.
+    ///
+    /// \returns    This function returns a future holding the new
+    ///             communicator object. It becomes ready once the sites have
+    ///             been grouped by node.
+    ///
+    hpx::future<hierarchical_communicator> create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        char const* node_name = nullptr);
+
+    hierarchical_communicator create_hierarchical_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        char const* node_name = nullptr);
+
+    /// Reduce the values of all sites and distribute the result to all sites
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator comm, T&& local_result, F&& op);
+
+    /// Reduce the values of all sites at the root site (to be invoked on the
+    /// root site only)
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> reduce_here(
+        hierarchical_communicator comm, T&& local_result, F&& op);
+
+    /// Contribute a value to a reduction at the root site (to be invoked on
+    /// all sites but the root). As node leaders reduce the values of their
+    /// node locally, the reduction operation is required here as well.
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(
+        hierarchical_communicator comm, T&& local_result, F&& op);
+
+    /// Gather the values of all sites at the root site (to be invoked on the
+    /// root site only). The values are returned in the order of the sites.
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        hierarchical_communicator comm, T&& local_result);
+
+    /// Contribute a value to a gather operation at the root site (to be
+    /// invoked on all sites but the root)
+    template <typename T>
+    hpx::future<void> gather_there(
+        hierarchical_communicator comm, T&& local_result);
+
+    /// Gather the values of all sites and distribute them to all sites. The
+    /// values are returned in the order of the sites.
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        hierarchical_communicator comm, T&& local_result);
+
+    /// Broadcast a value from the root site (to be invoked on the root site
+    /// only)
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        hierarchical_communicator comm, T&& local_result);
+
+    /// Receive the value broadcast from the root site (to be invoked on all
+    /// sites but the root)
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator comm);
+}}
+// clang-format on
+
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/gather.hpp>
+#include <hpx/collectives/reduce.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    class hierarchical_communicator
+    {
+    public:
+        // the sites hosted by each of the nodes, the first site of each node
+        // is its leader
+        using topology_type = std::vector<std::vector<std::size_t>>;
+
+        hierarchical_communicator() = default;
+
+        hierarchical_communicator(communicator node, communicator leaders,
+            std::shared_ptr<topology_type const> topology,
+            std::size_t node_index, std::size_t node_site)
+          : node_(std::move(node))
+          , leaders_(std::move(leaders))
+          , topology_(std::move(topology))
+          , node_index_(node_index)
+          , node_site_(node_site)
+        {
+            HPX_ASSERT(topology_ && node_index_ < topology_->size() &&
+                node_site_ < (*topology_)[node_index_].size());
+        }
+
+        // all sites running on the same node as this site, rooted at the
+        // node leader (not valid if this site is the only one on its node)
+        communicator const& node_communicator() const noexcept
+        {
+            return node_;
+        }
+
+        // all node leaders, rooted at the leader of the node of the root
+        // site (not valid on sites that are not a node leader)
+        communicator const& leaders_communicator() const noexcept
+        {
+            return leaders_;
+        }
+
+        std::size_t num_nodes() const noexcept
+        {
+            return topology_->size();
+        }
+
+        // index of the node of this site
+        std::size_t node_index() const noexcept
+        {
+            return node_index_;
+        }
+
+        std::size_t num_sites_on_node() const noexcept
+        {
+            return (*topology_)[node_index_].size();
+        }
+
+        // index of this site on its node
+        std::size_t node_site() const noexcept
+        {
+            return node_site_;
+        }
+
+        bool is_leader() const noexcept
+        {
+            return node_site_ == 0;
+        }
+
+        // the site with the given index on the given node
+        std::size_t site(std::size_t node, std::size_t index) const
+        {
+            return (*topology_)[node][index];
+        }
+
+    private:
+        communicator node_;
+        communicator leaders_;
+        std::shared_ptr<topology_type const> topology_;
+        std::size_t node_index_ = 0;
+        std::size_t node_site_ = 0;
+    };
+
+    HPX_EXPORT hpx::future<hierarchical_communicator>
+    create_hierarchical_communicator(char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        char const* node_name = nullptr);
+
+    HPX_EXPORT hierarchical_communicator create_hierarchical_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        char const* node_name = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // reduce the values of all sites on this node at the node leader
+        template <typename T, typename F>
+        hpx::future<T> node_reduce(
+            hierarchical_communicator const& comm, T&& local_result, F& op)
+        {
+            HPX_ASSERT(comm.is_leader());
+            if (comm.num_sites_on_node() == 1)
+            {
+                return hpx::make_ready_future(std::move(local_result));
+            }
+            return reduce_here(comm.node_communicator(),
+                std::move(local_result), op, this_site_arg(comm.node_site()));
+        }
+
+        // gather the values of all sites on this node at the node leader
+        template <typename T>
+        hpx::future<std::vector<T>> node_gather(
+            hierarchical_communicator const& comm, T&& local_result)
+        {
+            HPX_ASSERT(comm.is_leader());
+            if (comm.num_sites_on_node() == 1)
+            {
+                std::vector<T> result;
+                result.push_back(std::move(local_result));
+                return hpx::make_ready_future(std::move(result));
+            }
+            return gather_here(comm.node_communicator(),
+                std::move(local_result), this_site_arg(comm.node_site()));
+        }
+
+        // distribute a value from the node leader to all sites on this node
+        template <typename T>
+        hpx::future<T> node_broadcast(
+            hierarchical_communicator const& comm, T&& value)
+        {
+            HPX_ASSERT(comm.is_leader());
+            if (comm.num_sites_on_node() == 1)
+            {
+                return hpx::make_ready_future(std::move(value));
+            }
+            return broadcast_to(comm.node_communicator(), std::move(value),
+                this_site_arg(comm.node_site()));
+        }
+
+        // bring the values gathered from all nodes into the order of the
+        // sites
+        template <typename T>
+        std::vector<T> to_site_order(hierarchical_communicator const& comm,
+            std::vector<std::vector<T>>&& node_values)
+        {
+            HPX_ASSERT(node_values.size() == comm.num_nodes());
+
+            std::size_t num_sites = 0;
+            for (auto const& values : node_values)
+            {
+                num_sites += values.size();
+            }
+
+            std::vector<T> result(num_sites);
+            for (std::size_t node = 0; node != node_values.size(); ++node)
+            {
+                auto& values = node_values[node];
+                for (std::size_t i = 0; i != values.size(); ++i)
+                {
+                    result[comm.site(node, i)] = std::move(values[i]);
+                }
+            }
+            return result;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (!comm.is_leader())
+        {
+            hpx::future<void> f = reduce_there(comm.node_communicator(),
+                std::forward<T>(local_result), this_site_arg(comm.node_site()));
+
+            return f.then(hpx::launch::sync,
+                [comm = std::move(comm)](hpx::future<void>&& f) {
+                    f.get();    // propagate exceptions
+                    return broadcast_from<arg_type>(comm.node_communicator(),
+                        this_site_arg(comm.node_site()));
+                });
+        }
+
+        hpx::future<arg_type> f = detail::node_reduce(
+            comm, arg_type(std::forward<T>(local_result)), op);
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm), op = std::forward<F>(op)](
+                hpx::future<arg_type>&& f) mutable -> hpx::future<arg_type> {
+                hpx::future<arg_type> result = (comm.num_nodes() == 1) ?
+                    std::move(f) :
+                    all_reduce(comm.leaders_communicator(), f.get(), op,
+                        this_site_arg(comm.node_index()));
+
+                return result.then(hpx::launch::sync,
+                    [comm = std::move(comm)](hpx::future<arg_type>&& f) {
+                        return detail::node_broadcast(comm, f.get());
+                    });
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> reduce_here(
+        hierarchical_communicator comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        // the root site is always the leader of its node and the root of the
+        // communicator connecting the node leaders
+        HPX_ASSERT(comm.is_leader());
+
+        hpx::future<arg_type> f = detail::node_reduce(
+            comm, arg_type(std::forward<T>(local_result)), op);
+
+        if (comm.num_nodes() == 1)
+        {
+            return f;
+        }
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm), op = std::forward<F>(op)](
+                hpx::future<arg_type>&& f) mutable {
+                return reduce_here(comm.leaders_communicator(), f.get(), op,
+                    this_site_arg(comm.node_index()));
+            });
+    }
+
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(
+        hierarchical_communicator comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (!comm.is_leader())
+        {
+            return reduce_there(comm.node_communicator(),
+                std::forward<T>(local_result), this_site_arg(comm.node_site()));
+        }
+
+        HPX_ASSERT(comm.num_nodes() != 1);
+
+        hpx::future<arg_type> f = detail::node_reduce(
+            comm, arg_type(std::forward<T>(local_result)), op);
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm)](hpx::future<arg_type>&& f) {
+                return reduce_there(comm.leaders_communicator(), f.get(),
+                    this_site_arg(comm.node_index()));
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        hierarchical_communicator comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        // the root site is always the leader of its node and the root of the
+        // communicator connecting the node leaders
+        HPX_ASSERT(comm.is_leader());
+
+        hpx::future<std::vector<arg_type>> f = detail::node_gather(
+            comm, arg_type(std::forward<T>(local_result)));
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm)](hpx::future<std::vector<arg_type>>&& f)
+                -> hpx::future<std::vector<arg_type>> {
+                if (comm.num_nodes() == 1)
+                {
+                    std::vector<std::vector<arg_type>> node_values;
+                    node_values.push_back(f.get());
+                    return hpx::make_ready_future(detail::to_site_order(
+                        comm, std::move(node_values)));
+                }
+
+                hpx::future<std::vector<std::vector<arg_type>>> result =
+                    gather_here(comm.leaders_communicator(), f.get(),
+                        this_site_arg(comm.node_index()));
+
+                return result.then(hpx::launch::sync,
+                    [comm = std::move(comm)](
+                        hpx::future<std::vector<std::vector<arg_type>>>&& f) {
+                        return detail::to_site_order(comm, f.get());
+                    });
+            });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(
+        hierarchical_communicator comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (!comm.is_leader())
+        {
+            return gather_there(comm.node_communicator(),
+                std::forward<T>(local_result), this_site_arg(comm.node_site()));
+        }
+
+        HPX_ASSERT(comm.num_nodes() != 1);
+
+        hpx::future<std::vector<arg_type>> f = detail::node_gather(
+            comm, arg_type(std::forward<T>(local_result)));
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm)](hpx::future<std::vector<arg_type>>&& f) {
+                return gather_there(comm.leaders_communicator(), f.get(),
+                    this_site_arg(comm.node_index()));
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        hierarchical_communicator comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (!comm.is_leader())
+        {
+            hpx::future<void> f = gather_there(comm.node_communicator(),
+                std::forward<T>(local_result), this_site_arg(comm.node_site()));
+
+            return f.then(hpx::launch::sync,
+                [comm = std::move(comm)](hpx::future<void>&& f) {
+                    f.get();    // propagate exceptions
+                    return broadcast_from<std::vector<arg_type>>(
+                        comm.node_communicator(),
+                        this_site_arg(comm.node_site()));
+                });
+        }
+
+        hpx::future<std::vector<arg_type>> f = detail::node_gather(
+            comm, arg_type(std::forward<T>(local_result)));
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm)](hpx::future<std::vector<arg_type>>&& f)
+                -> hpx::future<std::vector<arg_type>> {
+                hpx::future<std::vector<std::vector<arg_type>>> node_values;
+                if (comm.num_nodes() == 1)
+                {
+                    std::vector<std::vector<arg_type>> values;
+                    values.push_back(f.get());
+                    node_values = hpx::make_ready_future(std::move(values));
+                }
+                else
+                {
+                    node_values = all_gather(comm.leaders_communicator(),
+                        f.get(), this_site_arg(comm.node_index()));
+                }
+
+                return node_values.then(hpx::launch::sync,
+                    [comm = std::move(comm)](
+                        hpx::future<std::vector<std::vector<arg_type>>>&& f) {
+                        return detail::node_broadcast(
+                            comm, detail::to_site_order(comm, f.get()));
+                    });
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        hierarchical_communicator comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        HPX_ASSERT(comm.is_leader());
+        if (comm.num_nodes() == 1)
+        {
+            return detail::node_broadcast(
+                comm, arg_type(std::forward<T>(local_result)));
+        }
+
+        // send the value to the other nodes and to the sites on this node
+        // concurrently
+        hpx::future<arg_type> leaders =
+            broadcast_to(comm.leaders_communicator(), local_result,
+                this_site_arg(comm.node_index()));
+        hpx::future<arg_type> node = detail::node_broadcast(
+            comm, arg_type(std::forward<T>(local_result)));
+
+        return hpx::dataflow(
+            hpx::launch::sync,
+            [](hpx::future<arg_type>&& leaders, hpx::future<arg_type>&& node) {
+                leaders.get();    // propagate exceptions
+                return node.get();
+            },
+            std::move(leaders), std::move(node));
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator comm)
+    {
+        if (!comm.is_leader())
+        {
+            return broadcast_from<T>(
+                comm.node_communicator(), this_site_arg(comm.node_site()));
+        }
+
+        HPX_ASSERT(comm.num_nodes() != 1);
+
+        hpx::future<T> f = broadcast_from<T>(
+            comm.leaders_communicator(), this_site_arg(comm.node_index()));
+
+        return f.then(hpx::launch::sync,
+            [comm = std::move(comm)](hpx::future<T>&& f) {
+                return detail::node_broadcast(comm, f.get());
+            });
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
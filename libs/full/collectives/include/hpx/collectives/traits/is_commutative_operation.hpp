@@ -0,0 +1,55 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <functional>
+#include <type_traits>
+
+namespace hpx { namespace traits {
+
+    namespace detail {
+
+        template <typename F, typename T>
+        struct is_builtin_commutative_operation
+          : std::integral_constant<bool,
+                std::is_arithmetic<T>::value &&
+                    (std::is_same<F, std::plus<T>>::value ||
+                        std::is_same<F, std::plus<>>::value ||
+                        std::is_same<F, std::multiplies<T>>::value ||
+                        std::is_same<F, std::multiplies<>>::value ||
+                        std::is_same<F, std::bit_and<T>>::value ||
+                        std::is_same<F, std::bit_and<>>::value ||
+                        std::is_same<F, std::bit_or<T>>::value ||
+                        std::is_same<F, std::bit_or<>>::value ||
+                        std::is_same<F, std::bit_xor<T>>::value ||
+                        std::is_same<F, std::bit_xor<>>::value ||
+                        std::is_same<F, std::logical_and<T>>::value ||
+                        std::is_same<F, std::logical_and<>>::value ||
+                        std::is_same<F, std::logical_or<T>>::value ||
+                        std::is_same<F, std::logical_or<>>::value)>
+        {
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point marking reduction operations F on values of type T
+    // whose result does not depend on the order of their arguments. The
+    // standard arithmetic, bitwise and logical function objects applied to
+    // arithmetic types are commutative, everything else has to be marked
+    // explicitly.
+    template <typename F, typename T, typename Enable = void>
+    struct is_commutative_operation
+      : detail::is_builtin_commutative_operation<std::decay_t<F>, T>
+    {
+    };
+
+    template <typename F, typename T>
+    HPX_INLINE_CONSTEXPR_VARIABLE bool is_commutative_operation_v =
+        is_commutative_operation<F, T>::value;
+}}    // namespace hpx::traits
@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <asio/ip/host_name.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace collectives {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        hierarchical_communicator make_hierarchical_communicator(
+            std::string const& basename, std::vector<std::string> const& nodes,
+            std::size_t this_site, generation_arg generation,
+            std::size_t root_site)
+        {
+            // group the sites by node, nodes are numbered in the order of the
+            // lowest site they host
+            std::map<std::string, std::size_t> node_indices;
+            auto topology = std::make_shared<
+                hierarchical_communicator::topology_type>();
+            auto& node_sites = *topology;
+
+            for (std::size_t site = 0; site != nodes.size(); ++site)
+            {
+                auto p = node_indices.emplace(nodes[site], node_sites.size());
+                if (p.second)
+                {
+                    node_sites.emplace_back();
+                }
+                node_sites[p.first->second].push_back(site);
+            }
+
+            // the root site becomes the leader of its node, all other nodes
+            // are led by their lowest site
+            std::size_t const root_node = node_indices[nodes[root_site]];
+            {
+                auto& sites = node_sites[root_node];
+                auto it = std::find(sites.begin(), sites.end(), root_site);
+                std::rotate(sites.begin(), it, std::next(it));
+            }
+
+            std::size_t const num_nodes = node_sites.size();
+            std::size_t const node_index = node_indices[nodes[this_site]];
+
+            auto const& sites = node_sites[node_index];
+            std::size_t const num_sites_on_node = sites.size();
+            std::size_t const node_site = static_cast<std::size_t>(
+                std::find(sites.begin(), sites.end(), this_site) -
+                sites.begin());
+
+            communicator node;
+            if (num_sites_on_node != 1)
+            {
+                std::string name =
+                    basename + "node/" + std::to_string(node_index) + "/";
+                node = create_communicator(name.c_str(),
+                    num_sites_arg(num_sites_on_node), this_site_arg(node_site),
+                    generation, root_site_arg(0));
+            }
+
+            communicator leaders;
+            if (node_site == 0 && num_nodes != 1)
+            {
+                std::string name = basename + "leaders/";
+                leaders = create_communicator(name.c_str(),
+                    num_sites_arg(num_nodes), this_site_arg(node_index),
+                    generation, root_site_arg(root_node));
+            }
+
+            hierarchical_communicator comm(std::move(node), std::move(leaders),
+                std::move(topology), node_index, node_site);
+            return comm;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<hierarchical_communicator> create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites, this_site_arg this_site,
+        generation_arg generation, root_site_arg root_site,
+        char const* node_name)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                agas::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        HPX_ASSERT(this_site < num_sites);
+        HPX_ASSERT(root_site < num_sites);
+
+        std::string name(basename);
+        std::string node(
+            node_name != nullptr ? node_name : asio::ip::host_name());
+
+        // exchange the node names of all sites once to establish the topology
+        std::string topology_name = name + "topology/";
+        communicator topology = create_communicator(topology_name.c_str(),
+            num_sites, this_site, generation, root_site_arg(0));
+
+        hpx::future<std::vector<std::string>> f =
+            all_gather(std::move(topology), std::move(node), this_site);
+
+        return f.then(hpx::launch::sync,
+            [name = std::move(name), this_site, generation, root_site](
+                hpx::future<std::vector<std::string>>&& f) {
+                return detail::make_hierarchical_communicator(
+                    name, f.get(), this_site, generation, root_site);
+            });
+    }
+
+    hierarchical_communicator create_hierarchical_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites, this_site_arg this_site,
+        generation_arg generation, root_site_arg root_site,
+        char const* node_name)
+    {
+        return create_hierarchical_communicator(basename, num_sites, this_site,
+            generation, root_site, node_name)
+            .get();
+    }
+}}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
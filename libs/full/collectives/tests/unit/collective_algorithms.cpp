@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* collective_algorithms_basename =
+    "/test/collective_algorithms/";
+
+// not a power of two to exercise the handling of excess sites
+constexpr std::size_t NUM_SITES = 13;
+constexpr std::size_t VECTOR_SIZE = 1000;
+
+collective_algorithm const algorithms[] = {
+    collective_algorithm::automatic,
+    collective_algorithm::recursive_doubling,
+    collective_algorithm::binomial_tree,
+    collective_algorithm::ring,
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce_scalar(
+    std::size_t site, channel_communicator comm, collective_algorithm alg)
+{
+    std::size_t result =
+        all_reduce(comm, site, std::plus<std::size_t>{}, alg).get();
+    HPX_TEST_EQ(result, NUM_SITES * (NUM_SITES - 1) / 2);
+}
+
+void test_all_reduce_vector(
+    std::size_t site, channel_communicator comm, collective_algorithm alg)
+{
+    std::vector<std::size_t> value(VECTOR_SIZE);
+    for (std::size_t i = 0; i != VECTOR_SIZE; ++i)
+    {
+        value[i] = site + i;
+    }
+
+    std::vector<std::size_t> result =
+        all_reduce(comm, std::move(value), std::plus<std::size_t>{}, alg)
+            .get();
+
+    HPX_TEST_EQ(result.size(), VECTOR_SIZE);
+    for (std::size_t i = 0; i != VECTOR_SIZE; ++i)
+    {
+        HPX_TEST_EQ(result[i], NUM_SITES * (NUM_SITES - 1) / 2 + NUM_SITES * i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// string concatenation is associative but not commutative, the values have to
+// be combined in the order of the sites
+static_assert(
+    !hpx::traits::is_commutative_operation_v<std::plus<>, std::string>,
+    "string concatenation is not commutative");
+static_assert(hpx::traits::is_commutative_operation_v<std::plus<>, int>,
+    "integer addition is commutative");
+
+std::string concatenated_sites()
+{
+    std::string expected;
+    for (std::size_t i = 0; i != NUM_SITES; ++i)
+    {
+        expected += std::to_string(i) + ",";
+    }
+    return expected;
+}
+
+void test_all_reduce_concatenate(
+    std::size_t site, channel_communicator comm, collective_algorithm alg)
+{
+    std::string result =
+        all_reduce(comm, std::to_string(site) + ",", std::plus<>{}, alg).get();
+    HPX_TEST_EQ(result, concatenated_sites());
+}
+
+void test_all_reduce_concatenate_vector(
+    std::size_t site, channel_communicator comm, collective_algorithm alg)
+{
+    std::vector<std::string> value(VECTOR_SIZE, std::to_string(site) + ",");
+
+    std::vector<std::string> result =
+        all_reduce(comm, std::move(value), std::plus<std::string>{}, alg)
+            .get();
+
+    std::string const expected = concatenated_sites();
+
+    HPX_TEST_EQ(result.size(), VECTOR_SIZE);
+    for (std::size_t i = 0; i != VECTOR_SIZE; ++i)
+    {
+        HPX_TEST_EQ(result[i], expected);
+    }
+}
+
+// the ring algorithm rejects non-commutative operations
+void test_all_reduce_concatenate_ring(channel_communicator comm)
+{
+    bool caught_exception = false;
+    try
+    {
+        std::vector<std::string> value(VECTOR_SIZE);
+        all_reduce(comm, std::move(value), std::plus<std::string>{},
+            collective_algorithm::ring)
+            .get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(int(e.get_error()), int(hpx::bad_parameter));
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_gather(
+    std::size_t site, channel_communicator comm, collective_algorithm alg)
+{
+    std::vector<std::size_t> result = all_gather(comm, site, alg).get();
+
+    HPX_TEST_EQ(result.size(), NUM_SITES);
+    for (std::size_t i = 0; i != NUM_SITES; ++i)
+    {
+        HPX_TEST_EQ(result[i], i);
+    }
+}
+
+void test_site(std::size_t site, channel_communicator comm)
+{
+    for (collective_algorithm alg : algorithms)
+    {
+        if (alg != collective_algorithm::ring)
+        {
+            test_all_reduce_scalar(site, comm, alg);
+            test_all_reduce_concatenate(site, comm, alg);
+            test_all_reduce_concatenate_vector(site, comm, alg);
+        }
+        test_all_reduce_vector(site, comm, alg);
+        test_all_gather(site, comm, alg);
+    }
+
+    test_all_reduce_concatenate_ring(comm);
+}
+
+void test_collective_algorithms()
+{
+    std::vector<channel_communicator> comms;
+    comms.reserve(NUM_SITES);
+
+    for (std::size_t i = 0; i != NUM_SITES; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            collective_algorithms_basename, num_sites_arg(NUM_SITES),
+            this_site_arg(i)));
+    }
+
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(NUM_SITES);
+
+        for (std::size_t i = 0; i != NUM_SITES; ++i)
+        {
+            tasks.push_back(hpx::async(test_site, i, comms[i]));
+        }
+
+        hpx::wait_all(tasks);
+        for (auto& f : tasks)
+        {
+            HPX_TEST(!f.has_exception());
+        }
+    }
+}
+
+int hpx_main()
+{
+    test_collective_algorithms();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
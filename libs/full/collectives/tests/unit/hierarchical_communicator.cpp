@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* hierarchical_communicator_basename =
+    "/test/hierarchical_communicator/";
+
+// simulate three nodes hosting 3, 3, and 2 sites
+constexpr std::size_t NUM_SITES = 8;
+constexpr std::size_t SITES_PER_NODE = 3;
+constexpr std::size_t ROOT_SITE = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_site(std::size_t site, hierarchical_communicator comm)
+{
+    std::size_t const expected = NUM_SITES * (NUM_SITES - 1) / 2;
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        // all_reduce
+        std::size_t result =
+            all_reduce(comm, site, std::plus<std::size_t>{}).get();
+        HPX_TEST_EQ(result, expected);
+
+        // reduce
+        if (site == ROOT_SITE)
+        {
+            result = reduce_here(comm, site, std::plus<std::size_t>{}).get();
+            HPX_TEST_EQ(result, expected);
+        }
+        else
+        {
+            reduce_there(comm, site, std::plus<std::size_t>{}).get();
+        }
+
+        // broadcast
+        if (site == ROOT_SITE)
+        {
+            result = broadcast_to(comm, expected + i).get();
+        }
+        else
+        {
+            result = broadcast_from<std::size_t>(comm).get();
+        }
+        HPX_TEST_EQ(result, expected + i);
+
+        // gather, the values are delivered in the order of the sites
+        if (site == ROOT_SITE)
+        {
+            std::vector<std::size_t> values =
+                gather_here(comm, site + i).get();
+            HPX_TEST_EQ(values.size(), NUM_SITES);
+            for (std::size_t j = 0; j != values.size(); ++j)
+            {
+                HPX_TEST_EQ(values[j], j + i);
+            }
+        }
+        else
+        {
+            gather_there(comm, site + i).get();
+        }
+
+        // all_gather
+        std::vector<std::size_t> values = all_gather(comm, site * i).get();
+        HPX_TEST_EQ(values.size(), NUM_SITES);
+        for (std::size_t j = 0; j != values.size(); ++j)
+        {
+            HPX_TEST_EQ(values[j], j * i);
+        }
+    }
+}
+
+void test_hierarchical_communicator()
+{
+    std::vector<hpx::future<hierarchical_communicator>> comms;
+    comms.reserve(NUM_SITES);
+
+    for (std::size_t i = 0; i != NUM_SITES; ++i)
+    {
+        std::string node = "node" + std::to_string(i / SITES_PER_NODE);
+        comms.push_back(create_hierarchical_communicator(
+            hierarchical_communicator_basename, num_sites_arg(NUM_SITES),
+            this_site_arg(i), generation_arg(), root_site_arg(ROOT_SITE),
+            node.c_str()));
+    }
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(NUM_SITES);
+
+    for (std::size_t i = 0; i != NUM_SITES; ++i)
+    {
+        hierarchical_communicator comm = comms[i].get();
+
+        HPX_TEST_EQ(comm.num_nodes(), std::size_t(3));
+        HPX_TEST_EQ(comm.node_index(), i / SITES_PER_NODE);
+        HPX_TEST_EQ(comm.num_sites_on_node(),
+            i < 2 * SITES_PER_NODE ? SITES_PER_NODE :
+                                     NUM_SITES - 2 * SITES_PER_NODE);
+        HPX_TEST_EQ(comm.site(comm.node_index(), comm.node_site()), i);
+        HPX_TEST_EQ(comm.is_leader(),
+            i == ROOT_SITE || (i != 3 && i % SITES_PER_NODE == 0));
+
+        tasks.push_back(hpx::async(test_site, i, std::move(comm)));
+    }
+
+    hpx::wait_all(tasks);
+    for (auto& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+}
+
+int hpx_main()
+{
+    test_hierarchical_communicator();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
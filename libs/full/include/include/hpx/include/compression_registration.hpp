@@ -10,8 +10,10 @@
 
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
 #include <hpx/plugins/binary_filter/bzip2_serialization_filter_registration.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter_registration.hpp>
 #include <hpx/plugins/binary_filter/snappy_serialization_filter_registration.hpp>
 #include <hpx/plugins/binary_filter/zlib_serialization_filter_registration.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter_registration.hpp>
 #endif
 
 #if HPX_HAVE_DEPRECATION_WARNINGS
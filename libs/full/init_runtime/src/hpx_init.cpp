@@ -23,6 +23,7 @@
 #include <hpx/hpx_user_main_config.hpp>
 #include <hpx/init_runtime/detail/init_logging.hpp>
 #include <hpx/init_runtime/detail/run_or_start.hpp>
+#include <hpx/init_runtime_local/detail/init_stacks.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -337,11 +338,8 @@ namespace hpx {
         void activate_global_options(
             util::command_line_handling& cmdline, int argc, char** argv)
         {
-#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
-    defined(__FreeBSD__)
-            threads::coroutines::detail::posix::use_guard_pages =
-                cmdline.rtcfg_.use_stack_guard_pages();
-#endif
+            local::detail::init_stacks(cmdline.rtcfg_);
+
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
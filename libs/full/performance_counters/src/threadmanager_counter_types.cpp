@@ -20,6 +20,8 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -432,6 +434,15 @@ namespace hpx { namespace performance_counters { namespace detail {
         return naming::invalid_gid;
     }
 #endif
+
+    // creates a raw counter reporting the value returned by the given
+    // function
+    naming::gid_type locality_raw_function_counter_creator(
+        std::int64_t (*func)(bool), counter_info const& info, error_code& ec)
+    {
+        return locality_raw_counter_creator(
+            info, util::function_nonser<std::int64_t(bool)>(func), ec);
+    }
 }}}    // namespace hpx::performance_counters::detail
 
 namespace hpx { namespace performance_counters {
@@ -699,6 +710,46 @@ namespace hpx { namespace performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            {"/threads/count/stack-usage-samples",
+                counter_monotonically_increasing,
+                "returns the number of terminated HPX-threads for which the "
+                "stack usage has been recorded (see hpx.stacks.profile_usage)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_raw_function_counter_creator,
+                    &threads::get_stack_usage_sample_count),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-reassignments",
+                counter_monotonically_increasing,
+                "returns the number of HPX-threads which were run on a smaller "
+                "stack than requested based on the recorded stack usage (see "
+                "hpx.stacks.auto_select)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_raw_function_counter_creator,
+                    &threads::get_stack_size_reassignment_count),
+                &locality_counter_discoverer, ""},
+#endif
+            {"/threads/count/stackless-threads",
+                counter_monotonically_increasing,
+                "returns the number of HPX-threads which were created without "
+                "a stack of their own by the stackless fast path (see "
+                "hpx.stacks.stackless_fast_path)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_raw_function_counter_creator,
+                    &threads::get_stackless_thread_count),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stackless-promotions",
+                counter_monotonically_increasing,
+                "returns the number of HPX-threads created by the stackless "
+                "fast path which suspended and had to be given a stack",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(
+                    &detail::locality_raw_function_counter_creator,
+                    &threads::get_stackless_promotion_count),
+                &locality_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses", counter_monotonically_increasing,
                 "returns the number of times that the referenced worker-thread "
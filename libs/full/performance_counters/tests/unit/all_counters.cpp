@@ -83,6 +83,12 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    "/threads/count/stack-usage-samples",
+    "/threads/count/stack-reassignments",
+#endif
+    "/threads/count/stackless-threads",
+    "/threads/count/stackless-promotions",
     "/scheduler/utilization/instantaneous", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
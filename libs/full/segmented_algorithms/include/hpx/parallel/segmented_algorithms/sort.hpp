@@ -0,0 +1,790 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/tuple.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/unused.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/traits/zip_iterator.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/zip_iterator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    //
+    // The segmented sort is a distributed samplesort: every part of the
+    // range is sorted locally, a set of splitters is selected from regular
+    // samples of all parts, and every part then fetches the runs of elements
+    // belonging to it from all other parts and merges them. Each part keeps
+    // its original size, only the values are redistributed.
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Merged data is kept on the locality of the target part until all
+        // parts have fetched their runs, only then it is moved into place.
+        template <typename T>
+        struct sort_buffers
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            static sort_buffers& get()
+            {
+                static sort_buffers buffers;
+                return buffers;
+            }
+
+            void store(std::uint64_t key, std::vector<T>&& data)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                buffers_.emplace(key, std::move(data));
+            }
+
+            std::vector<T> retrieve(std::uint64_t key)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                std::vector<T> data;
+                auto it = buffers_.find(key);
+                if (it != buffers_.end())
+                {
+                    data = std::move(it->second);
+                    buffers_.erase(it);
+                }
+                return data;
+            }
+
+            mutex_type mtx_;
+            std::unordered_map<std::uint64_t, std::vector<T>> buffers_;
+        };
+
+        inline std::uint64_t next_sort_buffer_key(std::size_t count)
+        {
+            static std::atomic<std::uint64_t> next_key(0);
+            return (std::uint64_t(hpx::get_locality_id()) << 40) +
+                next_key.fetch_add(count);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sort the elements of one part and return regularly spaced samples
+        // of their (projected) keys.
+        template <typename Iter, typename Key>
+        struct sort_and_sample
+          : public detail::algorithm<sort_and_sample<Iter, Key>,
+                std::vector<Key>>
+        {
+            sort_and_sample()
+              : sort_and_sample::algorithm("sort_and_sample")
+            {
+            }
+
+            template <typename LocalIter, typename Proj>
+            static std::vector<Key> take_samples(LocalIter first,
+                LocalIter last, Proj& proj, std::size_t num_samples)
+            {
+                std::size_t const count = std::distance(first, last);
+                num_samples = (std::min)(num_samples, count);
+
+                std::vector<Key> samples;
+                samples.reserve(num_samples);
+
+                for (std::size_t i = 0; i != num_samples; ++i)
+                {
+                    LocalIter it = std::next(first, i * count / num_samples);
+                    samples.push_back(HPX_INVOKE(proj, *it));
+                }
+                return samples;
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Comp,
+                typename Proj>
+            static std::vector<Key> sequential(ExPolicy, LocalIter first,
+                LocalIter last, Comp&& comp, Proj&& proj,
+                std::size_t num_samples)
+            {
+                std::sort(first, last,
+                    util::compare_projected<Comp&, Proj&>(comp, proj));
+                return take_samples(first, last, proj, num_samples);
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<Key>>::type
+            parallel(ExPolicy&& policy, LocalIter first, LocalIter last,
+                Comp&& comp, Proj&& proj, std::size_t num_samples)
+            {
+                detail::sort<LocalIter>().call(
+                    std::forward<ExPolicy>(policy), first, last, comp, proj);
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<Key>>::get(
+                    take_samples(first, last, proj, num_samples));
+            }
+        };
+
+        // Determine the boundaries of the buckets defined by the splitters
+        // inside of a sorted part.
+        template <typename Iter, typename Key>
+        struct sort_bucket_offsets
+          : public detail::algorithm<sort_bucket_offsets<Iter, Key>,
+                std::vector<std::size_t>>
+        {
+            sort_bucket_offsets()
+              : sort_bucket_offsets::algorithm("sort_bucket_offsets")
+            {
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Comp,
+                typename Proj>
+            static std::vector<std::size_t> sequential(ExPolicy,
+                LocalIter first, LocalIter last,
+                std::vector<Key> const& splitters, Comp&& comp, Proj&& proj)
+            {
+                std::vector<std::size_t> offsets;
+                offsets.reserve(splitters.size() + 2);
+                offsets.push_back(0);
+
+                LocalIter it = first;
+                for (Key const& splitter : splitters)
+                {
+                    it = std::lower_bound(it, last, splitter,
+                        [&](auto&& value, Key const& key) {
+                            return HPX_INVOKE(
+                                comp, HPX_INVOKE(proj, value), key);
+                        });
+                    offsets.push_back(std::distance(first, it));
+                }
+                offsets.push_back(std::distance(first, last));
+
+                return offsets;
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<std::size_t>>::type
+            parallel(ExPolicy&& policy, LocalIter first, LocalIter last,
+                std::vector<Key> const& splitters, Comp&& comp, Proj&& proj)
+            {
+                // a handful of binary searches is not worth being split up
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<std::size_t>>::get(sequential(
+                    std::forward<ExPolicy>(policy), first, last, splitters,
+                    comp, proj));
+            }
+        };
+
+        // Copy a run of sorted elements out of a part.
+        template <typename Iter>
+        struct sort_copy_run
+          : public detail::algorithm<sort_copy_run<Iter>,
+                std::vector<typename std::iterator_traits<Iter>::value_type>>
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            sort_copy_run()
+              : sort_copy_run::algorithm("sort_copy_run")
+            {
+            }
+
+            template <typename ExPolicy, typename LocalIter>
+            static std::vector<value_type> sequential(
+                ExPolicy, LocalIter first, LocalIter last)
+            {
+                return std::vector<value_type>(first, last);
+            }
+
+            template <typename ExPolicy, typename LocalIter>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<value_type>>::type
+            parallel(ExPolicy&& policy, LocalIter first, LocalIter last)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<value_type>>::get(
+                    sequential(std::forward<ExPolicy>(policy), first, last));
+            }
+        };
+
+        // Fetch the runs of elements belonging to a part from all parts,
+        // merge them, and keep the slice of the merged sequence which ends up
+        // in this part.
+        template <typename Iter>
+        struct sort_merge_runs
+          : public detail::algorithm<sort_merge_runs<Iter>, std::size_t>
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using run_type = hpx::tuple<hpx::id_type, Iter, Iter>;
+
+            sort_merge_runs()
+              : sort_merge_runs::algorithm("sort_merge_runs")
+            {
+            }
+
+            template <typename ExPolicy>
+            static std::vector<value_type> fetch_runs(
+                std::vector<run_type> const& runs,
+                std::vector<std::size_t>& bounds)
+            {
+                std::vector<hpx::future<std::vector<value_type>>> fetched;
+                fetched.reserve(runs.size());
+
+                for (run_type const& run : runs)
+                {
+                    fetched.push_back(dispatch_async(hpx::get<0>(run),
+                        sort_copy_run<Iter>(), hpx::execution::seq,
+                        std::true_type(), hpx::get<1>(run), hpx::get<2>(run)));
+                }
+
+                hpx::wait_all(fetched);
+
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(fetched, errors);
+
+                std::vector<value_type> buffer;
+                bounds.reserve(fetched.size() + 1);
+                bounds.push_back(0);
+
+                for (auto& f : fetched)
+                {
+                    std::vector<value_type> run = f.get();
+                    buffer.insert(buffer.end(),
+                        std::make_move_iterator(run.begin()),
+                        std::make_move_iterator(run.end()));
+                    bounds.push_back(buffer.size());
+                }
+                return buffer;
+            }
+
+            // merge neighboring runs pairwise until a single run is left
+            template <typename Compare>
+            static void merge_runs(std::vector<value_type>& buffer,
+                std::vector<std::size_t>& bounds, Compare const& compare,
+                bool concurrently)
+            {
+                auto const base = buffer.begin();
+                while (bounds.size() > 2)
+                {
+                    std::vector<hpx::future<void>> merges;
+                    std::vector<std::size_t> merged;
+                    merged.reserve(bounds.size() / 2 + 2);
+
+                    std::size_t i = 0;
+                    for (/**/; i + 2 < bounds.size(); i += 2)
+                    {
+                        auto first = base + bounds[i];
+                        auto middle = base + bounds[i + 1];
+                        auto last = base + bounds[i + 2];
+
+                        if (concurrently)
+                        {
+                            merges.push_back(
+                                hpx::async([first, middle, last, &compare]() {
+                                    std::inplace_merge(
+                                        first, middle, last, compare);
+                                }));
+                        }
+                        else
+                        {
+                            std::inplace_merge(first, middle, last, compare);
+                        }
+                        merged.push_back(bounds[i]);
+                    }
+
+                    // the last run is carried over if the number of runs is
+                    // odd
+                    for (/**/; i != bounds.size(); ++i)
+                    {
+                        merged.push_back(bounds[i]);
+                    }
+
+                    hpx::wait_all(merges);
+                    for (auto& f : merges)
+                    {
+                        f.get();    // rethrow exceptions
+                    }
+
+                    bounds = std::move(merged);
+                }
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static std::size_t fetch_and_merge(
+                std::vector<run_type> const& runs,
+                std::size_t skip, std::size_t count, std::uint64_t key,
+                Comp& comp, Proj& proj, bool concurrently)
+            {
+                std::vector<std::size_t> bounds;
+                std::vector<value_type> buffer =
+                    fetch_runs<ExPolicy>(runs, bounds);
+
+                merge_runs(buffer, bounds,
+                    util::compare_projected<Comp&, Proj&>(comp, proj),
+                    concurrently);
+
+                HPX_ASSERT(skip + count <= buffer.size());
+                buffer.erase(buffer.begin() + skip + count, buffer.end());
+                buffer.erase(buffer.begin(), buffer.begin() + skip);
+
+                sort_buffers<value_type>::get().store(key, std::move(buffer));
+                return count;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static std::size_t sequential(ExPolicy,
+                std::vector<run_type> const& runs, std::size_t skip,
+                std::size_t count, std::uint64_t key, Comp&& comp, Proj&& proj)
+            {
+                return fetch_and_merge<std::decay_t<ExPolicy>>(
+                    runs, skip, count, key, comp, proj, false);
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::size_t>::type
+            parallel(ExPolicy&&, std::vector<run_type> const& runs,
+                std::size_t skip, std::size_t count, std::uint64_t key,
+                Comp&& comp, Proj&& proj)
+            {
+                using policy_type = std::decay_t<ExPolicy>;
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(fetch_and_merge<policy_type>(
+                    runs, skip, count, key, comp, proj, true));
+            }
+        };
+
+        // Move the merged data into a part (or drop it if the sort failed).
+        template <typename Iter>
+        struct sort_commit_run
+          : public detail::algorithm<sort_commit_run<Iter>, std::size_t>
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            sort_commit_run()
+              : sort_commit_run::algorithm("sort_commit_run")
+            {
+            }
+
+            template <typename ExPolicy, typename LocalIter>
+            static std::size_t sequential(ExPolicy, LocalIter first,
+                LocalIter last, std::uint64_t key, bool commit)
+            {
+                std::vector<value_type> buffer =
+                    sort_buffers<value_type>::get().retrieve(key);
+                if (!commit)
+                {
+                    return 0;
+                }
+
+                HPX_ASSERT(buffer.size() ==
+                    static_cast<std::size_t>(std::distance(first, last)));
+                HPX_UNUSED(last);
+
+                std::move(buffer.begin(), buffer.end(), first);
+                return buffer.size();
+            }
+
+            template <typename ExPolicy, typename LocalIter>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::size_t>::type
+            parallel(ExPolicy&& policy, LocalIter first, LocalIter last,
+                std::uint64_t key, bool commit)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(sequential(
+                    std::forward<ExPolicy>(policy), first, last, key, commit));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename LocalIter>
+        struct sort_part
+        {
+            hpx::id_type id;
+            LocalIter first;
+            LocalIter last;
+            std::size_t size;
+        };
+
+        template <typename LocalIter>
+        void add_sort_part(std::vector<sort_part<LocalIter>>& parts,
+            hpx::id_type const& id, LocalIter first, LocalIter last)
+        {
+            std::size_t size = std::distance(first, last);
+            if (size != 0)
+            {
+                parts.push_back(sort_part<LocalIter>{id, first, last, size});
+            }
+        }
+
+        template <typename ExPolicy, typename T>
+        void wait_for_sort_parts(std::vector<hpx::future<T>>& futures)
+        {
+            hpx::wait_all(futures);
+
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                futures, errors);
+        }
+
+        // The policy used here is always synchronous, it is passed on to
+        // the localities to sort and merge the individual parts.
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        SegIter segmented_samplesort(ExPolicy const& policy, SegIter first,
+            SegIter last, Comp& comp, Proj& proj)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using segment_iterator = typename traits::segment_iterator;
+            using local_iterator_type = typename traits::local_iterator;
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+            using key_type = std::decay_t<
+                hpx::util::invoke_result_t<Proj&, value_type&>>;
+            using run_type = hpx::tuple<hpx::id_type, local_iterator_type,
+                local_iterator_type>;
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            // collect the non-empty parts of all segments covered by the range
+            std::vector<sort_part<local_iterator_type>> parts;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                add_sort_part(parts, traits::get_id(sit), traits::local(first),
+                    traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                add_sort_part(parts, traits::get_id(sit), traits::local(first),
+                    traits::end(sit));
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    add_sort_part(parts, traits::get_id(sit),
+                        traits::begin(sit), traits::end(sit));
+                }
+
+                // handle the beginning of the last partition
+                add_sort_part(parts, traits::get_id(sit), traits::begin(sit),
+                    traits::local(last));
+            }
+
+            std::size_t const num_parts = parts.size();
+            if (num_parts == 0)
+            {
+                return last;
+            }
+
+            // step 1: sort all parts locally, every part contributes
+            // num_parts regularly spaced samples (PSRS). For distinct keys
+            // this bounds the size of each bucket by about twice the average
+            // part size. Equal keys all end up in the same bucket, so with
+            // many duplicates a bucket can be arbitrarily large. This only
+            // increases the amount of data fetched and merged in step 4,
+            // which redistributes the buckets by their global positions.
+            std::size_t const num_samples = num_parts == 1 ? 0 : num_parts;
+
+            std::vector<hpx::future<std::vector<key_type>>> sampled;
+            sampled.reserve(num_parts);
+            for (auto const& part : parts)
+            {
+                sampled.push_back(dispatch_async(part.id,
+                    sort_and_sample<local_iterator_type, key_type>(), policy,
+                    is_seq(), part.first, part.last, comp, proj,
+                    num_samples));
+            }
+            wait_for_sort_parts<ExPolicy>(sampled);
+
+            if (num_parts == 1)
+            {
+                return last;
+            }
+
+            // step 2: select the splitters from the gathered samples
+            std::vector<key_type> samples;
+            samples.reserve(num_parts * num_samples);
+            for (auto& f : sampled)
+            {
+                std::vector<key_type> s = f.get();
+                samples.insert(samples.end(),
+                    std::make_move_iterator(s.begin()),
+                    std::make_move_iterator(s.end()));
+            }
+
+            std::sort(samples.begin(), samples.end(),
+                [&](key_type const& lhs, key_type const& rhs) {
+                    return HPX_INVOKE(comp, lhs, rhs);
+                });
+
+            std::vector<key_type> splitters;
+            splitters.reserve(num_parts - 1);
+            for (std::size_t i = 1; i != num_parts; ++i)
+            {
+                splitters.push_back(samples[i * samples.size() / num_parts]);
+            }
+
+            // step 3: locate the buckets inside of all parts
+            std::vector<hpx::future<std::vector<std::size_t>>> bucketed;
+            bucketed.reserve(num_parts);
+            for (auto const& part : parts)
+            {
+                bucketed.push_back(dispatch_async(part.id,
+                    sort_bucket_offsets<local_iterator_type, key_type>(),
+                    policy, is_seq(), part.first, part.last, splitters, comp,
+                    proj));
+            }
+            wait_for_sort_parts<ExPolicy>(bucketed);
+
+            std::vector<std::vector<std::size_t>> offsets;
+            offsets.reserve(num_parts);
+            for (auto& f : bucketed)
+            {
+                offsets.push_back(f.get());
+            }
+
+            // global positions of all buckets and all parts in the sorted
+            // sequence
+            std::vector<std::size_t> bucket_starts(num_parts + 1, 0);
+            std::vector<std::size_t> part_starts(num_parts + 1, 0);
+            for (std::size_t b = 0; b != num_parts; ++b)
+            {
+                std::size_t size = 0;
+                for (std::size_t s = 0; s != num_parts; ++s)
+                {
+                    size += offsets[s][b + 1] - offsets[s][b];
+                }
+                bucket_starts[b + 1] = bucket_starts[b] + size;
+                part_starts[b + 1] = part_starts[b] + parts[b].size;
+            }
+            HPX_ASSERT(bucket_starts[num_parts] == part_starts[num_parts]);
+
+            // step 4: every part fetches the runs of all buckets overlapping
+            // with its range of global positions from all parts, merges them
+            // and keeps its slice of the result
+            std::uint64_t const key = next_sort_buffer_key(num_parts);
+
+            std::vector<hpx::future<std::size_t>> merged;
+            merged.reserve(num_parts);
+            for (std::size_t j = 0; j != num_parts; ++j)
+            {
+                std::size_t const lo = part_starts[j];
+                std::size_t const hi = part_starts[j + 1];
+
+                std::size_t const b_first =
+                    std::upper_bound(
+                        bucket_starts.begin(), bucket_starts.end(), lo) -
+                    bucket_starts.begin() - 1;
+                std::size_t const b_last =
+                    std::lower_bound(
+                        bucket_starts.begin(), bucket_starts.end(), hi) -
+                    bucket_starts.begin();
+
+                std::vector<run_type> runs;
+                runs.reserve(num_parts);
+                for (std::size_t s = 0; s != num_parts; ++s)
+                {
+                    std::size_t const begin = offsets[s][b_first];
+                    std::size_t const end = offsets[s][b_last];
+                    if (begin != end)
+                    {
+                        runs.emplace_back(parts[s].id,
+                            std::next(parts[s].first, begin),
+                            std::next(parts[s].first, end));
+                    }
+                }
+
+                merged.push_back(dispatch_async(parts[j].id,
+                    sort_merge_runs<local_iterator_type>(), policy, is_seq(),
+                    std::move(runs), lo - bucket_starts[b_first], hi - lo,
+                    key + j, comp, proj));
+            }
+            hpx::wait_all(merged);
+
+            // step 5: all runs have been fetched, move the merged data into
+            // place (or release it if any of the parts failed)
+            bool const failed = std::any_of(merged.begin(), merged.end(),
+                [](hpx::future<std::size_t> const& f) {
+                    return f.has_exception();
+                });
+
+            std::vector<hpx::future<std::size_t>> committed;
+            committed.reserve(num_parts);
+            for (std::size_t j = 0; j != num_parts; ++j)
+            {
+                if (!merged[j].has_exception())
+                {
+                    committed.push_back(dispatch_async(parts[j].id,
+                        sort_commit_run<local_iterator_type>(), policy,
+                        is_seq(), parts[j].first, parts[j].last, key + j,
+                        !failed));
+                }
+            }
+            hpx::wait_all(committed);
+
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                merged, errors);
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                committed, errors);
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_sort(ExPolicy&&, SegIter first, SegIter last, Comp&& comp,
+            Proj&& proj)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, SegIter>;
+
+            // the parts are sorted using the corresponding synchronous
+            // policy, asynchronous execution is handled here
+            using local_policy_type = std::conditional_t<
+                hpx::is_sequenced_execution_policy_v<std::decay_t<ExPolicy>>,
+                hpx::execution::sequenced_policy,
+                hpx::execution::parallel_policy>;
+
+            if constexpr (hpx::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(hpx::async(
+                    [first, last, comp = std::forward<Comp>(comp),
+                        proj = std::forward<Proj>(proj)]() mutable {
+                        return segmented_samplesort(
+                            local_policy_type(), first, last, comp, proj);
+                    }));
+            }
+            else
+            {
+                return result::get(segmented_samplesort(
+                    local_policy_type(), first, last, comp, proj));
+            }
+        }
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key_(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first, Compare&& comp, std::true_type)
+        {
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
+
+            // the zipped key and value sequences are segmented themselves as
+            // long as both are laid out identically
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                segmented_sort(std::forward<ExPolicy>(policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    std::forward<Compare>(comp), detail::extract_key()));
+        }
+#endif
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void tag_dispatch(hpx::sort_t, SegIter first, SegIter last,
+        Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        hpx::parallel::v1::detail::segmented_sort(hpx::execution::seq, first,
+            last, std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        typename Proj = hpx::parallel::util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    tag_dispatch(hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        using result_type =
+            typename hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::type;
+
+        return hpx::util::void_guard<result_type>(),
+               hpx::parallel::v1::detail::segmented_sort(
+                   std::forward<ExPolicy>(policy), first, last,
+                   std::forward<Comp>(comp), std::forward<Proj>(proj));
+    }
+}}    // namespace hpx::segmented
@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_random(hpx::partitioned_vector<T>& v, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it)
+        *it = T(dis(gen));
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+                                                        end = v.end();
+    for (/**/; it != end; ++it)
+        values.push_back(*it);
+
+    return values;
+}
+
+template <typename T, typename Comp>
+void verify_sorted(hpx::partitioned_vector<T> const& v,
+    std::vector<T> expected, Comp comp, std::size_t begin, std::size_t end)
+{
+    std::sort(expected.begin() + begin, expected.begin() + end, comp);
+    HPX_TEST(get_values(v) == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(std::size_t size, DistPolicy const& policy,
+    ExPolicy const& sort_policy, int max_value)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    fill_random(c, max_value);
+    std::vector<T> values = get_values(c);
+    hpx::sort(sort_policy, c.begin(), c.end());
+    verify_sorted(c, values, std::less<T>(), 0, size);
+
+    fill_random(c, max_value);
+    values = get_values(c);
+    hpx::sort(sort_policy, c.begin(), c.end(), std::greater<T>());
+    verify_sorted(c, values, std::greater<T>(), 0, size);
+
+    fill_random(c, max_value);
+    values = get_values(c);
+    hpx::sort(sort_policy, c.begin() + 1, c.end() - 1);
+    verify_sorted(c, values, std::less<T>(), 1, size - 1);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& sort_policy, int max_value)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+
+    fill_random(c, max_value);
+    std::vector<T> values = get_values(c);
+    hpx::future<void> f = hpx::sort(sort_policy, c.begin(), c.end());
+    f.wait();
+    verify_sorted(c, values, std::less<T>(), 0, size);
+
+    fill_random(c, max_value);
+    values = get_values(c);
+    hpx::future<void> f1 = hpx::sort(sort_policy, c.begin() + 1, c.end() - 1);
+    f1.wait();
+    verify_sorted(c, values, std::less<T>(), 1, size - 1);
+}
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+template <typename DistPolicy, typename ExPolicy>
+void sort_by_key_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<int> keys(size, policy);
+    hpx::partitioned_vector<double> values(size, policy);
+
+    // derive the values from the keys to be able to verify that the values
+    // follow their keys
+    fill_random(keys, 1000);
+    std::vector<int> k = get_values(keys);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = double(k[i] * 2);
+    }
+
+    hpx::parallel::sort_by_key(
+        sort_policy, keys.begin(), keys.end(), values.begin());
+
+    std::vector<int> sorted_keys = get_values(keys);
+    std::vector<double> sorted_values = get_values(values);
+
+    std::sort(k.begin(), k.end());
+    HPX_TEST(sorted_keys == k);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(sorted_values[i], double(sorted_keys[i] * 2));
+    }
+}
+#endif
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    // many duplicate keys, and all keys distinct
+    for (int max_value : {10, 100000})
+    {
+        sort_algo_tests_with_policy<T>(size, policy, seq, max_value);
+        sort_algo_tests_with_policy<T>(size, policy, par, max_value);
+
+        //async
+        sort_algo_tests_with_policy_async<T>(
+            size, policy, seq(task), max_value);
+        sort_algo_tests_with_policy_async<T>(
+            size, policy, par(task), max_value);
+    }
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    sort_by_key_tests_with_policy(size, policy, seq);
+    sort_by_key_tests_with_policy(size, policy, par);
+#endif
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return 0;
+}
+#endif
@@ -0,0 +1,260 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/actions.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+namespace hpx { namespace traits {
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      level = 3
+    //      dictionary =
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "level = 3\n"
+                   "dictionary = ";
+        }
+    };
+}}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        struct zstd_cctx_deleter
+        {
+            void operator()(ZSTD_CCtx* ctx) const { ZSTD_freeCCtx(ctx); }
+        };
+
+        struct zstd_dctx_deleter
+        {
+            void operator()(ZSTD_DCtx* ctx) const { ZSTD_freeDCtx(ctx); }
+        };
+
+        // The (de-)compression contexts are expensive to create, reuse them
+        // for all filters running on the same OS-thread. The contexts are
+        // not used across suspension points.
+        ZSTD_CCtx* get_compression_context()
+        {
+            static thread_local std::unique_ptr<ZSTD_CCtx, zstd_cctx_deleter>
+                ctx(ZSTD_createCCtx());
+            return ctx.get();
+        }
+
+        ZSTD_DCtx* get_decompression_context()
+        {
+            static thread_local std::unique_ptr<ZSTD_DCtx, zstd_dctx_deleter>
+                ctx(ZSTD_createDCtx());
+            return ctx.get();
+        }
+
+        // compression parameters, initialized from the configuration once
+        struct zstd_parameters
+        {
+            zstd_parameters()
+              : level_(hpx::util::from_string<int>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.zstd_serialization_filter.level", "3"),
+                    ZSTD_CLEVEL_DEFAULT))
+              , cdict_(nullptr)
+              , ddict_(nullptr)
+            {
+                level_ = (std::max)(
+                    (std::min)(level_, ZSTD_maxCLevel()), ZSTD_minCLevel());
+
+                std::string path = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (path.empty())
+                    return;
+
+                std::ifstream in(path, std::ios::binary);
+                std::vector<char> dictionary(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+                if (!in.good() && !in.eof())
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "zstd_serialization_filter",
+                        "could not read compression dictionary: {}", path);
+                }
+
+                cdict_ = ZSTD_createCDict(
+                    dictionary.data(), dictionary.size(), level_);
+                ddict_ = ZSTD_createDDict(
+                    dictionary.data(), dictionary.size());
+                if (cdict_ == nullptr || ddict_ == nullptr)
+                {
+                    ZSTD_freeCDict(cdict_);
+                    ZSTD_freeDDict(ddict_);
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "zstd_serialization_filter",
+                        "invalid compression dictionary: {}", path);
+                }
+            }
+
+            ~zstd_parameters()
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+            }
+
+            int level_;
+            ZSTD_CDict* cdict_;
+            ZSTD_DDict* ddict_;
+        };
+
+        zstd_parameters const& get_parameters()
+        {
+            static zstd_parameters const parameters;
+            return parameters;
+        }
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        detail::zstd_parameters const& params = detail::get_parameters();
+        ZSTD_DCtx* ctx = detail::get_decompression_context();
+
+        buffer_.resize(buffer_size);
+
+        std::size_t result = 0;
+        if (params.ddict_ != nullptr)
+        {
+            result = ZSTD_decompress_usingDDict(ctx, buffer_.data(),
+                buffer_size, buffer, size, params.ddict_);
+        }
+        else
+        {
+            result = ZSTD_decompressDCtx(
+                ctx, buffer_.data(), buffer_size, buffer, size);
+        }
+
+        if (ZSTD_isError(result))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure: {}", ZSTD_getErrorName(result));
+            return 0;
+        }
+
+        if (result != buffer_size)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure, number of bytes expected: {}, "
+                "number of bytes decoded: {}",
+                buffer_size, result);
+            return 0;
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        detail::zstd_parameters const& params = detail::get_parameters();
+        ZSTD_CCtx* ctx = detail::get_compression_context();
+
+        // compress everything in one go
+        std::size_t result = 0;
+        if (params.cdict_ != nullptr)
+        {
+            result = ZSTD_compress_usingCDict(ctx, dst, dst_count,
+                buffer_.data(), buffer_.size(), params.cdict_);
+        }
+        else
+        {
+            result = ZSTD_compressCCtx(ctx, dst, dst_count, buffer_.data(),
+                buffer_.size(), params.level_);
+        }
+
+        if (ZSTD_isError(result))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::flush",
+                "compression failure: {}", ZSTD_getErrorName(result));
+            return false;
+        }
+
+        written = result;
+        return true;
+    }
+}}}
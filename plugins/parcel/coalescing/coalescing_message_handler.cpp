@@ -25,11 +25,14 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -42,6 +45,7 @@ namespace hpx { namespace traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -50,7 +54,8 @@ namespace hpx { namespace traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}    // namespace hpx::traits
@@ -84,6 +89,25 @@ namespace hpx { namespace plugins { namespace parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        // weight of new samples in the moving averages used for the
+        // adaptive coalescing parameters (1/8)
+        constexpr int adaptive_average_shift = 3;
+
+        void update_moving_average(std::int64_t& average, std::int64_t sample)
+        {
+            if (average == 0)
+                average = sample;
+            else
+                average += (sample - average) >> adaptive_average_shift;
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +123,79 @@ namespace hpx { namespace plugins { namespace parcel {
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+        adaptive_num_coalesced_parcels_ = num_coalesced_parcels_;
+        adaptive_interval_ = interval_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t coalescing_message_handler::get_num_coalesced_parcels_locked()
+        const
+    {
+        return adaptive_ ? adaptive_num_coalesced_parcels_ :
+                           num_coalesced_parcels_;
+    }
+
+    std::size_t coalescing_message_handler::get_interval_locked() const
+    {
+        return adaptive_ ? adaptive_interval_ : interval_;
+    }
+
+    // Derive the coalescing parameters from the observed data. Waiting for
+    // more parcels for longer than it takes to send a message does not pay
+    // off, so the flush interval follows the average latency of sending a
+    // message. The number of coalesced parcels is the number of parcels
+    // expected to arrive during that interval. Both values are bounded by
+    // the configured parameters.
+    void coalescing_message_handler::update_adaptive_parameters_locked()
+    {
+        HPX_ASSERT(adaptive_);
+
+        std::int64_t const max_interval = std::int64_t(interval_) * 1000;
+        std::int64_t interval = max_interval;
+        if (average_latency_ != 0 && average_latency_ < max_interval)
+            interval = average_latency_;
+
+        adaptive_interval_ = (std::max)(std::size_t(interval / 1000),
+            (std::min)(interval_, std::size_t(1)));
+
+        std::size_t num = num_coalesced_parcels_;
+        if (average_time_between_parcels_ != 0)
+        {
+            std::int64_t expected = interval / average_time_between_parcels_;
+            if (expected < std::int64_t(num))
+                num = std::size_t(expected);
+        }
+        adaptive_num_coalesced_parcels_ = (std::max)(num, std::size_t(1));
+    }
+
+    coalescing_message_handler::write_handler_type
+    coalescing_message_handler::measure_latency(
+        std::int64_t sent_at, write_handler_type f)
+    {
+        // keep this handler alive until the message was sent
+        std::shared_ptr<coalescing_message_handler> handler =
+            std::static_pointer_cast<coalescing_message_handler>(
+                shared_from_this());
+
+        return [handler = std::move(handler), sent_at, f = std::move(f)](
+                   std::error_code const& ec, parcelset::parcel const& p) {
+            handler->record_latency(
+                hpx::chrono::high_resolution_clock::now() - sent_at);
+            if (!f.empty())
+                f(ec, p);
+        };
+    }
+
+    void coalescing_message_handler::record_latency(std::int64_t latency)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        detail::update_moving_average(average_latency_, latency);
+    }
+
     coalescing_message_handler::coalescing_message_handler(
         char const* action_name, parcelset::parcelport* pp, std::size_t num,
         std::size_t interval)
@@ -114,6 +211,11 @@ namespace hpx { namespace plugins { namespace parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , adaptive_num_coalesced_parcels_(num_coalesced_parcels_)
+      , adaptive_interval_(interval_)
+      , average_time_between_parcels_(0)
+      , average_latency_(0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -141,7 +243,11 @@ namespace hpx { namespace plugins { namespace parcel {
                 this),
             util::bind_front(&coalescing_message_handler::
                                  get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            util::bind_front(
+                &coalescing_message_handler::get_max_parcels_per_message, this),
+            util::bind_front(
+                &coalescing_message_handler::get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -150,6 +256,9 @@ namespace hpx { namespace plugins { namespace parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -167,7 +276,16 @@ namespace hpx { namespace plugins { namespace parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        if (adaptive_)
+        {
+            // times between parcels larger than the maximal interval all
+            // prevent coalescing, limit their influence on the average
+            detail::update_moving_average(average_time_between_parcels_,
+                (std::min)(time_since_last_parcel,
+                    std::int64_t(interval_) * 1000));
+        }
+
+        std::chrono::microseconds interval(get_interval_locked());
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
@@ -176,6 +294,10 @@ namespace hpx { namespace plugins { namespace parcel {
                 std::chrono::nanoseconds(time_since_last_parcel) > interval))
         {
             ++num_messages_;
+            if (adaptive_)
+            {
+                f = measure_latency(parcel_time, std::move(f));
+            }
             l.unlock();
 
             // this instance should not buffer parcels anymore
@@ -274,7 +396,17 @@ namespace hpx { namespace plugins { namespace parcel {
         if (buffer_.empty())
             return false;
 
-        detail::message_buffer buff(num_coalesced_parcels_);
+        if (adaptive_)
+        {
+            update_adaptive_parameters_locked();
+
+            // all parcels of the buffer are sent as a single message
+            parcelset::write_handler_type& f = buffer_.last_handler();
+            f = measure_latency(
+                hpx::chrono::high_resolution_clock::now(), std::move(f));
+        }
+
+        detail::message_buffer buff(get_num_coalesced_parcels_locked());
         std::swap(buff, buffer_);
 
         ++num_messages_;
@@ -319,6 +451,20 @@ namespace hpx { namespace plugins { namespace parcel {
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_max_parcels_per_message(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(get_num_coalesced_parcels_locked());
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(get_interval_locked()) * 1000;
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
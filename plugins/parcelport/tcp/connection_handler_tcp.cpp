@@ -31,6 +31,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -63,11 +64,44 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             );
     }
 
+    namespace detail
+    {
+        std::size_t receive_buffer_pool_size(
+            util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.receive_buffer_pool_size", 4);
+        }
+
+        std::size_t receive_buffer_pool_max_buffer_size(
+            util::runtime_configuration const& ini)
+        {
+            return hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.tcp.receive_buffer_pool_max_buffer_size",
+                67108864);
+        }
+
+        write_gather_parameters get_write_gather_parameters(
+            util::runtime_configuration const& ini)
+        {
+            return write_gather_parameters(
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.max_write_buffers", 64),
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.write_gather_threshold", 4096),
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.max_write_gather_size", 1048576));
+        }
+    }
+
     connection_handler::connection_handler(
         util::runtime_configuration const& ini,
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , receive_buffer_pool_(detail::receive_buffer_pool_size(ini),
+            detail::receive_buffer_pool_max_buffer_size(ini))
+      , write_gather_params_(detail::get_write_gather_parameters(ini))
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
@@ -99,7 +133,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, receive_buffer_pool_));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -157,7 +192,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(
+            new sender(io_service, l, this, write_gather_params_));
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -277,6 +313,42 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         return parcelset::locality(locality());
     }
 
+    bool connection_handler::is_same_node(parcelset::locality const& l) const
+    {
+        if (!l || std::strcmp(l.type(), locality::type()) != 0)
+            return false;
+
+        std::string const addr =
+            hpx::util::cleanup_ip_address(l.get<locality>().address());
+
+        // connections to the loopback interface never leave this node
+        if (addr == "localhost" || addr == "::1" || addr.rfind("127.", 0) == 0)
+            return true;
+
+        return addr ==
+            hpx::util::cleanup_ip_address(here_.get<locality>().address());
+    }
+
+    std::int64_t connection_handler::get_receive_buffer_pool_statistics(
+        receive_buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t) {
+            case receive_buffer_pool_hits:
+                return receive_buffer_pool_.get_hits(reset);
+
+            case receive_buffer_pool_misses:
+                return receive_buffer_pool_.get_misses(reset);
+
+            default:
+                break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "tcp::connection_handler::get_receive_buffer_pool_statistics",
+            "invalid receive buffer pool statistics type");
+        return 0;
+    }
+
     // accepted new incoming connection
     void connection_handler::handle_accept(std::error_code const & e,
         std::shared_ptr<receiver> receiver_conn)
@@ -288,7 +360,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             asio::io_context& io_service = io_service_pool_.get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, receive_buffer_pool_));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this, util::placeholders::_1, receiver_conn));
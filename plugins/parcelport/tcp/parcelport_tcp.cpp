@@ -22,6 +22,11 @@ namespace hpx { namespace traits
     //      [hpx.parcel.tcp]
     //      ...
     //      priority = 1
+    //      receive_buffer_pool_size = 4
+    //      receive_buffer_pool_max_buffer_size = 67108864
+    //      max_write_buffers = 64
+    //      write_gather_threshold = 4096
+    //      max_write_gather_size = 1048576
     //
     template <>
     struct plugin_config_data<hpx::parcelset::policies::tcp::connection_handler>
@@ -40,7 +45,18 @@ namespace hpx { namespace traits
 
         static char const* call()
         {
-            return "";
+            return
+                "receive_buffer_pool_size = "
+                    "${HPX_PARCEL_TCP_RECEIVE_BUFFER_POOL_SIZE:4}\n"
+                "receive_buffer_pool_max_buffer_size = "
+                    "${HPX_PARCEL_TCP_RECEIVE_BUFFER_POOL_MAX_BUFFER_SIZE:"
+                    "67108864}\n"
+                "max_write_buffers = "
+                    "${HPX_PARCEL_TCP_MAX_WRITE_BUFFERS:64}\n"
+                "write_gather_threshold = "
+                    "${HPX_PARCEL_TCP_WRITE_GATHER_THRESHOLD:4096}\n"
+                "max_write_gather_size = "
+                    "${HPX_PARCEL_TCP_MAX_WRITE_GATHER_SIZE:1048576}\n";
         }
     };
 }}
@@ -1098,6 +1098,18 @@ namespace hpx { namespace parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // receive buffer pool statistics
+    std::int64_t parcelhandler::get_receive_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::receive_buffer_pool_statistics_type stat_type,
+        bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_buffer_pool_statistics(stat_type, reset) :
+                    0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1167,6 +1179,7 @@ namespace hpx { namespace parcelset {
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            register_receive_buffer_pool_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1627,6 +1640,59 @@ namespace hpx { namespace parcelset {
             sizeof(connection_cache_types) / sizeof(connection_cache_types[0]));
     }
 
+    // register connection specific performance counters related to the pool
+    // of receive buffers
+    void parcelhandler::register_receive_buffer_pool_counter_types(
+        std::string const& pp_type)
+    {
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> pool_hits(
+            util::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                this, pp_type, parcelport::receive_buffer_pool_hits));
+        util::function_nonser<std::int64_t(bool)> pool_misses(
+            util::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                this, pp_type, parcelport::receive_buffer_pool_misses));
+
+        performance_counters::generic_counter_type_data const
+            receive_buffer_pool_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-buffer-pool-hits", pp_type),
+                    performance_counters::counter_monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of receive buffers which were "
+                        "reused from the receive buffer pool for the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        std::move(pool_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-buffer-pool-misses",
+                     pp_type),
+                    performance_counters::counter_monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of receive buffers which had to "
+                        "be newly allocated as the receive buffer pool for "
+                        "the {} connection type on the referenced locality "
+                        "had no suitable buffer available",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    util::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        std::move(pool_misses), _2),
+                    &performance_counters::locality_counter_discoverer, ""}};
+        performance_counters::install_counter_types(receive_buffer_pool_types,
+            sizeof(receive_buffer_pool_types) /
+                sizeof(receive_buffer_pool_types[0]));
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1703,6 +1769,14 @@ namespace hpx { namespace parcelset {
             "$[hpx.parcel.array_optimization]}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.emplace_back(
+            "compression_threshold = ${HPX_PARCEL_COMPRESSION_THRESHOLD:512}");
+        ini_defs.emplace_back(
+            "compress_intra_node = ${HPX_PARCEL_COMPRESS_INTRA_NODE:0}");
+        ini_defs.emplace_back(
+            "compression_min_ratio = ${HPX_PARCEL_COMPRESSION_MIN_RATIO:1.2}");
+        ini_defs.emplace_back("compression_sample_interval = "
+                              "${HPX_PARCEL_COMPRESSION_SAMPLE_INTERVAL:16}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.emplace_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -43,6 +43,15 @@ namespace hpx { namespace parcelset
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
+        compression_policy_(
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel." + type + ".compression_threshold", 512),
+            hpx::util::get_entry_as<int>(ini,
+                "hpx.parcel." + type + ".compress_intra_node", 0) != 0,
+            hpx::util::get_entry_as<double>(ini,
+                "hpx.parcel." + type + ".compression_min_ratio", 1.2),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel." + type + ".compression_sample_interval", 16)),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
         type_(type)
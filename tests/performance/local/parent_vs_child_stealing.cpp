@@ -11,6 +11,8 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
@@ -71,6 +73,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool do_child = vm.count("no-child") == 0;      // fork only
     bool do_parent = vm.count("no-parent") == 0;    // async only
+    bool do_child_first = vm.count("no-child-first") == 0;
     std::size_t num_cores = hpx::get_os_thread_count();
     if (vm.count("num_cores") != 0)
         num_cores = vm["num_cores"].as<std::size_t>();
@@ -85,19 +88,32 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (do_child)
         parent_stealing_time = measure(hpx::launch::fork);
 
+    // finally collect times for async with the scheduler spawning child-first
+    double child_first_time = 0;
+    if (do_child_first)
+    {
+        hpx::threads::add_scheduler_mode(
+            hpx::threads::policies::spawn_child_first);
+        child_first_time = measure(hpx::launch::async);
+        hpx::threads::remove_scheduler_mode(
+            hpx::threads::policies::spawn_child_first);
+    }
+
     if (print_header)
     {
         hpx::cout
-            << "num_cores,num_threads,child_stealing_time[s],parent_stealing_time[s]"
+            << "num_cores,num_threads,child_stealing_time[s],parent_stealing_time[s],"
+               "child_first_time[s]"
             << hpx::endl;
     }
 
     hpx::util::format_to(hpx::cout,
-        "{},{},{},{}",
+        "{},{},{},{},{}",
         num_cores,
         iterations,
         child_stealing_time,
-        parent_stealing_time) << hpx::endl;
+        parent_stealing_time,
+        child_first_time) << hpx::endl;
 
     return hpx::finalize();
 }
@@ -124,6 +140,8 @@ int main(int argc, char* argv[])
         ("no-header", "do not print out the csv header row")
         ("no-child", "do not test child-stealing (launch::fork only)")
         ("no-parent", "do not test child-stealing (launch::async only)")
+        ("no-child-first", "do not test launch::async with the scheduler "
+            "spawning child-first (spawn_child_first mode)")
         ;
 
     hpx::init_params init_args;
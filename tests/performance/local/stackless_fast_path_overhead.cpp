@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of spawning threads with and without
+// the stackless fast path, and the cost of looking up whether threads of a
+// given description were promoted before (which is done for each thread
+// spawned using the stackless fast path).
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/stackless_fast_path.hpp>
+#include <hpx/threading_base/thread_stack_usage.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t num_tasks = 100000;
+std::size_t num_lookups = 10000000;
+
+// descriptions are identified by the address of their name
+char const* const promoted_name = "promoted";
+char const* const not_promoted_name = "not promoted";
+
+void null_function() {}
+
+// time per thread spawned, in seconds
+double measure_spawn()
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(&null_function));
+
+    hpx::wait_all(tasks);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9 / num_tasks;
+}
+
+// time per lookup of a recorded promotion, in seconds
+double measure_lookup(char const* name)
+{
+    hpx::util::thread_description desc(name);
+
+    std::size_t promoted = 0;
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != num_lookups; ++i)
+    {
+        if (hpx::threads::get_recorded_stackless_promotion(desc))
+            ++promoted;
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    HPX_TEST(promoted == 0 || promoted == num_lookups);
+
+    return static_cast<double>(end - start) / 1e9 / num_lookups;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    hpx::threads::stackless_fast_path_parameters const params =
+        hpx::threads::get_stackless_fast_path_parameters();
+
+    hpx::threads::stackless_fast_path_parameters disabled = params;
+    disabled.enabled = false;
+    hpx::threads::set_stackless_fast_path_parameters(disabled);
+
+    double const stackful_time = measure_spawn();
+    std::cout << "Spawn time (stackful): " << stackful_time << " [s]"
+              << std::endl;
+    hpx::util::print_cdash_timing("StacklessFastPathDisabled", stackful_time);
+
+    hpx::threads::stackless_fast_path_parameters enabled = params;
+    enabled.enabled = true;
+    enabled.strict = false;
+    hpx::threads::set_stackless_fast_path_parameters(enabled);
+
+    double const stackless_time = measure_spawn();
+    std::cout << "Spawn time (stackless): " << stackless_time << " [s]"
+              << std::endl;
+    hpx::util::print_cdash_timing("StacklessFastPathEnabled", stackless_time);
+
+    hpx::threads::set_stackless_fast_path_parameters(params);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    hpx::threads::record_stackless_promotion(
+        hpx::util::thread_description(promoted_name));
+
+    double const lookup_hit = measure_lookup(promoted_name);
+    double const lookup_miss = measure_lookup(not_promoted_name);
+
+    std::cout << "Promotion lookup time (recorded): " << lookup_hit << " [s]"
+              << std::endl;
+    std::cout << "Promotion lookup time (not recorded): " << lookup_miss
+              << " [s]" << std::endl;
+    hpx::util::print_cdash_timing("StacklessPromotionLookupHit", lookup_hit);
+    hpx::util::print_cdash_timing("StacklessPromotionLookupMiss", lookup_miss);
+
+    hpx::threads::reset_recorded_stack_usage();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks,t", value<std::size_t>(&num_tasks)->default_value(100000),
+         "number of tasks to spawn (default: 100000)")
+        ("lookups,l", value<std::size_t>(&num_lookups)->default_value(10000000),
+         "number of promotion lookups to time (default: 10000000)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
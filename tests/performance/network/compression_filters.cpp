@@ -0,0 +1,244 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the compression ratio and the throughput of the
+// available binary filters (parcel compression plugins) for a couple of
+// representative parcel payloads.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/timing/high_resolution_timer.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_BZIP2)
+#include <hpx/plugins/binary_filter/bzip2_serialization_filter.hpp>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_SNAPPY)
+#include <hpx/plugins/binary_filter/snappy_serialization_filter.hpp>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZLIB)
+#include <hpx/plugins/binary_filter/zlib_serialization_filter.hpp>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<char> serialize(T const& data)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << data;
+    return buffer;
+}
+
+// uniformly distributed random numbers, hardly compressible
+std::vector<char> dense_payload(std::size_t size, std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> dist;
+    std::vector<double> data(size / sizeof(double));
+    for (double& d : data)
+        d = dist(gen);
+    return serialize(data);
+}
+
+// a sparse matrix in compressed row storage format with a banded structure
+std::vector<char> sparse_matrix_payload(std::size_t size, std::mt19937& gen)
+{
+    std::size_t const nnz_per_row = 7;
+    std::size_t const num_rows = size /
+        (nnz_per_row * (sizeof(std::int64_t) + sizeof(double)) +
+            sizeof(std::int64_t));
+
+    std::uniform_int_distribution<std::int64_t> offset(-16, 16);
+    std::discrete_distribution<int> value_index({8, 4, 2, 1});
+    double const values[] = {1.0, -1.0, 0.5, -0.25};
+
+    std::vector<std::int64_t> row_pointers;
+    std::vector<std::int64_t> column_indices;
+    std::vector<double> entries;
+
+    row_pointers.reserve(num_rows + 1);
+    column_indices.reserve(num_rows * nnz_per_row);
+    entries.reserve(num_rows * nnz_per_row);
+
+    row_pointers.push_back(0);
+    for (std::size_t row = 0; row != num_rows; ++row)
+    {
+        for (std::size_t i = 0; i != nnz_per_row; ++i)
+        {
+            column_indices.push_back(std::int64_t(row) + offset(gen));
+            entries.push_back(values[value_index(gen)]);
+        }
+        row_pointers.push_back(std::int64_t(column_indices.size()));
+    }
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << row_pointers << column_indices << entries;
+    return buffer;
+}
+
+// a vector where only every 20th element is non-zero
+std::vector<char> mostly_zero_payload(std::size_t size, std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> dist;
+    std::vector<double> data(size / sizeof(double), 0.0);
+    for (std::size_t i = 0; i < data.size(); i += 20)
+        data[i] = dist(gen);
+    return serialize(data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Filter>
+std::size_t compress(std::vector<char> const& data, std::vector<char>& result)
+{
+    Filter filter(true);
+    filter.set_max_length(data.size());
+    filter.save(data.data(), data.size());
+
+    // grow the output buffer until all data fits (same as the parcel layer)
+    std::size_t current = 0;
+    while (true)
+    {
+        std::size_t written = 0;
+        bool flushed = filter.flush(
+            result.data() + current, result.size() - current, written);
+
+        current += written;
+        if (flushed)
+            break;
+
+        result.resize(2 * result.size());
+    }
+    return current;
+}
+
+template <typename Filter>
+void decompress(std::vector<char> const& compressed, std::size_t size,
+    std::vector<char>& result)
+{
+    Filter filter(false);
+    filter.init_data(compressed.data(), size, result.size());
+    filter.load(result.data(), result.size());
+}
+
+template <typename Filter>
+void run_benchmark(char const* filter_name, char const* payload_name,
+    std::vector<char> const& data, std::size_t iterations)
+{
+    std::vector<char> compressed(data.size() / 2 + 1024);
+    std::vector<char> decompressed(data.size());
+    std::size_t compressed_size = 0;
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+        compressed_size = compress<Filter>(data, compressed);
+    double compress_time = t.elapsed();
+
+    t.restart();
+    for (std::size_t i = 0; i != iterations; ++i)
+        decompress<Filter>(compressed, compressed_size, decompressed);
+    double decompress_time = t.elapsed();
+
+    HPX_TEST(data == decompressed);
+
+    double const mbytes = double(data.size() * iterations) / (1024 * 1024);
+    hpx::util::format_to(std::cout,
+        "{1:-8} {2:-14} ratio: {3:7.3} compress: {4:9.1} MB/s "
+        "decompress: {5:9.1} MB/s\n",
+        filter_name, payload_name, double(data.size()) / compressed_size,
+        mbytes / compress_time, mbytes / decompress_time);
+}
+
+template <typename Filter>
+void run_benchmarks(char const* filter_name,
+    std::vector<std::pair<char const*, std::vector<char>>> const& payloads,
+    std::size_t iterations)
+{
+    for (auto const& payload : payloads)
+    {
+        run_benchmark<Filter>(
+            filter_name, payload.first, payload.second, iterations);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["payload-size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    std::mt19937 gen(vm["seed"].as<unsigned int>());
+
+    std::vector<std::pair<char const*, std::vector<char>>> payloads;
+    payloads.emplace_back("dense", dense_payload(size, gen));
+    payloads.emplace_back("sparse-matrix", sparse_matrix_payload(size, gen));
+    payloads.emplace_back("mostly-zero", mostly_zero_payload(size, gen));
+
+    using namespace hpx::plugins::compression;
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+    run_benchmarks<lz4_serialization_filter>("lz4", payloads, iterations);
+#endif
+#if defined(HPX_HAVE_COMPRESSION_SNAPPY)
+    run_benchmarks<snappy_serialization_filter>(
+        "snappy", payloads, iterations);
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+    run_benchmarks<zstd_serialization_filter>("zstd", payloads, iterations);
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZLIB)
+    run_benchmarks<zlib_serialization_filter>("zlib", payloads, iterations);
+#endif
+#if defined(HPX_HAVE_COMPRESSION_BZIP2)
+    run_benchmarks<bzip2_serialization_filter>("bzip2", payloads, iterations);
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("payload-size", value<std::size_t>()->default_value(1048576),
+         "approximate size of the payloads in bytes (default: 1048576)")
+        ("iterations", value<std::size_t>()->default_value(20),
+         "number of times each payload is compressed (default: 20)")
+        ("seed", value<unsigned int>()->default_value(42),
+         "the random number generator seed to use (default: 42)")
+        ;
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,149 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime/parcelset/detail/compression_policy.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// minimal locality implementation identifying a destination by a number
+struct test_locality
+{
+    explicit test_locality(int id = 0)
+      : id_(id)
+    {
+    }
+
+    static char const* type()
+    {
+        return "test";
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return id_ != 0;
+    }
+
+    void save(hpx::serialization::output_archive&) const {}
+    void load(hpx::serialization::input_archive&) {}
+
+    friend bool operator==(test_locality const& lhs, test_locality const& rhs)
+    {
+        return lhs.id_ == rhs.id_;
+    }
+
+    friend bool operator<(test_locality const& lhs, test_locality const& rhs)
+    {
+        return lhs.id_ < rhs.id_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, test_locality const& l)
+    {
+        return os << l.id_;
+    }
+
+    int id_;
+};
+
+using hpx::parcelset::locality;
+using hpx::parcelset::detail::compression_policy;
+
+///////////////////////////////////////////////////////////////////////////////
+// messages are compressed only if they reach the threshold
+void test_threshold()
+{
+    locality const dest(test_locality(1));
+
+    compression_policy policy(1024, false, 0.0, 0);
+
+    HPX_TEST(!policy.compress(dest, false, 0));
+    HPX_TEST(!policy.compress(dest, false, 1023));
+    HPX_TEST(policy.compress(dest, false, 1024));
+    HPX_TEST(policy.compress(dest, false, 1025));
+
+    // a threshold of zero compresses all messages
+    compression_policy always(0, false, 0.0, 0);
+    HPX_TEST(always.compress(dest, false, 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// messages to the same node are compressed only if requested
+void test_intra_node()
+{
+    locality const dest(test_locality(1));
+
+    compression_policy policy(1024, false, 0.0, 0);
+    HPX_TEST(!policy.compress(dest, true, 4096));
+    HPX_TEST(policy.compress(dest, false, 4096));
+
+    compression_policy intra_node(1024, true, 0.0, 0);
+    HPX_TEST(intra_node.compress(dest, true, 4096));
+    HPX_TEST(!intra_node.compress(dest, true, 1023));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the recorded compression ratios feed back into the decisions made for
+// the messages sent to the same destination
+void test_round_trip()
+{
+    locality const dest(test_locality(1));
+    locality const other(test_locality(2));
+
+    compression_policy policy(0, false, 2.0, 4);
+
+    // destinations without samples are compressed
+    HPX_TEST(policy.compress(dest, false, 4096));
+
+    // data which does not compress well is compressed for every 4th message
+    // only
+    policy.update(dest, 1000, 900);
+    HPX_TEST(!policy.compress(dest, false, 4096));
+    HPX_TEST(!policy.compress(dest, false, 4096));
+    HPX_TEST(!policy.compress(dest, false, 4096));
+    HPX_TEST(policy.compress(dest, false, 4096));
+    HPX_TEST(!policy.compress(dest, false, 4096));
+
+    // other destinations are not affected
+    HPX_TEST(policy.compress(other, false, 4096));
+
+    // compression is resumed as soon as the data compresses well again
+    policy.update(dest, 1000, 100);
+    HPX_TEST(policy.compress(dest, false, 4096));
+    HPX_TEST(policy.compress(dest, false, 4096));
+
+    // empty samples are ignored
+    policy.update(other, 1000, 0);
+    HPX_TEST(policy.compress(other, false, 4096));
+
+    // without a sample interval, badly compressing data is never compressed
+    compression_policy no_sampling(0, false, 2.0, 0);
+    no_sampling.update(dest, 1000, 900);
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(!no_sampling.compress(dest, false, 4096));
+    }
+
+    // without a minimal ratio all messages are compressed
+    compression_policy no_ratio(0, false, 0.0, 4);
+    no_ratio.update(dest, 1000, 900);
+    HPX_TEST(no_ratio.compress(dest, false, 4096));
+    HPX_TEST(no_ratio.compress(dest, false, 4096));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_threshold();
+    test_intra_node();
+    test_round_trip();
+
+    return hpx::util::report_errors();
+}
@@ -13,10 +13,16 @@
 #include <hpx/include/parcel_coalescing.hpp>
 #include <hpx/include/performance_counters.hpp>
 #include <hpx/modules/naming.hpp>
+#include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <type_traits>
@@ -26,6 +32,10 @@
 std::size_t const vsize_default = 1024;
 std::size_t const numparcels_default = 10;
 
+// number of parcels sent per action
+std::size_t test1_parcels_sent = 0;
+std::size_t test2_parcels_sent = 0;
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Action, typename T>
 hpx::parcelset::parcel
@@ -50,12 +60,25 @@ struct test_server : hpx::components::component_base<test_server>
 {
     typedef hpx::components::component_base<test_server> base_type;
 
-    hpx::id_type test1(std::vector<double> const&)
+    hpx::id_type test1(std::vector<double> const& data)
     {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        received_.push_back(data);
         return hpx::find_here();
     }
 
+    std::vector<std::vector<double> > get_received()
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        return received_;
+    }
+
     HPX_DEFINE_COMPONENT_ACTION(test_server, test1, test1_action);
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_received,
+        get_received_action);
+
+    hpx::lcos::local::spinlock mtx_;
+    std::vector<std::vector<double> > received_;
 };
 
 typedef hpx::components::component<test_server> server_type;
@@ -67,6 +90,25 @@ HPX_REGISTER_ACTION_DECLARATION(test1_action);
 HPX_ACTION_USES_MESSAGE_COALESCING(test1_action);
 HPX_REGISTER_ACTION(test1_action);
 
+typedef test_server::get_received_action get_received_action;
+
+HPX_REGISTER_ACTION_DECLARATION(get_received_action);
+HPX_REGISTER_ACTION(get_received_action);
+
+// verify that all parcels sent to the given object arrived unchanged
+void test_received(hpx::id_type const& id, std::size_t count,
+    std::vector<double> const& data)
+{
+    std::vector<std::vector<double> > received =
+        hpx::async<get_received_action>(id).get();
+
+    HPX_TEST_EQ(received.size(), count);
+    for (std::vector<double> const& d : received)
+    {
+        HPX_TEST(d == data);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void test_plain_argument(hpx::id_type const& id)
 {
@@ -91,6 +133,7 @@ void test_plain_argument(hpx::id_type const& id)
 
         results.push_back(std::move(f));
     }
+    test1_parcels_sent += numparcels_default;
 
     // send parcels
     hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
@@ -103,17 +146,30 @@ void test_plain_argument(hpx::id_type const& id)
     {
         HPX_TEST_EQ(f.get(), id);
     }
+
+    test_received(c.get_id(), numparcels_default, data);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-hpx::id_type test2(hpx::future<double> const&)
+// number of test2 invocations which received the expected argument
+std::atomic<std::size_t> test2_received(0);
+
+hpx::id_type test2(hpx::future<double> const& f)
 {
+    if (f.get() == 42.0)
+        ++test2_received;
     return hpx::find_here();
 }
 HPX_DECLARE_PLAIN_ACTION(test2, test2_action);
 HPX_ACTION_USES_MESSAGE_COALESCING(test2_action);
 HPX_PLAIN_ACTION(test2, test2_action);
 
+std::size_t get_test2_received()
+{
+    return test2_received.load();
+}
+HPX_PLAIN_ACTION(get_test2_received, get_test2_received_action);
+
 void test_future_argument(hpx::id_type const& id)
 {
     std::vector<hpx::lcos::local::promise<double> > args;
@@ -122,6 +178,9 @@ void test_future_argument(hpx::id_type const& id)
     std::vector<hpx::future<hpx::id_type> > results;
     results.reserve(numparcels_default);
 
+    std::size_t received_before =
+        hpx::async<get_test2_received_action>(id).get();
+
     // create parcels
     std::vector<hpx::parcelset::parcel> parcels;
     for (std::size_t i = 0; i != numparcels_default; ++i)
@@ -138,6 +197,7 @@ void test_future_argument(hpx::id_type const& id)
         args.push_back(std::move(p_arg));
         results.push_back(std::move(f_cont));
     }
+    test2_parcels_sent += numparcels_default;
 
     // send parcels
     hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
@@ -156,6 +216,9 @@ void test_future_argument(hpx::id_type const& id)
     {
         HPX_TEST_EQ(f.get(), id);
     }
+
+    HPX_TEST_EQ(hpx::async<get_test2_received_action>(id).get(),
+        received_before + numparcels_default);
 }
 
 void test_mixed_arguments(hpx::id_type const& id)
@@ -171,6 +234,10 @@ void test_mixed_arguments(hpx::id_type const& id)
 
     hpx::components::client<test_server> c = hpx::new_<test_server>(id);
 
+    std::size_t received_before =
+        hpx::async<get_test2_received_action>(id).get();
+    std::size_t test1_count = 0;
+
     // create parcels
     std::vector<hpx::parcelset::parcel> parcels;
     for (std::size_t i = 0; i != numparcels_default; ++i)
@@ -183,6 +250,7 @@ void test_mixed_arguments(hpx::id_type const& id)
             parcels.push_back(
                 generate_parcel<test1_action>(c.get_id(), p_cont.get_id(), data)
             );
+            ++test1_count;
         }
         else
         {
@@ -198,6 +266,8 @@ void test_mixed_arguments(hpx::id_type const& id)
 
         results.push_back(std::move(f_cont));
     }
+    test1_parcels_sent += test1_count;
+    test2_parcels_sent += numparcels_default - test1_count;
 
     // send parcels
     hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
@@ -216,15 +286,21 @@ void test_mixed_arguments(hpx::id_type const& id)
     {
         HPX_TEST_EQ(f.get(), id);
     }
+
+    test_received(c.get_id(), test1_count, data);
+    HPX_TEST_EQ(hpx::async<get_test2_received_action>(id).get(),
+        received_before + numparcels_default - test1_count);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void print_counters(char const* name)
+std::int64_t print_counters(char const* name)
 {
     using namespace hpx::performance_counters;
 
     std::vector<performance_counter> counters = discover_counters(name);
+    HPX_TEST_EQ(counters.size(), std::size_t(1));
 
+    std::int64_t result = 0;
     for (performance_counter const& c : counters)
     {
         counter_value value = c.get_counter_value(hpx::launch::sync);
@@ -234,7 +310,10 @@ void print_counters(char const* name)
             << "counter: " << c.get_name(hpx::launch::sync)
             << ", value: " << value.get_value<double>()
             << std::endl;
+
+        result += value.get_value<std::int64_t>();
     }
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -254,11 +333,40 @@ int hpx_main(hpx::program_options::variables_map& vm)
         test_mixed_arguments(id);
     }
 
-    // make sure coalescing was actually invoked
-    print_counters("/coalescing{locality#0/total}/count/parcels@test1_action");
-    print_counters("/coalescing{locality#0/total}/count/parcels@test2_action");
-    print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
-    print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
+    // make sure coalescing was actually invoked for all parcels
+    std::int64_t test1_parcels = print_counters(
+        "/coalescing{locality#0/total}/count/parcels@test1_action");
+    std::int64_t test2_parcels = print_counters(
+        "/coalescing{locality#0/total}/count/parcels@test2_action");
+    HPX_TEST_EQ(test1_parcels, std::int64_t(test1_parcels_sent));
+    HPX_TEST_EQ(test2_parcels, std::int64_t(test2_parcels_sent));
+
+    // coalesced messages hold at least one parcel each
+    std::int64_t test1_messages = print_counters(
+        "/coalescing{locality#0/total}/count/messages@test1_action");
+    std::int64_t test2_messages = print_counters(
+        "/coalescing{locality#0/total}/count/messages@test2_action");
+    HPX_TEST_LTE(test1_messages, test1_parcels);
+    HPX_TEST_LTE(test2_messages, test2_parcels);
+
+    // coalescing parameters, these change if adaptive coalescing is enabled
+    // but never exceed the configured values
+    std::int64_t const num_messages = hpx::util::from_string<std::int64_t>(
+        hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.num_messages", "50"));
+    std::int64_t const interval = hpx::util::from_string<std::int64_t>(
+        hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.interval", "100"));
+
+    std::int64_t max_parcels = print_counters("/coalescing{locality#0/total}"
+                                              "/count/max-parcels-per-message"
+                                              "@test1_action");
+    HPX_TEST_LTE(std::int64_t(1), max_parcels);
+    HPX_TEST_LTE(max_parcels, num_messages);
+
+    std::int64_t flush_interval = print_counters(
+        "/coalescing{locality#0/total}/time/flush-interval@test1_action");
+    HPX_TEST_LTE(flush_interval, interval * 1000);
 
     return hpx::finalize();
 }
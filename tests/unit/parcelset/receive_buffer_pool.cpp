@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using buffer_type = std::vector<char>;
+using pool_type = hpx::parcelset::detail::receive_buffer_pool<buffer_type>;
+
+///////////////////////////////////////////////////////////////////////////////
+// released buffers are handed out again
+void test_reuse()
+{
+    pool_type pool(2, std::size_t(1) << 20);
+
+    buffer_type b;
+    pool.allocate(b, 3000);
+    HPX_TEST_EQ(b.size(), std::size_t(3000));
+    HPX_TEST_LTE(std::size_t(4096), b.capacity());
+
+    char const* data = b.data();
+    pool.deallocate(std::move(b));
+
+    buffer_type c;
+    pool.allocate(c, 2500);
+    HPX_TEST_EQ(c.size(), std::size_t(2500));
+    HPX_TEST(c.data() == data);
+
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(1));
+
+    // allocating into a buffer returns its previous memory to the pool first
+    pool.allocate(c, 4000);
+    HPX_TEST_EQ(c.size(), std::size_t(4000));
+    HPX_TEST(c.data() == data);
+
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(2));
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a pooled buffer is reused only if it is guaranteed to be large enough
+void test_size_classes()
+{
+    pool_type pool(2, std::size_t(1) << 20);
+
+    // buffers with a capacity of [2048, 4096) form one size class
+    buffer_type b;
+    b.reserve(2048);
+    HPX_TEST_EQ(b.capacity(), std::size_t(2048));
+    char const* data = b.data();
+    pool.deallocate(std::move(b));
+
+    // 2049 bytes may not fit into a buffer of the size class above
+    buffer_type c;
+    pool.allocate(c, 2049);
+    HPX_TEST(c.data() != data);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(1));
+
+    // 2048 bytes fit
+    buffer_type d;
+    pool.allocate(d, 2048);
+    HPX_TEST(d.data() == data);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+
+    // new allocations are rounded up to their size class, small ones to the
+    // smallest size class
+    HPX_TEST_EQ(c.capacity(), std::size_t(4096));
+
+    buffer_type e;
+    pool.allocate(e, 10);
+    HPX_TEST_EQ(e.size(), std::size_t(10));
+    HPX_TEST_EQ(e.capacity(), std::size_t(1024));
+
+    // buffers smaller than the smallest size class are not pooled
+    buffer_type f;
+    f.reserve(512);
+    pool.deallocate(std::move(f));
+
+    buffer_type g;
+    pool.allocate(g, 100);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// neither large buffers nor more than max_cached_buffers buffers are pooled
+void test_upper_bound()
+{
+    std::size_t const max_buffer_size = std::size_t(1) << 16;
+    pool_type pool(1, max_buffer_size);
+
+    // buffers beyond the largest size class are not pooled
+    buffer_type b;
+    pool.allocate(b, 2 * max_buffer_size);
+    HPX_TEST_LTE(2 * max_buffer_size, b.capacity());
+    pool.deallocate(std::move(b));
+
+    buffer_type c;
+    pool.allocate(c, 2 * max_buffer_size);
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(2));
+
+    // the largest size class is pooled
+    buffer_type d;
+    pool.allocate(d, max_buffer_size);
+    pool.deallocate(std::move(d));
+
+    buffer_type e;
+    pool.allocate(e, max_buffer_size);
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(1));
+
+    // only one buffer per size class is held
+    buffer_type f, g;
+    pool.allocate(f, 4096);
+    pool.allocate(g, 4096);
+    pool.deallocate(std::move(f));
+    pool.deallocate(std::move(g));
+
+    buffer_type h, i;
+    pool.allocate(h, 4096);
+    pool.allocate(i, 4096);
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(3));
+
+    // a pool without cached buffers never reuses memory
+    pool_type empty_pool(0, max_buffer_size);
+
+    buffer_type j;
+    empty_pool.allocate(j, 4096);
+    empty_pool.deallocate(std::move(j));
+
+    buffer_type k;
+    empty_pool.allocate(k, 4096);
+    HPX_TEST_EQ(empty_pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(empty_pool.get_misses(false), std::int64_t(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reuse();
+    test_size_classes();
+    test_upper_bound();
+
+    return hpx::util::report_errors();
+}